@@ -28,7 +28,8 @@ fi
 
 function build
 {
-    if [ $opt_generate == true -o $opt_rebuild == false ] ; then
+    # The benchmarks register themselves, so have no test case table to generate.
+    if [ $1 != 'dali-toolkit-benchmarks' ] && [ $opt_generate == true -o $opt_rebuild == false ] ; then
         (cd src/$1; ../../scripts/tcheadgen.sh tct-$1-core.h)
         if [ $? -ne 0 ]; then echo "Aborting..."; exit 1; fi
     fi
@@ -47,7 +48,7 @@ if [ -n "$1" ] ; then
 else
   for mod in `ls -1 src/ | grep -v CMakeList `
   do
-    if [ $mod != 'common' ] && [ $mod != 'manual' ]; then
+    if [ $mod != 'common' ] && [ $mod != 'manual' ] && [ $mod != 'dali-toolkit-benchmarks' ]; then
         echo BUILDING $mod
         build $mod
         if [ $? -ne 0 ]; then echo "Build failed" ; exit 1; fi
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 Samsung Electronics Co., Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""
+Compares two result files written by dali-toolkit-benchmarks -o.
+
+The median times are compared, as they're less affected by a noisy machine than the means.
+Exits with 1 if a benchmark is slower than the threshold, failed in the current results,
+or is in the baseline but missing from the current results.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        results = json.load(f)
+    return {benchmark["name"]: benchmark for benchmark in results.get("benchmarks", [])}
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.2f %s" % (ns / scale, unit)
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="Results of the reference build")
+    parser.add_argument("current", help="Results of the build under test")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="Slowdown in percent reported as a regression (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    rows = []
+    for name in sorted(set(baseline) | set(current)):
+        old = baseline.get(name)
+        new = current.get(name)
+        if new is None:
+            # A benchmark which is no longer run can't be checked, e.g. as it crashed before writing its result.
+            rows.append((name, format_time(old["medianNs"]) if "medianNs" in old else "", "", "", "MISSING"))
+            regressions += 1
+            continue
+        if "error" in new:
+            rows.append((name, "", "", "", "error: " + new["error"]))
+            regressions += 1
+            continue
+        if "skipped" in new:
+            rows.append((name, "", "", "", "skipped: " + new["skipped"]))
+            continue
+        if old is None or "medianNs" not in old:
+            rows.append((name, "", format_time(new["medianNs"]), "", "new"))
+            continue
+
+        change = (new["medianNs"] - old["medianNs"]) * 100.0 / old["medianNs"]
+        status = ""
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            status = "improved"
+        rows.append((name, format_time(old["medianNs"]), format_time(new["medianNs"]), "%+.1f%%" % change, status))
+
+    header = ("Benchmark", "Baseline", "Current", "Change", "")
+    widths = [max(len(row[i]) for row in rows + [header]) for i in range(4)]
+    for row in [header] + rows:
+        print("%-*s  %*s  %*s  %*s  %s" % (widths[0], row[0], widths[1], row[1], widths[2], row[2], widths[3], row[3], row[4]))
+
+    if regressions:
+        print("\n%d benchmark(s) regressed by more than %.1f%%, failed or are missing" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -15,8 +15,12 @@
  */
 
 #include <stdlib.h>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <thread>
 #include <typeinfo>
+#include <vector>
 
 // Need to override adaptor classes for toolkit test harness, so include
 // test harness headers before dali headers.
@@ -29,11 +33,22 @@
 #include <dali/devel-api/adaptor-framework/window-devel.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
 
+#include <bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 #include <bullet/btBulletDynamicsCommon.h>
 
 using namespace Dali;
 using namespace Dali::Toolkit::Physics;
 
+namespace
+{
+// A MULTI_THREADED world is only multithreaded when bullet is built with BT_THREADSAFE
+#if BT_THREADSAFE
+constexpr bool MULTI_THREADED_WORLD{true};
+#else
+constexpr bool MULTI_THREADED_WORLD{false};
+#endif
+} // namespace
+
 void utc_dali_physics3d_startup(void)
 {
   test_return_value = TET_UNDEF;
@@ -75,6 +90,183 @@ int UtcDaliPhysics3DCreateAdaptorP1(void)
   END_TEST;
 }
 
+int UtcDaliPhysics3DCreateAdaptorMultiThreaded(void)
+{
+  tet_infoline("Test that a multithreaded world can be created and integrated");
+
+  ToolkitTestApplication application;
+
+  Matrix     transform(true);
+  Uint16Pair size(640, 480);
+
+  PhysicsAdaptor adaptor = PhysicsAdaptor::New(transform, size, PhysicsAdaptor::WorldThreading::MULTI_THREADED);
+  DALI_TEST_CHECK(adaptor);
+  application.GetScene().Add(adaptor.GetRootActor());
+
+  std::vector<btRigidBody*> bodies;
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    DALI_TEST_EQUALS(dynamic_cast<btDiscreteDynamicsWorldMt*>(bulletWorld) != nullptr, MULTI_THREADED_WORLD, TEST_LOCATION);
+
+    for(int i = 0; i < 100; ++i)
+    {
+      btRigidBody* body = CreateBody(bulletWorld);
+      body->getWorldTransform().setOrigin(btVector3(i * 100.0f, 0.0f, 0.0f));
+      bodies.push_back(body);
+    }
+  }
+
+  for(int i = 0; i < 10; ++i)
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  {
+    auto accessor = adaptor.GetPhysicsAccessor();
+    for(auto body : bodies)
+    {
+      // Everything falls under gravity
+      DALI_TEST_CHECK(body->getWorldTransform().getOrigin().y() < 0.0f);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPhysics3DCreateAdaptorMultiThreadedDedicatedThread(void)
+{
+  tet_infoline("Test that a multithreaded world with colliding bodies can be stepped on the integration thread");
+
+  ToolkitTestApplication application;
+
+  Matrix     transform(true);
+  Uint16Pair size(640, 480);
+
+  PhysicsAdaptor adaptor = PhysicsAdaptor::New(transform, size, PhysicsAdaptor::WorldThreading::MULTI_THREADED);
+  DALI_TEST_CHECK(adaptor);
+  application.GetScene().Add(adaptor.GetRootActor());
+
+  std::vector<btRigidBody*> bodies;
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    DALI_TEST_EQUALS(dynamic_cast<btDiscreteDynamicsWorldMt*>(bulletWorld) != nullptr, MULTI_THREADED_WORLD, TEST_LOCATION);
+
+    // Overlapping neighbours, so the dispatcher creates contact manifolds on the pool threads too
+    for(int i = 0; i < 100; ++i)
+    {
+      btRigidBody* body = CreateBody(bulletWorld);
+      body->getWorldTransform().setOrigin(btVector3(i * 40.0f, 0.0f, 0.0f));
+      bodies.push_back(body);
+    }
+  }
+
+  adaptor.SetIntegrationMode(PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD);
+  DALI_TEST_CHECK(adaptor.GetIntegrationMode() == PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD);
+
+  // Wait until the integration thread has stepped the world, with a bounded timeout
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  bool       stepped  = false;
+  while(!stepped && std::chrono::steady_clock::now() < deadline)
+  {
+    application.SendNotification();
+    application.Render();
+    {
+      auto accessor = adaptor.GetPhysicsAccessor();
+      stepped       = std::all_of(bodies.begin(), bodies.end(), [](btRigidBody* body) { return body->getWorldTransform().getOrigin().y() < 0.0f; });
+    }
+    if(!stepped)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  // Everything falls under gravity
+  DALI_TEST_CHECK(stepped);
+
+  adaptor.SetIntegrationMode(PhysicsAdaptor::IntegrationMode::UPDATE_THREAD);
+  DALI_TEST_CHECK(adaptor.GetIntegrationMode() == PhysicsAdaptor::IntegrationMode::UPDATE_THREAD);
+
+  END_TEST;
+}
+
+int UtcDaliPhysics3DAdaptorToggleIntegrationModeMultiThreaded(void)
+{
+  tet_infoline("Test that multithreaded worlds keep stepping when the integration mode is toggled many times");
+
+  ToolkitTestApplication application;
+
+  Matrix     transform(true);
+  Uint16Pair size(640, 480);
+
+  // Two adaptors share the integration thread
+  std::vector<PhysicsAdaptor> adaptors;
+  std::vector<btRigidBody*>   bodies;
+  for(int i = 0; i < 2; ++i)
+  {
+    PhysicsAdaptor adaptor = PhysicsAdaptor::New(transform, size, PhysicsAdaptor::WorldThreading::MULTI_THREADED);
+    application.GetScene().Add(adaptor.GetRootActor());
+
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    DALI_TEST_EQUALS(dynamic_cast<btDiscreteDynamicsWorldMt*>(bulletWorld) != nullptr, MULTI_THREADED_WORLD, TEST_LOCATION);
+    for(int j = 0; j < 20; ++j)
+    {
+      btRigidBody* body = CreateBody(bulletWorld);
+      body->getWorldTransform().setOrigin(btVector3(j * 40.0f, 0.0f, 0.0f));
+      if(j == 0)
+      {
+        bodies.push_back(body);
+      }
+    }
+    adaptors.push_back(adaptor);
+  }
+
+  // Each time the mode changes, every world still falls further under gravity
+  for(int toggle = 0; toggle < 20; ++toggle)
+  {
+    const auto mode = (toggle % 2 == 0) ? PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD : PhysicsAdaptor::IntegrationMode::UPDATE_THREAD;
+    std::vector<float> startY;
+    for(std::size_t i = 0; i < adaptors.size(); ++i)
+    {
+      adaptors[i].SetIntegrationMode(mode);
+      DALI_TEST_CHECK(adaptors[i].GetIntegrationMode() == mode);
+
+      auto accessor = adaptors[i].GetPhysicsAccessor();
+      startY.push_back(bodies[i]->getWorldTransform().getOrigin().y());
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    bool       stepped  = false;
+    while(!stepped && std::chrono::steady_clock::now() < deadline)
+    {
+      application.SendNotification();
+      application.Render();
+
+      stepped = true;
+      for(std::size_t i = 0; i < adaptors.size(); ++i)
+      {
+        auto accessor = adaptors[i].GetPhysicsAccessor();
+        stepped       = stepped && bodies[i]->getWorldTransform().getOrigin().y() < startY[i];
+      }
+      if(!stepped)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    DALI_TEST_CHECK(stepped);
+  }
+
+  for(auto& adaptor : adaptors)
+  {
+    adaptor.SetIntegrationMode(PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD);
+  }
+  adaptors.clear();
+
+  END_TEST;
+}
+
 int UtcDaliPhysics3DCreateAdaptorN1(void)
 {
   ToolkitTestApplication application;
@@ -909,6 +1101,72 @@ int UtcDaliPhysics3DAdaptorCreateSyncPoint(void)
   END_TEST;
 }
 
+int UtcDaliPhysics3DAdaptorIntegrationModeDedicatedThread(void)
+{
+  tet_infoline("Test that the dedicated integration thread runs the queue and updates the actors");
+
+  ToolkitTestApplication application;
+  Matrix                 transform(false);
+  transform.SetIdentityAndScale(Vector3(2.0f, 2.0f, 2.0f));
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor   = PhysicsAdaptor::New(transform, size);
+  Actor          rootActor = adaptor.GetRootActor();
+  auto           scene     = application.GetScene();
+  scene.Add(rootActor);
+
+  DALI_TEST_CHECK(adaptor.GetIntegrationMode() == PhysicsAdaptor::IntegrationMode::UPDATE_THREAD);
+
+  btRigidBody* body{nullptr};
+  Dali::Actor  ballActor = Toolkit::ImageView::New("gallery-small-1.jpg");
+  {
+    auto accessor    = adaptor.GetPhysicsAccessor();
+    auto bulletWorld = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+    body             = CreateBody(bulletWorld);
+    adaptor.AddActorBody(ballActor, body);
+  }
+
+  // Don't let gravity move the body whilst waiting for the thread
+  adaptor.SetIntegrationState(PhysicsAdaptor::IntegrationState::OFF);
+  adaptor.SetIntegrationMode(PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD);
+  DALI_TEST_CHECK(adaptor.GetIntegrationMode() == PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD);
+
+  adaptor.Queue([body]() {
+    body->getWorldTransform().setOrigin(btVector3(100.0f, 20.0f, 20.0f));
+  });
+  adaptor.CreateSyncPoint();
+
+  // Wait until the integration thread has run the queue and published the body, with a bounded timeout
+  const Vector3 expected  = adaptor.TranslateFromPhysicsSpace(Vector3(100.0f, 20.0f, 20.0f));
+  const auto    deadline  = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  bool          published = false;
+  while(!published && std::chrono::steady_clock::now() < deadline)
+  {
+    application.SendNotification();
+    application.Render();
+    published = (ballActor.GetCurrentProperty<Vector3>(Actor::Property::POSITION) - expected).Length() < 0.001f;
+    if(!published)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  DALI_TEST_CHECK(published);
+  DALI_TEST_EQUALS(ballActor.GetCurrentProperty<Vector3>(Actor::Property::POSITION), expected, 0.001f, TEST_LOCATION);
+
+  {
+    auto accessor = adaptor.GetPhysicsAccessor();
+
+    btVector3 origin = body->getWorldTransform().getOrigin();
+    DALI_TEST_EQUALS(origin.x(), 100.0f, 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(origin.y(), 20.0f, 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(origin.z(), 20.0f, 0.001f, TEST_LOCATION);
+  }
+
+  adaptor.SetIntegrationMode(PhysicsAdaptor::IntegrationMode::UPDATE_THREAD);
+  DALI_TEST_CHECK(adaptor.GetIntegrationMode() == PhysicsAdaptor::IntegrationMode::UPDATE_THREAD);
+
+  END_TEST;
+}
+
 int UtcDaliPhysics3DAdaptorHitTestP(void)
 {
   tet_infoline("Test that hit testing finds a body");
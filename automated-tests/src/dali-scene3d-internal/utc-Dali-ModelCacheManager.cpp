@@ -20,13 +20,18 @@
 
 #include <dali-scene3d/internal/common/image-resource-loader.h>
 #include <dali-scene3d/internal/common/model-cache-manager.h>
+#include <dali-scene3d/internal/common/model-disk-cache.h>
 #include <dali-scene3d/public-api/controls/model/model.h>
+#include <dali-scene3d/public-api/loader/load-result.h>
+#include <dali-scene3d/public-api/loader/model-loader.h>
 #include <dali-scene3d/public-api/loader/resource-bundle.h>
 #include <dali-scene3d/public-api/loader/scene-definition.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-timer.h>
+#include <filesystem>
 #include <string>
+#include <unistd.h>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -184,3 +189,90 @@ int UtcDaliModelCacheManagerLoadModel(void)
 
   END_TEST;
 }
+
+int UtcDaliModelCacheManagerDiskCache(void)
+{
+  ToolkitTestApplication application;
+
+  using namespace Dali::Scene3D::Loader;
+
+  ModelCacheManager cacheManager = ModelCacheManager::Get();
+  DALI_TEST_CHECK(!cacheManager.HasDiskCache(TEST_GLTF_FILE_NAME));
+
+  // Use a directory of this test only, so that parallel test runs don't share the cache file.
+  const std::string cacheDirectory = (std::filesystem::temp_directory_path() / ("dali-scene3d-model-cache-" + std::to_string(getpid()))).string();
+  std::filesystem::remove_all(cacheDirectory);
+
+  cacheManager.SetDiskCacheDirectory(cacheDirectory);
+  DALI_TEST_EQUALS(cacheManager.GetDiskCacheDirectory(), cacheDirectory, TEST_LOCATION);
+
+  ResourceBundle::PathProvider pathProvider = [](ResourceType::Value) {
+    return TEST_RESOURCE_DIR "/";
+  };
+
+  struct Context
+  {
+    ResourceBundle                        resources;
+    SceneDefinition                       scene;
+    SceneMetadata                         metaData;
+    std::vector<AnimationDefinition>      animations;
+    std::vector<AnimationGroupDefinition> animationGroups;
+    std::vector<CameraParameters>         cameras;
+    std::vector<LightParameters>          lights;
+    LoadResult                            loadResult{resources, scene, metaData, animations, animationGroups, cameras, lights};
+  };
+
+  // The first load processes the meshes, and writes them to the disk cache.
+  Context     first;
+  ModelLoader firstLoader(TEST_GLTF_FILE_NAME, TEST_RESOURCE_DIR "/", first.loadResult);
+  DALI_TEST_CHECK(firstLoader.LoadModel(pathProvider, true));
+  DALI_TEST_CHECK(cacheManager.HasDiskCache(TEST_GLTF_FILE_NAME));
+
+  // The second load reads the same mesh data from the disk cache.
+  Context     second;
+  ModelLoader secondLoader(TEST_GLTF_FILE_NAME, TEST_RESOURCE_DIR "/", second.loadResult);
+  DALI_TEST_CHECK(secondLoader.LoadModel(pathProvider, true));
+
+  DALI_TEST_EQUALS(first.resources.mMeshes.size(), second.resources.mMeshes.size(), TEST_LOCATION);
+  for(uint32_t i = 0u; i < first.resources.mMeshes.size(); ++i)
+  {
+    auto& expected = first.resources.mMeshes[i].first.mRawData;
+    auto& actual   = second.resources.mMeshes[i].first.mRawData;
+    DALI_TEST_EQUALS(!!expected, !!actual, TEST_LOCATION);
+
+    // The bounds computed while loading the positions are used for the extents of the model.
+    DALI_TEST_CHECK(first.resources.mMeshes[i].first.mPositions.mBlob.mMin == second.resources.mMeshes[i].first.mPositions.mBlob.mMin);
+    DALI_TEST_CHECK(first.resources.mMeshes[i].first.mPositions.mBlob.mMax == second.resources.mMeshes[i].first.mPositions.mBlob.mMax);
+    if(expected)
+    {
+      DALI_TEST_EQUALS(second.resources.mMeshes[i].first.mPositions.mBlob.mMin.size(), 3u, TEST_LOCATION);
+    }
+    if(expected && actual)
+    {
+      DALI_TEST_CHECK(expected->mIndices == actual->mIndices);
+      DALI_TEST_EQUALS(expected->mAttribs.size(), actual->mAttribs.size(), TEST_LOCATION);
+      for(uint32_t j = 0u; j < expected->mAttribs.size(); ++j)
+      {
+        DALI_TEST_EQUALS(expected->mAttribs[j].mName, actual->mAttribs[j].mName, TEST_LOCATION);
+        DALI_TEST_EQUALS(expected->mAttribs[j].mNumElements, actual->mAttribs[j].mNumElements, TEST_LOCATION);
+        DALI_TEST_CHECK(expected->mAttribs[j].mData == actual->mAttribs[j].mData);
+      }
+    }
+  }
+
+  // No temporary file is left behind.
+  uint32_t fileCount = 0u;
+  for(auto& entry : std::filesystem::directory_iterator(cacheDirectory))
+  {
+    DALI_TEST_EQUALS(entry.path().string(), Dali::Scene3D::Internal::ModelDiskCache::GetCacheFilePath(TEST_GLTF_FILE_NAME), TEST_LOCATION);
+    ++fileCount;
+  }
+  DALI_TEST_EQUALS(fileCount, 1u, TEST_LOCATION);
+
+  // Disable the disk cache again, not to affect other test cases.
+  cacheManager.SetDiskCacheDirectory(std::string());
+  std::filesystem::remove_all(cacheDirectory);
+  DALI_TEST_CHECK(!cacheManager.HasDiskCache(TEST_GLTF_FILE_NAME));
+
+  END_TEST;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali/integration-api/adaptor-framework/shader-precompiler.h>
+#include <stdlib.h>
+#include <iostream>
+#include <sstream>
+
+#include <dali-scene3d/internal/common/shader-variant-cache.h>
+#include <dali-scene3d/internal/model-components/material-impl.h>
+#include <dali-scene3d/internal/model-components/model-primitive-impl.h>
+#include <dali-scene3d/public-api/loader/shader-manager.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void shader_variant_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void shader_variant_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+std::string GetVertexShader(Dali::Shader shader)
+{
+  Property::Value program = shader.GetProperty(Shader::Property::PROGRAM);
+  return program.GetArray()->GetElementAt(0).GetMap()->Find("vertex")->Get<std::string>();
+}
+
+std::string GetPrecompiledVertexShader(const std::string& shaderName)
+{
+  std::vector<RawShaderData> precompiledShaderList;
+  ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList);
+  for(auto& rawShaderData : precompiledShaderList)
+  {
+    if(!rawShaderData.shaderName.empty() && rawShaderData.shaderName[0] == shaderName)
+    {
+      return std::string(rawShaderData.vertexShader);
+    }
+  }
+  return std::string();
+}
+
+std::string GetPrecompileShaderName(const Scene3D::Loader::ShaderOption& option)
+{
+  std::ostringstream oss;
+  oss << "SCENE3D_PBR_" << std::hex << option.GetOptionHash();
+  return oss.str();
+}
+} // namespace
+
+int UtcDaliShaderVariantCacheWarmUp(void)
+{
+  tet_infoline("UtcDaliShaderVariantCacheWarmUp: Check the warmed variant is precompiled and used by ProduceShader");
+
+  ToolkitTestApplication application;
+
+  Scene3D::Loader::ShaderOption option;
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::THREE_TEXTURE);
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::GLTF_CHANNELS);
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::EMISSIVE);
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::OCCLUSION);
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::VEC4_TANGENT);
+  option.AddJointMacros(0);
+
+  DALI_TEST_CHECK(!Scene3D::Internal::ShaderVariantCache::IsCached(option.GetOptionHash()));
+
+  // The application asks for the precompiled shaders.
+  VisualFactory::Get().UsePreCompiledShader();
+
+  Scene3D::Loader::ShaderManager::WarmUp({option});
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  DALI_TEST_CHECK(Scene3D::Internal::ShaderVariantCache::IsCached(option.GetOptionHash()));
+
+  // The warmed sources are registered to the precompiler, without the shader prefix, along with the visual shaders.
+  const std::string precompiledVertexShader = GetPrecompiledVertexShader(GetPrecompileShaderName(option));
+  DALI_TEST_CHECK(!precompiledVertexShader.empty());
+  std::vector<RawShaderData> precompiledShaderList;
+  ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList);
+  DALI_TEST_EQUALS(precompiledShaderList.size(), 5u, TEST_LOCATION); // Image, text and color visuals, then PBR and shadow map.
+
+  // A later ProduceShader() uses the warmed sources, which the precompiler compiled already.
+  Scene3D::Loader::ShaderManagerPtr shaderManager = new Scene3D::Loader::ShaderManager();
+  Dali::Shader                      shader        = shaderManager->ProduceShader(option);
+  DALI_TEST_CHECK(shader);
+  DALI_TEST_EQUALS(GetVertexShader(shader), Dali::Shader::GetVertexShaderPrefix() + precompiledVertexShader, TEST_LOCATION);
+
+  // The precompiler doesn't keep the sources of the produced variant anymore.
+  DALI_TEST_CHECK(GetPrecompiledVertexShader(GetPrecompileShaderName(option)).empty());
+  ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList);
+  DALI_TEST_EQUALS(precompiledShaderList.size(), 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderVariantCacheWarmUpWithoutPrecompiler(void)
+{
+  tet_infoline("UtcDaliShaderVariantCacheWarmUpWithoutPrecompiler: Check the warm-up doesn't enable the shader precompiler");
+
+  ToolkitTestApplication application;
+
+  Scene3D::Loader::ShaderOption option;
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::THREE_TEXTURE);
+  option.AddOption(Scene3D::Loader::ShaderOption::Type::SKINNING);
+  option.AddJointMacros(1);
+
+  Scene3D::Loader::ShaderManager::WarmUp({option});
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  // The sources are still cached for ProduceShader(), but nothing is precompiled.
+  DALI_TEST_CHECK(Scene3D::Internal::ShaderVariantCache::IsCached(option.GetOptionHash()));
+  DALI_TEST_CHECK(!ShaderPreCompiler::Get().IsEnable());
+  DALI_TEST_CHECK(GetPrecompiledVertexShader(GetPrecompileShaderName(option)).empty());
+
+  END_TEST;
+}
+
+int UtcDaliShaderVariantCacheModelPrimitiveShaderOption(void)
+{
+  tet_infoline("UtcDaliShaderVariantCacheModelPrimitiveShaderOption: Check the prepared option matches the one of the ModelPrimitive");
+
+  ToolkitTestApplication application;
+
+  Scene3D::Loader::MaterialDefinition materialDefinition;
+  materialDefinition.mTextureStages.push_back({Scene3D::Loader::MaterialDefinition::ALBEDO, {}});
+  materialDefinition.mTextureStages.push_back({Scene3D::Loader::MaterialDefinition::NORMAL, {}});
+  materialDefinition.mAlphaModeType = Scene3D::Material::AlphaModeType::BLEND;
+
+  Scene3D::Loader::MeshDefinition meshDefinition;
+
+  Scene3D::Material material = Scene3D::Material::New();
+  material.SetProperty(Scene3D::Material::Property::ALPHA_MODE, Scene3D::Material::AlphaModeType::BLEND);
+
+  Scene3D::Internal::Material::TextureInformation baseColor;
+  baseColor.mTexture = Dali::Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 100, 100);
+  baseColor.mSampler = Dali::Sampler::New();
+  GetImplementation(material).SetTextureInformation(Scene3D::Material::TextureType::BASE_COLOR, std::move(baseColor));
+
+  Scene3D::Internal::Material::TextureInformation normal;
+  normal.mTexture = Dali::Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 100, 100);
+  normal.mSampler = Dali::Sampler::New();
+  GetImplementation(material).SetTextureInformation(Scene3D::Material::TextureType::NORMAL, std::move(normal));
+
+  Scene3D::ModelPrimitive modelPrimitive = Scene3D::ModelPrimitive::New();
+  modelPrimitive.SetGeometry(Dali::Geometry::New());
+  modelPrimitive.SetMaterial(material);
+
+  const auto shaderOption = Scene3D::Internal::ShaderVariantCache::MakeModelPrimitiveShaderOption(materialDefinition, meshDefinition);
+  DALI_TEST_EQUALS(GetImplementation(modelPrimitive).GetShaderOptionHash(), shaderOption.GetOptionHash(), TEST_LOCATION);
+
+  // The loader option differs, so both are prepared.
+  Scene3D::Loader::ShaderManagerPtr shaderManager = new Scene3D::Loader::ShaderManager();
+  DALI_TEST_CHECK(shaderManager->ProduceShaderOption(materialDefinition, meshDefinition).GetOptionHash() != shaderOption.GetOptionHash());
+
+  END_TEST;
+}
@@ -20,6 +20,8 @@
 
 #include <dali-test-suite-utils.h>
 #include <string_view>
+#include "dali-scene3d/public-api/loader/load-result.h"
+#include "dali-scene3d/public-api/loader/model-loader.h"
 #include "dali-scene3d/public-api/loader/resource-bundle.h"
 #include "dali-scene3d/public-api/loader/utils.h"
 
@@ -69,3 +71,60 @@ int UtcDaliResourceRefCounts(void)
 
   END_TEST;
 }
+
+int UtcDaliResourceBundleLoadRawResourcesParallel(void)
+{
+  TestApplication app;
+
+  // The meshes of this model share one buffer, and are loaded by several worker threads.
+  std::string                  resourcePath = TEST_RESOURCE_DIR "/";
+  ResourceBundle::PathProvider pathProvider = [&resourcePath](ResourceType::Value) {
+    return resourcePath;
+  };
+
+  ResourceBundle                        resources;
+  SceneDefinition                       scene;
+  SceneMetadata                         metaData;
+  std::vector<AnimationDefinition>      animations;
+  std::vector<AnimationGroupDefinition> animationGroups;
+  std::vector<CameraParameters>         cameras;
+  std::vector<LightParameters>          lights;
+  LoadResult                            loadResult{resources, scene, metaData, animations, animationGroups, cameras, lights};
+
+  ModelLoader loader(resourcePath + "2CylinderEngine.gltf", resourcePath, loadResult);
+  DALI_TEST_CHECK(loader.LoadModel(pathProvider, true));
+  DALI_TEST_CHECK(resources.mRawResourcesLoaded);
+  DALI_TEST_CHECK(resources.mMeshes.size() > 1u);
+
+  uint32_t loadedMeshCount = 0u;
+  for(auto& mesh : resources.mMeshes)
+  {
+    if(!mesh.first.mRawData)
+    {
+      continue;
+    }
+    ++loadedMeshCount;
+
+    // Compare with the data read serially through the original buffers.
+    auto expected = mesh.first.LoadRaw(resourcePath, resources.mBuffers);
+    DALI_TEST_CHECK(mesh.first.mRawData->mIndices == expected.mIndices);
+    DALI_TEST_EQUALS(mesh.first.mRawData->mAttribs.size(), expected.mAttribs.size(), TEST_LOCATION);
+    for(uint32_t i = 0u; i < expected.mAttribs.size(); ++i)
+    {
+      DALI_TEST_EQUALS(mesh.first.mRawData->mAttribs[i].mName, expected.mAttribs[i].mName, TEST_LOCATION);
+      DALI_TEST_CHECK(mesh.first.mRawData->mAttribs[i].mData == expected.mAttribs[i].mData);
+    }
+  }
+  DALI_TEST_CHECK(loadedMeshCount > 1u);
+
+  resources.GenerateResources();
+  for(auto& mesh : resources.mMeshes)
+  {
+    if(mesh.first.mRawData)
+    {
+      DALI_TEST_CHECK(mesh.second.geometry);
+    }
+  }
+
+  END_TEST;
+}
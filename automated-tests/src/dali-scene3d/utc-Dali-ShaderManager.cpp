@@ -335,3 +335,35 @@ int UtcDaliShaderManagerAddAndRemoveLights(void)
 
   END_TEST;
 }
+
+int UtcDaliShaderManagerSharedVariantsKeepLightsPerManager(void)
+{
+  TestApplication app;
+  ShaderManager   shaderManager1;
+  ShaderManager   shaderManager2;
+
+  ShaderOption option;
+  option.AddOption(ShaderOption::Type::THREE_TEXTURE);
+  option.AddOption(ShaderOption::Type::NORMAL_TEXTURE);
+
+  // The sources of the variant are shared, but each manager owns its own Shader.
+  Dali::Shader shader1 = shaderManager1.ProduceShader(option);
+  Dali::Shader shader2 = shaderManager2.ProduceShader(option);
+  DALI_TEST_CHECK(shader1);
+  DALI_TEST_CHECK(shader2);
+  DALI_TEST_NOT_EQUALS(shader1, shader2, 0.1f, TEST_LOCATION);
+  DALI_TEST_EQUALS(shader1, shaderManager1.ProduceShader(option), TEST_LOCATION);
+
+  Property::Value program1 = shader1.GetProperty(Shader::Property::PROGRAM);
+  Property::Value program2 = shader2.GetProperty(Shader::Property::PROGRAM);
+  DALI_TEST_EQUALS(program1.GetArray()->GetElementAt(0).GetMap()->Find("vertex")->Get<std::string>(), program2.GetArray()->GetElementAt(0).GetMap()->Find("vertex")->Get<std::string>(), TEST_LOCATION);
+
+  // Lights are applied per manager.
+  Scene3D::Light light = Scene3D::Light::New();
+  shaderManager1.AddLight(light);
+
+  DALI_TEST_EQUALS(shader1.GetProperty<int>(shader1.GetPropertyIndex("uLightCount")), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(shader2.GetProperty<int>(shader2.GetPropertyIndex("uLightCount")), 0, TEST_LOCATION);
+
+  END_TEST;
+}
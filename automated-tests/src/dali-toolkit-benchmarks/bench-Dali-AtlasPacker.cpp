@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/image-loader/atlas-packer.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+constexpr uint32_t ATLAS_SIZE  = 2048u;
+constexpr uint32_t BLOCK_COUNT = 1000u;
+
+std::vector<Uint16Pair> CreateBlockSizes(uint32_t count)
+{
+  Benchmark::Random       random(7u);
+  std::vector<Uint16Pair> blockSizes;
+  blockSizes.reserve(count);
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    blockSizes.emplace_back(random.Next(8u, 64u), random.Next(8u, 64u));
+  }
+  return blockSizes;
+}
+
+} // namespace
+
+DALI_BENCHMARK(AtlasPackerPack)
+{
+  ToolkitTestApplication application;
+
+  const std::vector<Uint16Pair> blockSizes = CreateBlockSizes(BLOCK_COUNT);
+  state.SetItemsPerIteration(blockSizes.size());
+
+  uint32_t packedCount = 0u;
+  while(state.KeepRunning())
+  {
+    Internal::AtlasPacker packer(ATLAS_SIZE, ATLAS_SIZE);
+
+    packedCount = 0u;
+    for(const auto& blockSize : blockSizes)
+    {
+      Internal::AtlasPacker::SizeType x = 0u, y = 0u;
+      if(packer.Pack(blockSize.GetWidth(), blockSize.GetHeight(), x, y))
+      {
+        ++packedCount;
+      }
+    }
+    Benchmark::DoNotOptimize(packedCount);
+  }
+  state.SetCounter("packedBlocks", packedCount);
+}
+
+DALI_BENCHMARK(AtlasPackerPackAndDelete)
+{
+  ToolkitTestApplication application;
+
+  // Keeps the atlas half full, as glyphs are added and removed by the text.
+  const std::vector<Uint16Pair> blockSizes = CreateBlockSizes(BLOCK_COUNT);
+  state.SetItemsPerIteration(blockSizes.size());
+
+  Internal::AtlasPacker                      packer(ATLAS_SIZE, ATLAS_SIZE);
+  std::vector<std::pair<uint32_t, uint32_t>> positions(blockSizes.size(), {0u, 0u});
+  std::vector<bool>                          isPacked(blockSizes.size(), false);
+
+  uint32_t index = 0u;
+  while(state.KeepRunning())
+  {
+    for(uint32_t i = 0u; i < blockSizes.size(); ++i, index = (index + 1u) % blockSizes.size())
+    {
+      const Uint16Pair& blockSize = blockSizes[index];
+      if(isPacked[index])
+      {
+        packer.DeleteBlock(positions[index].first, positions[index].second, blockSize.GetWidth(), blockSize.GetHeight());
+        isPacked[index] = false;
+      }
+      else
+      {
+        Internal::AtlasPacker::SizeType x = 0u, y = 0u;
+        isPacked[index]  = packer.Pack(blockSize.GetWidth(), blockSize.GetHeight(), x, y);
+        positions[index] = {x, y};
+      }
+    }
+  }
+  state.SetCounter("availableArea", packer.GetAvailableArea());
+}
+
+DALI_BENCHMARK(AtlasPackerGroupPack)
+{
+  ToolkitTestApplication application;
+
+  const std::vector<Uint16Pair> blockSizes = CreateBlockSizes(BLOCK_COUNT);
+
+  Dali::Vector<Uint16Pair> sizes;
+  sizes.Reserve(blockSizes.size());
+  for(const auto& blockSize : blockSizes)
+  {
+    sizes.PushBack(blockSize);
+  }
+  state.SetItemsPerIteration(sizes.Count());
+
+  Uint16Pair requiredSize;
+  while(state.KeepRunning())
+  {
+    Dali::Vector<Uint16Pair> positions;
+    requiredSize = Internal::AtlasPacker::GroupPack(sizes, positions);
+    Benchmark::DoNotOptimize(requiredSize);
+  }
+  state.SetCounter("requiredWidth", requiredSize.GetWidth());
+  state.SetCounter("requiredHeight", requiredSize.GetHeight());
+}
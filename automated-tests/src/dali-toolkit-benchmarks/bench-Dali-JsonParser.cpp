@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+/**
+ * @brief Creates a style sheet like document, with nested objects, arrays, numbers, strings and escapes.
+ */
+std::string CreateDocument(uint32_t styleCount)
+{
+  Benchmark::Random random(42u);
+
+  std::string document = "{\n  \"constants\": { \"PACKAGE_PATH\": \"/usr/share/dali/toolkit/\" },\n  \"styles\":\n  {\n";
+  for(uint32_t i = 0u; i < styleCount; ++i)
+  {
+    const std::string index = std::to_string(i);
+    document += "    \"Style" + index + "\":\n    {\n";
+    document += "      \"pointSize\": " + std::to_string(random.Next(8u, 40u)) + ",\n";
+    document += "      \"textColor\": [" + std::to_string(random.NextFloat(0.0f, 1.0f)) + ", " + std::to_string(random.NextFloat(0.0f, 1.0f)) + ", " + std::to_string(random.NextFloat(0.0f, 1.0f)) + ", 1.0],\n";
+    document += "      \"text\": \"Label \\\"" + index + "\\\" \\u00e9\\n\",\n";
+    document += "      \"enabled\": " + std::string((i % 2u) ? "true" : "false") + ",\n";
+    document += "      \"background\": { \"visualType\": \"IMAGE\", \"url\": \"{PACKAGE_PATH}images/background-" + index + ".png\", \"border\": [4, 4, 4, 4] },\n";
+    document += "      \"states\": { \"NORMAL\": { \"opacity\": 1.0 }, \"DISABLED\": { \"opacity\": 0.5 } }\n";
+    document += (i + 1u < styleCount) ? "    },\n" : "    }\n";
+  }
+  document += "  }\n}\n";
+  return document;
+}
+
+} // namespace
+
+DALI_BENCHMARK(JsonParserParse)
+{
+  ToolkitTestApplication application;
+
+  const std::string document = CreateDocument(2000u);
+  state.SetItemsPerIteration(document.size());
+  state.SetCounter("bytes", document.size());
+
+  if(!JsonParser::New().Parse(document))
+  {
+    state.SkipWithError("The document is not valid");
+  }
+
+  while(state.KeepRunning())
+  {
+    JsonParser parser = JsonParser::New();
+    bool       parsed = parser.Parse(document);
+    Benchmark::DoNotOptimize(parsed);
+  }
+}
+
+DALI_BENCHMARK(JsonParserParseSmallDocuments)
+{
+  ToolkitTestApplication application;
+
+  // Many small documents, as a property map is parsed from a JSON string.
+  std::vector<std::string> documents;
+  for(uint32_t i = 0u; i < 100u; ++i)
+  {
+    documents.push_back(CreateDocument(1u + i % 3u));
+  }
+  state.SetItemsPerIteration(documents.size());
+
+  while(state.KeepRunning())
+  {
+    for(const auto& document : documents)
+    {
+      JsonParser parser = JsonParser::New();
+      bool       parsed = parser.Parse(document);
+      Benchmark::DoNotOptimize(parsed);
+    }
+  }
+}
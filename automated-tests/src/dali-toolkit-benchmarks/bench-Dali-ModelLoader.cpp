@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <string>
+#include <vector>
+#include "dali-scene3d/public-api/loader/load-result.h"
+#include "dali-scene3d/public-api/loader/model-loader.h"
+#include "dali-scene3d/public-api/loader/resource-bundle.h"
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+
+namespace
+{
+/**
+ * @brief Loads 2CylinderEngine.gltf once.
+ * @param[in] generateResources Whether the DALi objects are created from the raw resources
+ * @return True if the model was loaded
+ */
+bool LoadModel(bool generateResources)
+{
+  std::string                  resourcePath = TEST_RESOURCE_DIR "/";
+  ResourceBundle::PathProvider pathProvider = [&resourcePath](ResourceType::Value) {
+    return resourcePath;
+  };
+
+  ResourceBundle                        resources;
+  SceneDefinition                       scene;
+  SceneMetadata                         metaData;
+  std::vector<AnimationDefinition>      animations;
+  std::vector<AnimationGroupDefinition> animationGroups;
+  std::vector<CameraParameters>         cameras;
+  std::vector<LightParameters>          lights;
+  LoadResult                            loadResult{resources, scene, metaData, animations, animationGroups, cameras, lights};
+
+  ModelLoader loader(resourcePath + "2CylinderEngine.gltf", resourcePath, loadResult);
+  if(!loader.LoadModel(pathProvider, true))
+  {
+    return false;
+  }
+  if(generateResources)
+  {
+    resources.GenerateResources();
+  }
+  return resources.mRawResourcesLoaded;
+}
+
+} // namespace
+
+DALI_BENCHMARK(ModelLoaderLoadRawResources)
+{
+  ToolkitTestApplication application;
+
+  if(!LoadModel(false))
+  {
+    state.SkipWithError("Failed to load 2CylinderEngine.gltf");
+    return;
+  }
+  while(state.KeepRunning())
+  {
+    Benchmark::DoNotOptimize(LoadModel(false));
+  }
+}
+
+DALI_BENCHMARK(ModelLoaderLoadAndGenerateResources)
+{
+  ToolkitTestApplication application;
+
+  if(!LoadModel(true))
+  {
+    state.SkipWithError("Failed to load 2CylinderEngine.gltf");
+    return;
+  }
+  while(state.KeepRunning())
+  {
+    Benchmark::DoNotOptimize(LoadModel(true));
+  }
+}
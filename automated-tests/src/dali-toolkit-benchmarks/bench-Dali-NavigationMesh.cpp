@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <vector>
+#include "dali-scene3d/public-api/algorithm/navigation-mesh.h"
+#include "dali-scene3d/public-api/loader/navigation-mesh-factory.h"
+
+using namespace Dali;
+using namespace Dali::Scene3D::Algorithm;
+using namespace Dali::Scene3D::Loader;
+
+namespace
+{
+constexpr uint32_t QUERY_COUNT = 4096u;
+}
+
+DALI_BENCHMARK(NavigationMeshFindFloor)
+{
+  ToolkitTestApplication application;
+
+  auto navmesh = NavigationMeshFactory::CreateFromFile(TEST_RESOURCE_DIR "/navmesh-test.bin");
+  if(!navmesh || navmesh->GetFaceCount() == 0u)
+  {
+    state.SkipWithError("Failed to load navmesh-test.bin");
+    return;
+  }
+  navmesh->SetSceneTransform(Matrix(Matrix::IDENTITY));
+
+  // Query above random points of the faces, so every query finds a floor.
+  const auto           up = -navmesh->GetGravityVector();
+  Benchmark::Random    random;
+  std::vector<Vector3> positions;
+  positions.reserve(QUERY_COUNT);
+  for(auto i = 0u; i < QUERY_COUNT; ++i)
+  {
+    auto face = navmesh->GetFace(FaceIndex(random.Next(0u, navmesh->GetFaceCount() - 1u)));
+    positions.emplace_back(Vector3(face->center[0], face->center[1], face->center[2]) + up * random.NextFloat(0.1f, 1.0f));
+  }
+  state.SetItemsPerIteration(QUERY_COUNT);
+
+  uint32_t foundCount = 0u;
+  while(state.KeepRunning())
+  {
+    foundCount = 0u;
+    for(const auto& position : positions)
+    {
+      Vector3   outPosition;
+      FaceIndex outFaceIndex;
+      foundCount += navmesh->FindFloor(position, outPosition, outFaceIndex) ? 1u : 0u;
+      Benchmark::DoNotOptimize(outPosition);
+    }
+  }
+  state.SetCounter("faces", navmesh->GetFaceCount());
+  state.SetCounter("foundRatio", double(foundCount) / QUERY_COUNT);
+}
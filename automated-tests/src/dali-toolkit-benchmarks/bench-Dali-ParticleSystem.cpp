@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/particle-system/particle-emitter-impl.h>
+#include <dali-toolkit/internal/particle-system/particle-list-impl.h>
+#include <dali-toolkit/public-api/particle-system/particle-builtin-modifiers.h>
+#include <dali-toolkit/public-api/particle-system/particle-domain.h>
+#include <dali-toolkit/public-api/particle-system/particle-emitter.h>
+#include <dali-toolkit/public-api/particle-system/particle-list.h>
+#include <dali-toolkit/public-api/particle-system/particle-modifier.h>
+#include <dali-toolkit/public-api/particle-system/particle-renderer.h>
+#include <dali-toolkit/public-api/particle-system/particle-source.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit::ParticleSystem;
+
+namespace
+{
+constexpr uint32_t PARTICLE_COUNT = 100000u;
+constexpr float    FRAME_DELTA    = 1.0f / 60.0f;
+constexpr float    MINIMUM_LIFE   = 0.25f;
+constexpr float    MAXIMUM_LIFE   = 1.0f;
+
+/**
+ * @brief Emits particles with random lifetimes until the list is full.
+ */
+class ChurnSource : public ParticleSourceInterface
+{
+public:
+  ChurnSource(ParticleEmitter*)
+  {
+  }
+
+  uint32_t Update(ParticleList& outList, uint32_t count) override
+  {
+    for(auto i = 0u; i < count; ++i)
+    {
+      auto particle = outList.NewParticle(mRandom.NextFloat(MINIMUM_LIFE, MAXIMUM_LIFE));
+      if(!particle)
+      {
+        return i;
+      }
+      particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT) = Vector3(mRandom.NextFloat(-100.0f, 100.0f), 0.0f, 0.0f);
+      particle.Get<Vector3>(ParticleStream::VELOCITY_STREAM_BIT) = Vector3(0.0f, mRandom.NextFloat(-50.0f, -10.0f), 0.0f);
+      particle.Get<Vector4>(ParticleStream::COLOR_STREAM_BIT)    = Color::WHITE;
+      particle.Get<Vector3>(ParticleStream::SCALE_STREAM_BIT)    = Vector3::ONE;
+    }
+    return count;
+  }
+
+  void Init() override
+  {
+  }
+
+  Benchmark::Random mRandom{13u};
+};
+
+/**
+ * @brief Steps the emitter by a fixed time, as ParticleEmitter::Update() does with the clock.
+ *
+ * The expired particles are refilled every frame, so the list stays full and a few thousand
+ * particles are released and emitted per frame.
+ */
+void StepFrame(Toolkit::ParticleSystem::Internal::ParticleEmitter& emitter, Toolkit::ParticleSystem::Internal::ParticleList& list)
+{
+  list.SetUpdateDeltaTime(FRAME_DELTA);
+  if(list.GetActiveParticleCount())
+  {
+    emitter.UpdateLifetimes(FRAME_DELTA);
+  }
+  if(auto emissionCount = PARTICLE_COUNT - list.GetActiveParticleCount())
+  {
+    emitter.UpdateSource(emissionCount);
+  }
+  emitter.UpdateModifiers();
+}
+
+void BenchmarkChurn(Benchmark::State& state, bool parallel)
+{
+  ToolkitTestApplication application;
+
+  auto emitter = ParticleEmitter::New();
+  emitter.SetSource(ParticleSource::New<ChurnSource>(&emitter));
+  emitter.SetRenderer(ParticleRenderer::New());
+  emitter.SetDomain(ParticleDomain::New());
+  emitter.SetParticleCount(PARTICLE_COUNT);
+  emitter.AddModifier(ParticleModifier::New<GravityModifier>(Vector3(0.0f, 98.0f, 0.0f)));
+  emitter.AddModifier(ParticleModifier::New<DragModifier>(0.5f));
+  emitter.AddModifier(ParticleModifier::New<ColorOverLifeModifier>(Vector4::ONE, Vector4::ZERO));
+  emitter.EnableParallelProcessing(parallel);
+
+  auto& emitterImpl = Toolkit::ParticleSystem::GetImplementation(emitter);
+  auto& listImpl    = Toolkit::ParticleSystem::GetImplementation(emitter.GetParticleList());
+
+  // Fill the list, then run a second of frames so that the lifetimes are spread.
+  for(auto i = 0u; i < 60u; ++i)
+  {
+    StepFrame(emitterImpl, listImpl);
+  }
+  state.SetItemsPerIteration(PARTICLE_COUNT);
+
+  uint32_t emittedCount = 0u;
+  uint64_t frameCount    = 0u;
+  while(state.KeepRunning())
+  {
+    auto activeCount = listImpl.GetActiveParticleCount();
+    StepFrame(emitterImpl, listImpl);
+    emittedCount += PARTICLE_COUNT - activeCount;
+    ++frameCount;
+  }
+  state.SetCounter("activeParticles", listImpl.GetActiveParticleCount());
+  state.SetCounter("emittedPerFrame", frameCount ? double(emittedCount) / frameCount : 0.0);
+}
+
+} // namespace
+
+DALI_BENCHMARK(ParticleEmitterChurn100k)
+{
+  BenchmarkChurn(state, false);
+}
+
+DALI_BENCHMARK(ParticleEmitterChurn100kParallel)
+{
+  BenchmarkChurn(state, true);
+}
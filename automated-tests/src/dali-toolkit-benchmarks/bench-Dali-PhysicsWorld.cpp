@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-physics/dali-physics.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <memory>
+#include <vector>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit::Physics;
+
+namespace
+{
+constexpr int   STACK_COUNT = 64;
+constexpr int   STACK_SIZE  = 40;
+constexpr float BOX_SIZE    = 1.0f;
+constexpr float FRAME_DELTA = 1.0f / 60.0f;
+
+/**
+ * @brief Owns the shapes and the bodies added to the world, so they're removed before the world is destroyed.
+ */
+class BoxStacks
+{
+public:
+  BoxStacks(btDiscreteDynamicsWorld* world)
+  : mWorld(world),
+    mGroundShape(new btBoxShape(btVector3(STACK_COUNT * BOX_SIZE * 2.0f, BOX_SIZE, STACK_COUNT * BOX_SIZE * 2.0f))),
+    mBoxShape(new btBoxShape(btVector3(BOX_SIZE * 0.5f, BOX_SIZE * 0.5f, BOX_SIZE * 0.5f)))
+  {
+    AddBody(mGroundShape.get(), 0.0f, btVector3(0.0f, -BOX_SIZE, 0.0f));
+
+    // The stacks are laid out on a grid, and are kept awake so that every frame solves the same contacts.
+    const int columnCount = 8;
+    for(int stack = 0; stack < STACK_COUNT; ++stack)
+    {
+      const float x = (stack % columnCount - columnCount * 0.5f) * BOX_SIZE * 3.0f;
+      const float z = (stack / columnCount - columnCount * 0.5f) * BOX_SIZE * 3.0f;
+      for(int level = 0; level < STACK_SIZE; ++level)
+      {
+        auto body = AddBody(mBoxShape.get(), 1.0f, btVector3(x, (level + 0.5f) * BOX_SIZE, z));
+        body->setActivationState(DISABLE_DEACTIVATION);
+      }
+    }
+  }
+
+  ~BoxStacks()
+  {
+    for(auto& body : mBodies)
+    {
+      mWorld->removeRigidBody(body.get());
+      delete body->getMotionState();
+    }
+  }
+
+  uint32_t GetBodyCount() const
+  {
+    return static_cast<uint32_t>(mBodies.size());
+  }
+
+private:
+  btRigidBody* AddBody(btCollisionShape* shape, float mass, const btVector3& origin)
+  {
+    btVector3 localInertia(0.0f, 0.0f, 0.0f);
+    if(mass > 0.0f)
+    {
+      shape->calculateLocalInertia(mass, localInertia);
+    }
+    btTransform transform;
+    transform.setIdentity();
+    transform.setOrigin(origin);
+
+    btRigidBody::btRigidBodyConstructionInfo info(mass, new btDefaultMotionState(transform), shape, localInertia);
+    mBodies.emplace_back(new btRigidBody(info));
+    mWorld->addRigidBody(mBodies.back().get());
+    return mBodies.back().get();
+  }
+
+  btDiscreteDynamicsWorld*                  mWorld;
+  std::unique_ptr<btCollisionShape>         mGroundShape;
+  std::unique_ptr<btCollisionShape>         mBoxShape;
+  std::vector<std::unique_ptr<btRigidBody>> mBodies;
+};
+
+void BenchmarkStacks(Benchmark::State& state, PhysicsAdaptor::WorldThreading threading)
+{
+  ToolkitTestApplication application;
+
+  Matrix         transform(true);
+  Uint16Pair     size(640, 480);
+  PhysicsAdaptor adaptor = PhysicsAdaptor::New(transform, size, threading);
+
+  auto accessor = adaptor.GetPhysicsAccessor();
+  auto world    = accessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+  {
+    BoxStacks stacks(world);
+
+    // Let the stacks settle, so that the measured frames have resting contacts.
+    for(int i = 0; i < 60; ++i)
+    {
+      world->stepSimulation(FRAME_DELTA, 1, FRAME_DELTA);
+    }
+    state.SetItemsPerIteration(stacks.GetBodyCount());
+
+    while(state.KeepRunning())
+    {
+      world->stepSimulation(FRAME_DELTA, 1, FRAME_DELTA);
+    }
+    state.SetCounter("bodies", stacks.GetBodyCount());
+    state.SetCounter("manifolds", world->getDispatcher()->getNumManifolds());
+  }
+}
+
+} // namespace
+
+DALI_BENCHMARK(PhysicsWorldBoxStacks)
+{
+  BenchmarkStacks(state, PhysicsAdaptor::WorldThreading::SINGLE_THREADED);
+}
+
+DALI_BENCHMARK(PhysicsWorldBoxStacksMultiThreaded)
+{
+  BenchmarkStacks(state, PhysicsAdaptor::WorldThreading::MULTI_THREADED);
+}
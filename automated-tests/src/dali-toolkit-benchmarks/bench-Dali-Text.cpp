@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
+#include <dali-toolkit/internal/text/rendering/styles/blur-helper-functions.h>
+#include <dali-toolkit/internal/text/shaper.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <toolkit-text-utils.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Text;
+
+namespace
+{
+const char* const PARAGRAPH =
+  "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+  "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+  "Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.\n";
+
+const Size TEXT_AREA(360.0f, 100000.0f);
+
+void LoadFonts()
+{
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi(96u, 96u);
+  fontClient.GetFontId(TEST_RESOURCE_DIR "/fonts/tizen/TizenSansRegular.ttf");
+}
+
+std::string CreateText(uint32_t paragraphCount)
+{
+  std::string text;
+  for(uint32_t i = 0u; i < paragraphCount; ++i)
+  {
+    text += PARAGRAPH;
+  }
+  return text;
+}
+
+/**
+ * @brief Creates a rich text, where every few words change the color, the weight or the decorations.
+ */
+std::string CreateMarkup(uint32_t paragraphCount)
+{
+  const char* const COLORS[] = {"red", "green", "blue", "#FF8000", "#0080FFFF"};
+
+  Benchmark::Random random(3u);
+  std::string       markup;
+  for(uint32_t i = 0u; i < paragraphCount; ++i)
+  {
+    markup += "<p>";
+    for(uint32_t word = 0u; word < 12u; ++word)
+    {
+      switch(random.Next(0u, 5u))
+      {
+        case 0u:
+          markup += std::string("<color value='") + COLORS[random.Next(0u, 4u)] + "'>Lorem ipsum</color> ";
+          break;
+        case 1u:
+          markup += "<font weight='bold' size='" + std::to_string(random.Next(10u, 30u)) + "'>dolor sit</font> ";
+          break;
+        case 2u:
+          markup += "<u>amet &amp; consectetur</u> ";
+          break;
+        case 3u:
+          markup += "<span text-color='blue' font-slant='italic'>adipiscing &lt;elit&gt;</span> ";
+          break;
+        case 4u:
+          markup += "<background color='yellow'>sed do</background> <s>eiusmod</s> ";
+          break;
+        default:
+          markup += "tempor incididunt ";
+          break;
+      }
+    }
+    markup += "</p>\n";
+  }
+  return markup;
+}
+
+void CreateModel(const std::string& text, bool markup, ModelPtr& textModel)
+{
+  MetricsPtr                       metrics;
+  Size                             layoutSize;
+  const Vector<FontDescriptionRun> fontDescriptions;
+  const LayoutOptions              options;
+
+  CreateTextModel(text,
+                  TEXT_AREA,
+                  fontDescriptions,
+                  options,
+                  layoutSize,
+                  textModel,
+                  metrics,
+                  markup,
+                  LineWrap::WORD,
+                  false,
+                  Toolkit::DevelText::EllipsisPosition::END,
+                  0.0f, // lineSpacing
+                  0.0f  // characterSpacing
+  );
+}
+
+void BenchmarkCreateModel(Benchmark::State& state, const std::string& text, bool markup)
+{
+  ToolkitTestApplication application;
+  LoadFonts();
+
+  ModelPtr textModel;
+  CreateModel(text, markup, textModel);
+  state.SetItemsPerIteration(textModel->mLogicalModel->mText.Count());
+  state.SetCounter("characters", textModel->mLogicalModel->mText.Count());
+  state.SetCounter("lines", textModel->mVisualModel->mLines.Count());
+
+  while(state.KeepRunning())
+  {
+    ModelPtr model;
+    CreateModel(text, markup, model);
+    Benchmark::DoNotOptimize(model->mVisualModel->mGlyphs.Count());
+  }
+}
+
+void BenchmarkBoxBlur(Benchmark::State& state, float blurRadius)
+{
+  ToolkitTestApplication application;
+
+  // A text buffer is mostly transparent, with the glyphs in the middle rows.
+  constexpr uint32_t WIDTH  = 512u;
+  constexpr uint32_t HEIGHT = 128u;
+
+  std::vector<uint8_t> glyphs(WIDTH * HEIGHT * 4u, 0u);
+  Benchmark::Random    random(5u);
+  for(uint32_t y = HEIGHT / 4u; y < HEIGHT * 3u / 4u; ++y)
+  {
+    for(uint32_t x = 0u; x < WIDTH; ++x)
+    {
+      if(random.Next(0u, 2u) == 0u)
+      {
+        std::fill_n(glyphs.begin() + (y * WIDTH + x) * 4u, 4u, uint8_t(255u));
+      }
+    }
+  }
+  state.SetItemsPerIteration(WIDTH * HEIGHT);
+
+  std::vector<uint8_t> buffer(glyphs.size());
+  while(state.KeepRunning())
+  {
+    state.PauseTiming();
+    std::copy(glyphs.begin(), glyphs.end(), buffer.begin());
+    state.ResumeTiming();
+
+    ApplyBoxBlur(buffer.data(), WIDTH, HEIGHT, 4u, blurRadius);
+    Benchmark::DoNotOptimize(buffer[0]);
+  }
+}
+
+} // namespace
+
+DALI_BENCHMARK(TextCreateModelParagraphs)
+{
+  BenchmarkCreateModel(state, CreateText(20u), false);
+}
+
+DALI_BENCHMARK(TextCreateModelLargeMarkup)
+{
+  BenchmarkCreateModel(state, CreateMarkup(200u), true);
+}
+
+DALI_BENCHMARK(TextShapeText)
+{
+  ToolkitTestApplication application;
+  LoadFonts();
+
+  ModelPtr textModel;
+  CreateModel(CreateText(20u), false, textModel);
+
+  const LogicalModelPtr& logicalModel = textModel->mLogicalModel;
+  const Length           length       = logicalModel->mText.Count();
+  state.SetItemsPerIteration(length);
+
+  Vector<GlyphInfo>      glyphs;
+  Vector<CharacterIndex> glyphToCharacter;
+  Vector<Length>         charactersPerGlyph;
+  Vector<GlyphIndex>     newParagraphGlyphs;
+  while(state.KeepRunning())
+  {
+    glyphs.Clear();
+    glyphToCharacter.Clear();
+    charactersPerGlyph.Clear();
+    newParagraphGlyphs.Clear();
+
+    ShapeText(logicalModel->mText,
+              logicalModel->mLineBreakInfo,
+              logicalModel->mScriptRuns,
+              logicalModel->mFontRuns,
+              0u,
+              0u,
+              length,
+              glyphs,
+              glyphToCharacter,
+              charactersPerGlyph,
+              newParagraphGlyphs);
+  }
+  state.SetCounter("glyphs", glyphs.Count());
+}
+
+DALI_BENCHMARK(TextBoxBlurRadius4)
+{
+  BenchmarkBoxBlur(state, 4.0f);
+}
+
+DALI_BENCHMARK(TextBoxBlurRadius16)
+{
+  BenchmarkBoxBlur(state, 16.0f);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <toolkit-environment-variable.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+constexpr uint32_t LABEL_COUNT = 50u;
+
+/**
+ * @brief Shows a page of labels with the same text and style, as the buttons of a list.
+ */
+void BenchmarkIdenticalLabels(Benchmark::State& state, bool sharedTexture)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_TEXT_TEXTURE_CACHE", sharedTexture ? "1" : "0");
+
+  ToolkitTestApplication application;
+  state.SetItemsPerIteration(LABEL_COUNT);
+
+  Actor page = Actor::New();
+  application.GetScene().Add(page);
+
+  while(state.KeepRunning())
+  {
+    for(uint32_t i = 0u; i < LABEL_COUNT; ++i)
+    {
+      TextLabel label = TextLabel::New("Add to cart");
+      label.SetProperty(Actor::Property::SIZE, Vector2(160.0f, 48.0f));
+      label.SetProperty(Actor::Property::POSITION, Vector2(0.0f, 48.0f * i));
+      label.SetProperty(TextLabel::Property::TEXT_COLOR, Color::BLUE);
+      page.Add(label);
+    }
+
+    application.SendNotification();
+    application.Render();
+
+    state.PauseTiming();
+    while(page.GetChildCount() > 0u)
+    {
+      page.Remove(page.GetChildAt(0u));
+    }
+    application.SendNotification();
+    application.Render();
+    state.ResumeTiming();
+  }
+}
+
+} // namespace
+
+DALI_BENCHMARK(TextLabelIdenticalLabels)
+{
+  BenchmarkIdenticalLabels(state, false);
+}
+
+DALI_BENCHMARK(TextLabelIdenticalLabelsSharedTexture)
+{
+  BenchmarkIdenticalLabels(state, true);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/texture-manager/texture-cache-manager.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+constexpr uint32_t CACHED_TEXTURE_COUNT = 10000u;
+
+struct CachedTexture
+{
+  VisualUrl                        url;
+  ImageDimensions                  size;
+  TextureCacheManager::TextureHash hash;
+};
+
+/**
+ * @brief Fills the cache as TextureManager::RequestLoad() does, with a mix of sized and unsized images.
+ */
+std::vector<CachedTexture> FillCache(TextureCacheManager& cache)
+{
+  Benchmark::Random random(11u);
+
+  std::vector<CachedTexture> textures;
+  textures.reserve(CACHED_TEXTURE_COUNT);
+  for(uint32_t i = 0u; i < CACHED_TEXTURE_COUNT; ++i)
+  {
+    VisualUrl       url(std::string("/opt/usr/apps/benchmark/res/images/thumbnail-") + std::to_string(i) + ".jpg");
+    ImageDimensions size = (i % 2u) ? ImageDimensions(random.Next(32u, 512u), random.Next(32u, 512u)) : ImageDimensions();
+
+    auto hash = cache.GenerateHash(url, size, FittingMode::DEFAULT, SamplingMode::DEFAULT, TextureManagerType::INVALID_TEXTURE_ID, false, 0u);
+    auto id   = cache.GenerateTextureId();
+    cache.AppendCache(TextureCacheManager::TextureInfo(id, TextureManagerType::INVALID_TEXTURE_ID, url, size, 1.0f, FittingMode::DEFAULT, SamplingMode::DEFAULT, false, false, hash, true, false, Dali::AnimatedImageLoading(), 0u, false));
+
+    textures.push_back({url, size, hash});
+  }
+  return textures;
+}
+
+} // namespace
+
+DALI_BENCHMARK(TextureCacheManagerFindCachedTexture)
+{
+  ToolkitTestApplication application;
+
+  TextureCacheManager        cache;
+  std::vector<CachedTexture> textures = FillCache(cache);
+  state.SetItemsPerIteration(textures.size());
+
+  uint32_t foundCount = 0u;
+  while(state.KeepRunning())
+  {
+    foundCount = 0u;
+    for(const auto& texture : textures)
+    {
+      auto cacheIndex = cache.FindCachedTexture(texture.hash, texture.url, texture.size, FittingMode::DEFAULT, SamplingMode::DEFAULT, TextureCacheManager::StorageType::UPLOAD_TO_TEXTURE, TextureManagerType::INVALID_TEXTURE_ID, false, TextureCacheManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY, false, 0u);
+      if(cacheIndex != TextureManagerType::INVALID_CACHE_INDEX)
+      {
+        ++foundCount;
+      }
+    }
+  }
+  state.SetCounter("foundTextures", foundCount);
+}
+
+DALI_BENCHMARK(TextureCacheManagerGenerateHashAndFindMiss)
+{
+  ToolkitTestApplication application;
+
+  // A new image is hashed, then looked up in a full cache before it's loaded.
+  TextureCacheManager cache;
+  FillCache(cache);
+
+  std::vector<VisualUrl> urls;
+  for(uint32_t i = 0u; i < 1000u; ++i)
+  {
+    urls.emplace_back(std::string("/opt/usr/apps/benchmark/res/images/new-") + std::to_string(i) + ".png");
+  }
+  state.SetItemsPerIteration(urls.size());
+
+  while(state.KeepRunning())
+  {
+    for(const auto& url : urls)
+    {
+      auto hash       = cache.GenerateHash(url, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, TextureManagerType::INVALID_TEXTURE_ID, false, 0u);
+      auto cacheIndex = cache.FindCachedTexture(hash, url, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, TextureCacheManager::StorageType::UPLOAD_TO_TEXTURE, TextureManagerType::INVALID_TEXTURE_ID, false, TextureCacheManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY, false, 0u);
+      Benchmark::DoNotOptimize(cacheIndex);
+    }
+  }
+}
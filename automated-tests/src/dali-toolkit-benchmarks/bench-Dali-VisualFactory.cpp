@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark-harness.h>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+constexpr uint32_t VISUAL_COUNT = 10000u;
+
+/**
+ * @brief The thumbnail of a list item.
+ */
+Property::Map CreateImageMap()
+{
+  Property::Map map;
+  map[Visual::Property::TYPE]                = Visual::IMAGE;
+  map[ImageVisual::Property::URL]            = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+  map[ImageVisual::Property::DESIRED_WIDTH]  = 128;
+  map[ImageVisual::Property::DESIRED_HEIGHT] = 128;
+  map[ImageVisual::Property::FITTING_MODE]   = FittingMode::SCALE_TO_FILL;
+  map[ImageVisual::Property::SAMPLING_MODE]  = SamplingMode::BOX_THEN_LINEAR;
+  map[DevelVisual::Property::CORNER_RADIUS]  = Vector4(8.0f, 8.0f, 8.0f, 8.0f);
+  map[Visual::Property::MIX_COLOR]           = Color::WHITE;
+  map[Visual::Property::OPACITY]             = 1.0f;
+  map[Visual::Property::PREMULTIPLIED_ALPHA] = true;
+  map[ImageVisual::Property::RELEASE_POLICY] = ImageVisual::ReleasePolicy::DETACHED;
+  return map;
+}
+
+/**
+ * @brief The background of a list item.
+ */
+Property::Map CreateColorMap()
+{
+  Property::Map map;
+  map[Visual::Property::TYPE]                  = Visual::COLOR;
+  map[ColorVisual::Property::MIX_COLOR]        = Color::BLUE;
+  map[DevelVisual::Property::CORNER_RADIUS]    = 12.0f;
+  map[DevelVisual::Property::BORDERLINE_WIDTH] = 2.0f;
+  map[DevelVisual::Property::BORDERLINE_COLOR] = Color::BLACK;
+  return map;
+}
+
+void BenchmarkCreateVisuals(Benchmark::State& state, const Property::Map& map, bool useDescriptor)
+{
+  ToolkitTestApplication application;
+
+  VisualFactory    factory    = VisualFactory::Get();
+  VisualDescriptor descriptor = VisualDescriptor::New(map);
+  state.SetItemsPerIteration(VISUAL_COUNT);
+
+  std::vector<Visual::Base> visuals(VISUAL_COUNT);
+  while(state.KeepRunning())
+  {
+    for(auto& visual : visuals)
+    {
+      visual = useDescriptor ? factory.CreateVisual(descriptor) : factory.CreateVisual(map);
+    }
+
+    state.PauseTiming();
+    std::fill(visuals.begin(), visuals.end(), Visual::Base());
+    state.ResumeTiming();
+  }
+}
+
+} // namespace
+
+DALI_BENCHMARK(VisualFactoryCreateImageVisualsFromMap)
+{
+  BenchmarkCreateVisuals(state, CreateImageMap(), false);
+}
+
+DALI_BENCHMARK(VisualFactoryCreateImageVisualsFromDescriptor)
+{
+  BenchmarkCreateVisuals(state, CreateImageMap(), true);
+}
+
+DALI_BENCHMARK(VisualFactoryCreateColorVisualsFromMap)
+{
+  BenchmarkCreateVisuals(state, CreateColorMap(), false);
+}
+
+DALI_BENCHMARK(VisualFactoryCreateColorVisualsFromDescriptor)
+{
+  BenchmarkCreateVisuals(state, CreateColorMap(), true);
+}
@@ -0,0 +1,553 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark-harness.h"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+namespace Benchmark
+{
+namespace
+{
+constexpr uint32_t DEFAULT_REPETITIONS        = 5u;
+constexpr uint32_t DEFAULT_MINIMUM_TIME_MS    = 100u;
+constexpr uint64_t MAXIMUM_ITERATIONS         = 1000000000u;
+constexpr double   MAXIMUM_CALIBRATION_GROWTH = 10.0;
+
+struct BenchmarkEntry
+{
+  const char*       name;
+  BenchmarkFunction function;
+};
+
+std::vector<BenchmarkEntry>& GetBenchmarks()
+{
+  static std::vector<BenchmarkEntry> benchmarks;
+  return benchmarks;
+}
+
+std::string EscapeJson(const std::string& text)
+{
+  std::string escaped;
+  escaped.reserve(text.size());
+  for(char character : text)
+  {
+    switch(character)
+    {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if(static_cast<unsigned char>(character) < 0x20)
+        {
+          char code[8];
+          snprintf(code, sizeof(code), "\\u%04x", character);
+          escaped += code;
+        }
+        else
+        {
+          escaped += character;
+        }
+        break;
+    }
+  }
+  return escaped;
+}
+
+std::string FormatNumber(double value)
+{
+  if(!std::isfinite(value))
+  {
+    return "null";
+  }
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.6g", value);
+  return buffer;
+}
+
+std::string FormatNanoseconds(double value)
+{
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.1f", value);
+  return buffer;
+}
+
+/**
+ * @brief Converts the result of a benchmark to a JSON object, and prints its summary.
+ */
+std::string CreateResult(const char* name, const State& state)
+{
+  std::string result = std::string("    {\n      \"name\": \"") + EscapeJson(name) + "\",\n";
+
+  if(!state.GetError().empty())
+  {
+    printf("%-56s SKIPPED: %s\n", name, state.GetError().c_str());
+    result += "      \"skipped\": \"" + EscapeJson(state.GetError()) + "\"\n    }";
+    return result;
+  }
+
+  if(state.GetNanosecondsPerIteration().empty())
+  {
+    printf("%-56s FAILED: The loop did not run\n", name);
+    result += "      \"error\": \"The loop did not run\"\n    }";
+    return result;
+  }
+
+  std::vector<double> times = state.GetNanosecondsPerIteration();
+  std::sort(times.begin(), times.end());
+
+  const double minimum = times.front();
+  const double median  = (times.size() % 2u) ? times[times.size() / 2u] : (times[times.size() / 2u - 1u] + times[times.size() / 2u]) * 0.5;
+
+  double sum = 0.0;
+  for(double time : times)
+  {
+    sum += time;
+  }
+  const double mean = sum / times.size();
+
+  double variance = 0.0;
+  for(double time : times)
+  {
+    variance += (time - mean) * (time - mean);
+  }
+  const double deviation = (times.size() > 1u) ? std::sqrt(variance / (times.size() - 1u)) : 0.0;
+
+  result += "      \"iterations\": " + std::to_string(state.GetIterations()) + ",\n";
+  result += "      \"repetitions\": " + std::to_string(times.size()) + ",\n";
+  result += "      \"minNs\": " + FormatNanoseconds(minimum) + ",\n";
+  result += "      \"medianNs\": " + FormatNanoseconds(median) + ",\n";
+  result += "      \"meanNs\": " + FormatNanoseconds(mean) + ",\n";
+  result += "      \"stddevNs\": " + FormatNanoseconds(deviation);
+
+  if(state.GetItemsPerIteration() > 0u && median > 0.0)
+  {
+    result += ",\n      \"itemsPerSecond\": " + FormatNumber(state.GetItemsPerIteration() * 1e9 / median);
+  }
+
+  if(!state.GetCounters().empty())
+  {
+    result += ",\n      \"counters\": {";
+    bool first = true;
+    for(const auto& counter : state.GetCounters())
+    {
+      result += std::string(first ? "" : ",") + "\n        \"" + EscapeJson(counter.first) + "\": " + FormatNumber(counter.second);
+      first = false;
+    }
+    result += "\n      }";
+  }
+  result += "\n    }";
+
+  printf("%-56s %14.1f ns %12llu iterations %6.1f%%\n", name, median, static_cast<unsigned long long>(state.GetIterations()), (median > 0.0) ? deviation * 100.0 / median : 0.0);
+  fflush(stdout);
+
+  return result;
+}
+
+std::string RunBenchmark(const BenchmarkEntry& entry, uint32_t repetitions, std::chrono::nanoseconds minimumTime)
+{
+  State state(repetitions, minimumTime);
+  entry.function(state);
+  return CreateResult(entry.name, state);
+}
+
+/**
+ * @brief Runs a benchmark in a child process, so that every benchmark starts from a fresh application.
+ */
+std::string RunBenchmarkInChildProcess(const BenchmarkEntry& entry, uint32_t repetitions, std::chrono::nanoseconds minimumTime)
+{
+  int pipeDescriptors[2];
+  if(pipe(pipeDescriptors) == -1)
+  {
+    perror("pipe");
+    exit(EXIT_STATUS_FAILED);
+  }
+
+  fflush(stdout);
+  pid_t pid = fork();
+  if(pid == 0) // Child process
+  {
+    close(pipeDescriptors[0]);
+
+    const std::string result  = RunBenchmark(entry, repetitions, minimumTime);
+    const char*       data    = result.c_str();
+    size_t            written = 0u;
+    while(written < result.size())
+    {
+      ssize_t count = write(pipeDescriptors[1], data + written, result.size() - written);
+      if(count <= 0)
+      {
+        break;
+      }
+      written += count;
+    }
+    close(pipeDescriptors[1]);
+    fflush(stdout);
+    _exit(EXIT_STATUS_SUCCEEDED);
+  }
+  else if(pid == -1)
+  {
+    perror("fork");
+    exit(EXIT_STATUS_FAILED);
+  }
+
+  // Parent process
+  close(pipeDescriptors[1]);
+
+  std::string result;
+  char        buffer[4096];
+  ssize_t     count;
+  while((count = read(pipeDescriptors[0], buffer, sizeof(buffer))) > 0)
+  {
+    result.append(buffer, count);
+  }
+  close(pipeDescriptors[0]);
+
+  int status = 0;
+  if(waitpid(pid, &status, 0) == -1)
+  {
+    perror("waitpid");
+    exit(EXIT_STATUS_FAILED);
+  }
+
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_STATUS_SUCCEEDED || result.empty())
+  {
+    const std::string error = WIFSIGNALED(status) ? std::string("The benchmark was killed by signal ") + std::to_string(WTERMSIG(status)) : std::string("The benchmark failed");
+    printf("%-56s FAILED: %s\n", entry.name, error.c_str());
+    result = std::string("    {\n      \"name\": \"") + EscapeJson(entry.name) + "\",\n      \"error\": \"" + EscapeJson(error) + "\"\n    }";
+  }
+  return result;
+}
+
+std::string GetContext(uint32_t repetitions, uint32_t minimumTimeMs)
+{
+  char hostName[256] = {0};
+  gethostname(hostName, sizeof(hostName) - 1u);
+
+  char        date[32] = {0};
+  std::time_t now      = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+  std::string context = "  \"context\": {\n";
+  context += std::string("    \"date\": \"") + date + "\",\n";
+  context += std::string("    \"host\": \"") + EscapeJson(hostName) + "\",\n";
+  context += std::string("    \"compiler\": \"") + EscapeJson(__VERSION__) + "\",\n";
+#if defined(NDEBUG)
+  context += "    \"buildType\": \"release\",\n";
+#else
+  context += "    \"buildType\": \"debug\",\n";
+#endif
+  context += "    \"repetitions\": " + std::to_string(repetitions) + ",\n";
+  context += "    \"minimumTimeMs\": " + std::to_string(minimumTimeMs) + "\n";
+  context += "  }";
+  return context;
+}
+
+void Usage(const char* program)
+{
+  printf(
+    "Usage: \n"
+    "   %s\t\t Run all the benchmarks\n"
+    "   %s -f <filter>\t Run the benchmarks whose name contains the filter\n"
+    "   %s -o <file>\t Write the results to a JSON file\n"
+    "   %s -r <count>\t Set the number of the measured repetitions (default %u)\n"
+    "   %s -t <ms>\t\t Set the minimum time of a repetition in milliseconds (default %u)\n"
+    "   %s -l\t\t List the benchmarks\n"
+    "   %s -s\t\t Run the benchmarks in this process\n",
+    program,
+    program,
+    program,
+    program,
+    DEFAULT_REPETITIONS,
+    program,
+    DEFAULT_MINIMUM_TIME_MS,
+    program,
+    program);
+}
+
+} // namespace
+
+State::State(uint32_t repetitions, std::chrono::nanoseconds minimumTime)
+: mRepetitions(std::max(repetitions, 1u)),
+  mMinimumTime(minimumTime),
+  mStartTime(),
+  mPauseTime(),
+  mPausedTime(0),
+  mRemaining(0u),
+  mIterations(1u),
+  mNanosecondsPerIteration(),
+  mItemsPerIteration(0u),
+  mCounters(),
+  mError(),
+  mStarted(false),
+  mCalibrating(true),
+  mPaused(false),
+  mFinished(false)
+{
+}
+
+void State::PauseTiming()
+{
+  if(!mPaused)
+  {
+    mPauseTime = Clock::now();
+    mPaused    = true;
+  }
+}
+
+void State::ResumeTiming()
+{
+  if(mPaused)
+  {
+    mPausedTime += Clock::now() - mPauseTime;
+    mPaused = false;
+  }
+}
+
+void State::SetItemsPerIteration(uint64_t items)
+{
+  mItemsPerIteration = items;
+}
+
+void State::SetCounter(const std::string& name, double value)
+{
+  auto iter = std::find_if(mCounters.begin(), mCounters.end(), [&name](const std::pair<std::string, double>& counter) { return counter.first == name; });
+  if(iter != mCounters.end())
+  {
+    iter->second = value;
+  }
+  else
+  {
+    mCounters.emplace_back(name, value);
+  }
+}
+
+void State::SkipWithError(const std::string& message)
+{
+  mError     = message;
+  mRemaining = 0u;
+}
+
+uint64_t State::GetIterations() const
+{
+  return mIterations;
+}
+
+const std::vector<double>& State::GetNanosecondsPerIteration() const
+{
+  return mNanosecondsPerIteration;
+}
+
+uint64_t State::GetItemsPerIteration() const
+{
+  return mItemsPerIteration;
+}
+
+const std::vector<std::pair<std::string, double>>& State::GetCounters() const
+{
+  return mCounters;
+}
+
+const std::string& State::GetError() const
+{
+  return mError;
+}
+
+bool State::NextBatch()
+{
+  const Clock::time_point now = Clock::now();
+
+  if(mFinished || !mError.empty())
+  {
+    mFinished = true;
+    return false;
+  }
+
+  if(!mStarted)
+  {
+    mStarted = true;
+    StartBatch(mIterations);
+    --mRemaining;
+    return true;
+  }
+
+  ResumeTiming();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - mStartTime - mPausedTime);
+
+  if(mCalibrating)
+  {
+    if(elapsed < mMinimumTime && mIterations < MAXIMUM_ITERATIONS)
+    {
+      // Grow the batch towards the minimum time, with a margin so that it's likely to be reached next time.
+      double growth = MAXIMUM_CALIBRATION_GROWTH;
+      if(elapsed.count() > 0)
+      {
+        growth = std::min(MAXIMUM_CALIBRATION_GROWTH, std::max(2.0, 1.4 * mMinimumTime.count() / elapsed.count()));
+      }
+      mIterations = std::min(MAXIMUM_ITERATIONS, static_cast<uint64_t>(std::ceil(mIterations * growth)));
+    }
+    else
+    {
+      // The calibrating batches warm up the caches; they are not recorded.
+      mCalibrating = false;
+    }
+  }
+  else
+  {
+    mNanosecondsPerIteration.push_back(static_cast<double>(elapsed.count()) / mIterations);
+    if(mNanosecondsPerIteration.size() >= mRepetitions)
+    {
+      mFinished = true;
+      return false;
+    }
+  }
+
+  StartBatch(mIterations);
+  --mRemaining;
+  return true;
+}
+
+void State::StartBatch(uint64_t iterations)
+{
+  mRemaining  = iterations;
+  mPausedTime = std::chrono::nanoseconds(0);
+  mStartTime  = Clock::now();
+}
+
+Registrar::Registrar(const char* name, BenchmarkFunction function)
+{
+  GetBenchmarks().push_back({name, function});
+}
+
+int RunBenchmarks(int argc, char* const argv[])
+{
+  const char* optString = "f:o:r:t:ls";
+  std::string optFilter;
+  std::string optOutput;
+  uint32_t    optRepetitions(DEFAULT_REPETITIONS);
+  uint32_t    optMinimumTimeMs(DEFAULT_MINIMUM_TIME_MS);
+  bool        optList(false);
+  bool        optRunInProcess(false);
+
+  int nextOpt = 0;
+  do
+  {
+    nextOpt = getopt(argc, argv, optString);
+    switch(nextOpt)
+    {
+      case 'f':
+        optFilter = optarg;
+        break;
+      case 'o':
+        optOutput = optarg;
+        break;
+      case 'r':
+        optRepetitions = static_cast<uint32_t>(std::max(1, atoi(optarg)));
+        break;
+      case 't':
+        optMinimumTimeMs = static_cast<uint32_t>(std::max(1, atoi(optarg)));
+        break;
+      case 'l':
+        optList = true;
+        break;
+      case 's':
+        optRunInProcess = true;
+        break;
+      case '?':
+        Usage(argv[0]);
+        exit(EXIT_STATUS_BAD_ARGUMENT);
+        break;
+    }
+  } while(nextOpt != -1);
+
+  std::vector<BenchmarkEntry> selected;
+  for(const auto& entry : GetBenchmarks())
+  {
+    if(optFilter.empty() || strstr(entry.name, optFilter.c_str()) != nullptr)
+    {
+      selected.push_back(entry);
+    }
+  }
+  std::sort(selected.begin(), selected.end(), [](const BenchmarkEntry& lhs, const BenchmarkEntry& rhs) { return strcmp(lhs.name, rhs.name) < 0; });
+
+  if(optList)
+  {
+    for(const auto& entry : selected)
+    {
+      printf("%s\n", entry.name);
+    }
+    return EXIT_STATUS_SUCCEEDED;
+  }
+
+  if(selected.empty())
+  {
+    printf("No benchmark matches \"%s\"\n", optFilter.c_str());
+    return EXIT_STATUS_NOT_FOUND;
+  }
+
+  const std::chrono::nanoseconds minimumTime = std::chrono::milliseconds(optMinimumTimeMs);
+
+  int         status = EXIT_STATUS_SUCCEEDED;
+  std::string results;
+  for(const auto& entry : selected)
+  {
+    std::string result = optRunInProcess ? RunBenchmark(entry, optRepetitions, minimumTime) : RunBenchmarkInChildProcess(entry, optRepetitions, minimumTime);
+    if(result.find("\"error\": ") != std::string::npos)
+    {
+      status = EXIT_STATUS_FAILED;
+    }
+    results += (results.empty() ? "" : ",\n") + result;
+  }
+
+  if(!optOutput.empty())
+  {
+    std::ofstream output(optOutput);
+    output << "{\n"
+           << GetContext(optRepetitions, optMinimumTimeMs) << ",\n"
+           << "  \"benchmarks\": [\n"
+           << results << "\n"
+           << "  ]\n"
+           << "}\n";
+    if(!output.good())
+    {
+      printf("Failed to write %s\n", optOutput.c_str());
+      return EXIT_STATUS_OUTPUT_FAILED;
+    }
+  }
+
+  return status;
+}
+
+} // namespace Benchmark
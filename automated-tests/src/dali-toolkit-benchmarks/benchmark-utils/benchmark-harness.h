@@ -0,0 +1,255 @@
+#ifndef DALI_TOOLKIT_BENCHMARK_HARNESS_H
+#define DALI_TOOLKIT_BENCHMARK_HARNESS_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Benchmark
+{
+enum ExitStatus
+{
+  EXIT_STATUS_SUCCEEDED,     // 0
+  EXIT_STATUS_FAILED,        // 1
+  EXIT_STATUS_BAD_ARGUMENT,  // 2
+  EXIT_STATUS_OUTPUT_FAILED, // 3
+  EXIT_STATUS_NOT_FOUND      // 4
+};
+
+/**
+ * @brief Measures the loop of a benchmark.
+ *
+ * The benchmark sets up its fixture, then runs the measured code while KeepRunning() returns true:
+ * @code
+ * DALI_BENCHMARK(JsonParserParse)
+ * {
+ *   std::string source = CreateSource();
+ *   while(state.KeepRunning())
+ *   {
+ *     JsonParser parser = JsonParser::New();
+ *     parser.Parse(source);
+ *   }
+ * }
+ * @endcode
+ *
+ * The number of iterations is first doubled until a batch of iterations takes the minimum time,
+ * then the batch is repeated and each repetition is recorded. Only the time spent in the loop is
+ * measured, so the fixture is not part of the result.
+ */
+class State
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] repetitions The number of the measured batches
+   * @param[in] minimumTime The minimum time of a batch
+   */
+  State(uint32_t repetitions, std::chrono::nanoseconds minimumTime);
+
+  /**
+   * @brief Checks whether the measured code should run once more.
+   * @return True if the loop should continue
+   */
+  bool KeepRunning()
+  {
+    if(__builtin_expect(mRemaining != 0u, 1))
+    {
+      --mRemaining;
+      return true;
+    }
+    return NextBatch();
+  }
+
+  /**
+   * @brief Stops the clock, e.g. to rebuild the fixture inside the loop.
+   */
+  void PauseTiming();
+
+  /**
+   * @brief Restarts the clock stopped by PauseTiming().
+   */
+  void ResumeTiming();
+
+  /**
+   * @brief Sets the number of items processed by one iteration, e.g. the particles updated by a frame.
+   *
+   * The items per second are then added to the result.
+   * @param[in] items The number of items per iteration
+   */
+  void SetItemsPerIteration(uint64_t items);
+
+  /**
+   * @brief Adds a value to the result, e.g. the size of the fixture or a sanity check.
+   * @param[in] name The name of the counter
+   * @param[in] value The value of the counter
+   */
+  void SetCounter(const std::string& name, double value);
+
+  /**
+   * @brief Records that the benchmark could not run, e.g. as its fixture failed to load.
+   * @param[in] message The reason
+   */
+  void SkipWithError(const std::string& message);
+
+public: // Used by the harness
+  /**
+   * @return The number of the iterations of a repetition
+   */
+  uint64_t GetIterations() const;
+
+  /**
+   * @return The time of an iteration in each repetition
+   */
+  const std::vector<double>& GetNanosecondsPerIteration() const;
+
+  /**
+   * @return The number of the items processed by an iteration, or zero
+   */
+  uint64_t GetItemsPerIteration() const;
+
+  /**
+   * @return The counters set by the benchmark
+   */
+  const std::vector<std::pair<std::string, double>>& GetCounters() const;
+
+  /**
+   * @return The error set by SkipWithError(), or an empty string
+   */
+  const std::string& GetError() const;
+
+private:
+  /**
+   * @brief Records the batch which has just finished, and starts the next one.
+   * @return True if another batch should run
+   */
+  bool NextBatch();
+
+  /**
+   * @brief Starts the clock for a batch.
+   * @param[in] iterations The number of the iterations of the batch
+   */
+  void StartBatch(uint64_t iterations);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  const uint32_t                              mRepetitions;
+  const std::chrono::nanoseconds              mMinimumTime;
+  Clock::time_point                           mStartTime;
+  Clock::time_point                           mPauseTime;
+  std::chrono::nanoseconds                    mPausedTime;
+  uint64_t                                    mRemaining;
+  uint64_t                                    mIterations;
+  std::vector<double>                         mNanosecondsPerIteration;
+  uint64_t                                    mItemsPerIteration;
+  std::vector<std::pair<std::string, double>> mCounters;
+  std::string                                 mError;
+  bool                                        mStarted;
+  bool                                        mCalibrating;
+  bool                                        mPaused;
+  bool                                        mFinished;
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+/**
+ * @brief Adds a benchmark to the list run by RunBenchmarks(). Used by DALI_BENCHMARK.
+ */
+struct Registrar
+{
+  Registrar(const char* name, BenchmarkFunction function);
+};
+
+/**
+ * @brief Creates the random numbers of the fixtures.
+ *
+ * The sequence of std::mt19937 is defined by the standard, unlike the one of the distributions,
+ * so the fixtures are the same on every platform and every run.
+ */
+class Random
+{
+public:
+  explicit Random(uint32_t seed = 5489u)
+  : mEngine(seed)
+  {
+  }
+
+  /**
+   * @return A number in [minimum, maximum]
+   */
+  uint32_t Next(uint32_t minimum, uint32_t maximum)
+  {
+    return minimum + static_cast<uint32_t>(mEngine() % (uint64_t(maximum) - minimum + 1u));
+  }
+
+  /**
+   * @return A number in [minimum, maximum)
+   */
+  float NextFloat(float minimum, float maximum)
+  {
+    return minimum + (maximum - minimum) * (static_cast<float>(mEngine() >> 8) / static_cast<float>(1u << 24));
+  }
+
+private:
+  std::mt19937 mEngine;
+};
+
+/**
+ * @brief Prevents the compiler from optimizing away a value computed by the measured code.
+ */
+template<typename T>
+inline void DoNotOptimize(T const& value)
+{
+  asm volatile(""
+               :
+               : "r,m"(value)
+               : "memory");
+}
+
+/**
+ * @brief Runs the benchmarks selected by the command line.
+ *
+ * Options:
+ * - -f <filter> : Runs the benchmarks whose name contains the filter.
+ * - -o <file>   : Writes the results to a JSON file.
+ * - -r <count>  : The number of the measured repetitions. The default is 5.
+ * - -t <ms>     : The minimum time of a repetition in milliseconds. The default is 100.
+ * - -l          : Lists the benchmarks.
+ * - -s          : Runs the benchmarks in this process rather than forking a process per benchmark.
+ *
+ * @param[in] argc The number of the arguments
+ * @param[in] argv The arguments
+ * @return The exit status
+ */
+int RunBenchmarks(int argc, char* const argv[]);
+
+} // namespace Benchmark
+
+/**
+ * @brief Defines and registers a benchmark. The body receives a Benchmark::State named state.
+ */
+#define DALI_BENCHMARK(name)                                                       \
+  static void                 Benchmark##name(Benchmark::State& state);           \
+  static Benchmark::Registrar gBenchmarkRegistrar##name(#name, &Benchmark##name); \
+  static void                 Benchmark##name(Benchmark::State& state)
+
+#endif // DALI_TOOLKIT_BENCHMARK_HARNESS_H
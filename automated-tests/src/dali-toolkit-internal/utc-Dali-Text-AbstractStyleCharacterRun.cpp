@@ -25,6 +25,7 @@
 #include <dali-toolkit/internal/text/color-run.h>
 #include <dali-toolkit/internal/text/font-description-run.h>
 #include <dali-toolkit/internal/text/strikethrough-character-run.h>
+#include <dali-toolkit/internal/text/text-run-container.h>
 #include <dali-toolkit/internal/text/underlined-character-run.h>
 
 using namespace Dali;
@@ -139,3 +140,96 @@ int UtcDaliTextAbstractStyleCharacterRun(void)
 
   END_TEST;
 }
+
+int UtcDaliTextUpdateCharacterRunsRemoveCharacters(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextUpdateCharacterRunsRemoveCharacters");
+
+  // Runs [0,4), [4,6), [6,6) and [6,10) of a text of ten characters.
+  Vector<ColorRun> runs;
+  runs.Resize(4u);
+  runs[0u].characterRun = CharacterRun(0u, 4u);
+  runs[1u].characterRun = CharacterRun(4u, 2u);
+  runs[2u].characterRun = CharacterRun(6u, 0u);
+  runs[3u].characterRun = CharacterRun(6u, 4u);
+  runs[0u].color        = Color::RED;
+  runs[3u].color        = Color::BLUE;
+
+  tet_infoline(" Remove the characters [3,7)");
+  Vector<ColorRun> removedRuns;
+  UpdateCharacterRuns<ColorRun>(3u, -4, 10u, runs, removedRuns);
+
+  // The second run is removed along with the run without characters. The order of the other runs is kept.
+  DALI_TEST_EQUALS(runs.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(removedRuns.Count(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(removedRuns[0u].characterRun.characterIndex, 4u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(runs[0u].color, Color::RED, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[0u].characterRun.characterIndex, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[0u].characterRun.numberOfCharacters, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].color, Color::BLUE, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.characterIndex, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.numberOfCharacters, 3u, TEST_LOCATION);
+
+  tet_infoline(" Remove a character within a run");
+  removedRuns.Clear();
+  UpdateCharacterRuns<ColorRun>(4u, -1, 6u, runs, removedRuns);
+
+  DALI_TEST_EQUALS(runs.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(removedRuns.Count(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.characterIndex, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.numberOfCharacters, 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextUpdateCharacterRunsInsertCharacters(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextUpdateCharacterRunsInsertCharacters");
+
+  // Runs [0,4), [4,6), [6,6) and [6,10) of a text of ten characters.
+  Vector<ColorRun> runs;
+  runs.Resize(4u);
+  runs[0u].characterRun = CharacterRun(0u, 4u);
+  runs[1u].characterRun = CharacterRun(4u, 2u);
+  runs[2u].characterRun = CharacterRun(6u, 0u);
+  runs[3u].characterRun = CharacterRun(6u, 4u);
+
+  tet_infoline(" Insert two characters at the end of the first run");
+  Vector<ColorRun> removedRuns;
+  UpdateCharacterRuns<ColorRun>(4u, 2, 10u, runs, removedRuns);
+
+  // The run the characters follow is extended, the next ones are moved. The run without characters is left as it is.
+  DALI_TEST_EQUALS(runs.Count(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(removedRuns.Count(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[0u].characterRun.characterIndex, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[0u].characterRun.numberOfCharacters, 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.characterIndex, 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.numberOfCharacters, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[2u].characterRun.characterIndex, 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[2u].characterRun.numberOfCharacters, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[3u].characterRun.characterIndex, 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[3u].characterRun.numberOfCharacters, 4u, TEST_LOCATION);
+
+  tet_infoline(" Insert a character at the beginning of the text");
+  InsertCharacterRuns<ColorRun>(0u, 1u, runs);
+
+  DALI_TEST_EQUALS(runs[0u].characterRun.characterIndex, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[0u].characterRun.numberOfCharacters, 7u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.characterIndex, 7u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[3u].characterRun.characterIndex, 9u, TEST_LOCATION);
+
+  tet_infoline(" Insert three characters at the end of the text");
+  InsertCharacterRuns<ColorRun>(13u, 3u, runs);
+
+  // Only the last run is extended. The runs before the inserted characters don't change.
+  DALI_TEST_EQUALS(runs[0u].characterRun.numberOfCharacters, 7u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.characterIndex, 7u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[1u].characterRun.numberOfCharacters, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[3u].characterRun.characterIndex, 9u, TEST_LOCATION);
+  DALI_TEST_EQUALS(runs[3u].characterRun.numberOfCharacters, 7u, TEST_LOCATION);
+
+  END_TEST;
+}
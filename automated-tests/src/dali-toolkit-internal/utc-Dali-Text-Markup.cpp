@@ -470,3 +470,84 @@ int UtcDaliTextXHTMLEntityToUTF8(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextXHTMLNamedEntityCaseSensitive(void)
+{
+  tet_infoline(" UtcDaliTextXHTMLNamedEntityCaseSensitive");
+  const XHTMLEntityToUTF8Data data[] =
+    {
+      {"Upper and lower case XHTML Named Entities",
+       "&Alpha;&alpha;&Dagger;&dagger;&Prime;&prime;",
+       "Αα‡†″′"},
+      {"First and last XHTML Named Entities of the table",
+       "&quot;&rang;",
+       "\"⟩"}};
+  const unsigned int numberOfTests = 2u;
+
+  for(unsigned int index = 0u; index < numberOfTests; ++index)
+  {
+    ToolkitTestApplication application;
+    if(!XHTMLEntityToUTF8Test(data[index]))
+    {
+      tet_result(TET_FAIL);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextMarkupTagsAndAttributesLookup(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMarkupTagsAndAttributesLookup");
+
+  Vector<ColorRun>                     colorRuns;
+  Vector<FontDescriptionRun>           fontRuns;
+  Vector<EmbeddedItem>                 items;
+  Vector<Anchor>                       anchors;
+  Vector<UnderlinedCharacterRun>       underlinedCharacterRuns;
+  Vector<ColorRun>                     backgroundColorRuns;
+  Vector<StrikethroughCharacterRun>    strikethroughCharacterRuns;
+  Vector<BoundedParagraphRun>          boundedParagraphRuns;
+  Vector<CharacterSpacingCharacterRun> characterSpacingCharacterRuns;
+  MarkupProcessData                    markupProcessData(colorRuns, fontRuns, items, anchors, underlinedCharacterRuns, backgroundColorRuns, strikethroughCharacterRuns, boundedParagraphRuns, characterSpacingCharacterRuns);
+  MarkupPropertyData                   markupPropertyData(Color::MEDIUM_BLUE, Color::DARK_MAGENTA);
+
+  // Upper case tags and colors, unknown tags and a span with every one of its attributes.
+  const std::string markup =
+    "<COLOR value='RED'>a</COLOR>"
+    "<unknown value='red'>b</unknown>"
+    "<span font-family='DejaVuSerif' font-size='18' font-weight='bold' font-width='condensed' font-slant='italic' "
+    "text-color='Blue' background-color='#0F0' u-color='red' u-height='1' u-type='solid' u-dash-gap='2' u-dash-width='3' "
+    "s-color='red' s-height='2' char-space-value='4'>c</span>";
+  ProcessMarkupString(markup, markupPropertyData, markupProcessData);
+
+  DALI_TEST_EQUALS(markupProcessData.markupProcessedText, std::string("abc"), TEST_LOCATION);
+
+  DALI_TEST_EQUALS(colorRuns.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(colorRuns[0u].color, Color::RED, TEST_LOCATION);
+  DALI_TEST_EQUALS(colorRuns[1u].color, Color::BLUE, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(backgroundColorRuns.Count(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(backgroundColorRuns[0u].color, Color::GREEN, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(fontRuns.Count(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(fontRuns[0u].familyDefined);
+  DALI_TEST_CHECK(fontRuns[0u].sizeDefined);
+  DALI_TEST_CHECK(fontRuns[0u].weightDefined);
+  DALI_TEST_CHECK(fontRuns[0u].widthDefined);
+  DALI_TEST_CHECK(fontRuns[0u].slantDefined);
+  delete[] fontRuns[0u].familyName;
+
+  DALI_TEST_EQUALS(underlinedCharacterRuns.Count(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(underlinedCharacterRuns[0u].properties.dashWidthDefined);
+
+  DALI_TEST_EQUALS(strikethroughCharacterRuns.Count(), 1u, TEST_LOCATION);
+
+  // The span has fifteen attributes, more than the attributes of a tag used to be parsed into.
+  DALI_TEST_EQUALS(characterSpacingCharacterRuns.Count(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(characterSpacingCharacterRuns[0u].value, 4.f, TEST_LOCATION);
+
+  END_TEST;
+}
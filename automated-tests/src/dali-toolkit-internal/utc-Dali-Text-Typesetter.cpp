@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <unistd.h>
+#include <cstdlib>
 #include <limits>
 
 #include <dali-toolkit-test-suite-utils.h>
@@ -26,8 +27,10 @@
 #include <dali-toolkit/devel-api/text/bitmap-font.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
 #include <dali-toolkit/internal/text/controller/text-controller.h>
+#include <dali-toolkit/internal/text/rendering/styles/blur-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/text-typesetter.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <toolkit-environment-variable.h>
 #include <toolkit-text-utils.h>
@@ -42,6 +45,20 @@ const std::string     DEFAULT_FONT_DIR("/resources/fonts");
 const PointSize26Dot6 EMOJI_FONT_SIZE = 3840u; // 60 * 64
 
 constexpr auto DALI_RENDERED_GLYPH_COMPRESS_POLICY = "DALI_RENDERED_GLYPH_COMPRESS_POLICY";
+
+Devel::PixelBuffer CreateRectanglePixelBuffer(uint32_t width, uint32_t height, Pixel::Format pixelFormat)
+{
+  Devel::PixelBuffer pixelBuffer   = Devel::PixelBuffer::New(width, height, pixelFormat);
+  const uint32_t     bytesPerPixel = Pixel::GetBytesPerPixel(pixelFormat);
+  uint8_t* const     buffer        = pixelBuffer.GetBuffer();
+
+  memset(buffer, 0, width * height * bytesPerPixel);
+  for(uint32_t y = height / 4u; y < 3u * height / 4u; ++y)
+  {
+    memset(buffer + (y * width + width / 3u) * bytesPerPixel, 0xFF, (width / 3u) * bytesPerPixel);
+  }
+  return pixelBuffer;
+}
 } // namespace
 
 int UtcDaliTextTypesetter(void)
@@ -462,3 +479,78 @@ int UtcDaliTextTypesetterBitmapFont(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextTypesetterBoxBlur(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterBoxBlur");
+  ToolkitTestApplication application;
+
+  const uint32_t width         = 64u;
+  const uint32_t height        = 32u;
+  const uint32_t bytesPerPixel = 4u;
+
+  for(const float blurRadius : {2.f, 5.f, 10.f})
+  {
+    Devel::PixelBuffer expected = CreateRectanglePixelBuffer(width, height, Pixel::RGBA8888);
+    Devel::PixelBuffer blurred  = CreateRectanglePixelBuffer(width, height, Pixel::RGBA8888);
+
+    expected.ApplyGaussianBlur(blurRadius);
+    ApplyBoxBlur(blurred, blurRadius);
+
+    // The box blurs are close to the gaussian blur.
+    const uint8_t* const expectedBuffer = expected.GetBuffer();
+    const uint8_t* const blurredBuffer  = blurred.GetBuffer();
+    int                  maxDifference  = 0;
+    for(uint32_t index = 0u; index < width * height * bytesPerPixel; ++index)
+    {
+      maxDifference = std::max(maxDifference, std::abs(static_cast<int>(expectedBuffer[index]) - static_cast<int>(blurredBuffer[index])));
+    }
+    DALI_TEST_CHECK(maxDifference <= 8);
+
+    // The blur spreads beyond the rectangle.
+    DALI_TEST_CHECK(blurredBuffer[((height / 2u) * width + width / 3u - 1u) * bytesPerPixel + 3u] > 0u);
+  }
+
+  // An alpha mask is blurred as one channel of a color buffer.
+  Devel::PixelBuffer colorBuffer = CreateRectanglePixelBuffer(width, height, Pixel::RGBA8888);
+  Devel::PixelBuffer alphaBuffer = CreateRectanglePixelBuffer(width, height, Pixel::A8);
+  ApplyBoxBlur(colorBuffer, 5.f);
+  ApplyBoxBlur(alphaBuffer, 5.f);
+  for(uint32_t index = 0u; index < width * height; ++index)
+  {
+    DALI_TEST_EQUALS(static_cast<uint32_t>(colorBuffer.GetBuffer()[index * bytesPerPixel + 3u]), static_cast<uint32_t>(alphaBuffer.GetBuffer()[index]), TEST_LOCATION);
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextTypesetterBoxBlurTransparent(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterBoxBlurTransparent");
+  ToolkitTestApplication application;
+
+  const uint32_t width  = 16u;
+  const uint32_t height = 16u;
+
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New(width, height, Pixel::RGBA8888);
+  memset(pixelBuffer.GetBuffer(), 0, width * height * 4u);
+
+  ApplyBoxBlur(pixelBuffer, 4.f);
+
+  bool isTransparent = true;
+  for(uint32_t index = 0u; index < width * height * 4u; ++index)
+  {
+    isTransparent = isTransparent && (pixelBuffer.GetBuffer()[index] == 0u);
+  }
+  DALI_TEST_CHECK(isTransparent);
+
+  // A zero radius doesn't change the buffer.
+  Devel::PixelBuffer rectangle = CreateRectanglePixelBuffer(width, height, Pixel::A8);
+  ApplyBoxBlur(rectangle, 0.f);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(rectangle.GetBuffer()[(height / 2u) * width + width / 3u - 1u]), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(rectangle.GetBuffer()[(height / 2u) * width + width / 3u]), 0xFFu, TEST_LOCATION);
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -26,6 +26,8 @@
 
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/arc-visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-data-cache.h>
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-scheduler.h>
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
 #include <dali-toolkit/internal/visuals/npatch/npatch-visual.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
@@ -433,3 +435,134 @@ int UtcDaliVisualCreateWithoutCoreN(void)
 
   END_TEST;
 }
+
+int UtcDaliVectorAnimationDataCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVectorAnimationDataCache: The downloaded data is shared, and the least recently used data is removed");
+
+  using DataCache = Toolkit::Internal::VectorAnimationDataCache;
+  using DataPtr   = DataCache::DataPtr;
+
+  auto createData = [](uint32_t size) {
+    auto data = std::make_shared<Dali::Vector<uint8_t>>();
+    data->Resize(size, 0u);
+    return data;
+  };
+
+  DataCache dataCache(100u);
+  DataPtr   data;
+
+  // The first task downloads the data.
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", true, data) == DataCache::Result::DOWNLOAD);
+
+  // The event thread doesn't wait for it.
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", false, data) == DataCache::Result::MISS);
+
+  DataPtr firstData = createData(40u);
+  dataCache.Add("http://first.json", firstData);
+  DALI_TEST_EQUALS(dataCache.GetSize(), 40u, TEST_LOCATION);
+
+  // The next tasks use it.
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", true, data) == DataCache::Result::CACHED);
+  DALI_TEST_CHECK(data == firstData);
+
+  // A failed download isn't cached, and the next tasks don't download it again.
+  DALI_TEST_CHECK(dataCache.Acquire("http://second.json", true, data) == DataCache::Result::DOWNLOAD);
+  dataCache.Cancel("http://second.json");
+  DALI_TEST_CHECK(dataCache.Acquire("http://second.json", true, data) == DataCache::Result::FAILED);
+  DALI_TEST_EQUALS(dataCache.GetSize(), 40u, TEST_LOCATION);
+
+  // Until the url is invalidated.
+  dataCache.Invalidate("http://second.json");
+  DALI_TEST_CHECK(dataCache.Acquire("http://second.json", true, data) == DataCache::Result::DOWNLOAD);
+  DataPtr secondData = createData(40u);
+  dataCache.Add("http://second.json", secondData);
+  DALI_TEST_EQUALS(dataCache.GetSize(), 80u, TEST_LOCATION);
+
+  // Use the first data, so the second one is the least recently used.
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", true, data) == DataCache::Result::CACHED);
+
+  DALI_TEST_CHECK(dataCache.Acquire("http://third.json", true, data) == DataCache::Result::DOWNLOAD);
+  dataCache.Add("http://third.json", createData(40u));
+  DALI_TEST_EQUALS(dataCache.GetSize(), 80u, TEST_LOCATION);
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", true, data) == DataCache::Result::CACHED);
+  DALI_TEST_CHECK(data == firstData);
+  DALI_TEST_CHECK(dataCache.Acquire("http://second.json", true, data) == DataCache::Result::DOWNLOAD);
+  dataCache.Cancel("http://second.json");
+
+  // Invalidated data is removed.
+  dataCache.Invalidate("http://first.json");
+  DALI_TEST_EQUALS(dataCache.GetSize(), 40u, TEST_LOCATION);
+  DALI_TEST_CHECK(dataCache.Acquire("http://first.json", true, data) == DataCache::Result::DOWNLOAD);
+  dataCache.Cancel("http://first.json");
+
+  // The data larger than the cache is never kept.
+  DALI_TEST_CHECK(dataCache.Acquire("http://large.json", true, data) == DataCache::Result::DOWNLOAD);
+  dataCache.Add("http://large.json", createData(200u));
+  DALI_TEST_EQUALS(dataCache.GetSize(), 40u, TEST_LOCATION);
+  DALI_TEST_CHECK(dataCache.Acquire("http://large.json", true, data) == DataCache::Result::MISS);
+  DALI_TEST_CHECK(dataCache.Acquire("http://large.json", true, data) == DataCache::Result::MISS);
+
+  END_TEST;
+}
+
+int UtcDaliVectorAnimationScheduler(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVectorAnimationScheduler: The animations of low priority are degraded first under load");
+
+  using Priority = Toolkit::Internal::VectorAnimationTask::RasterizationPriority;
+
+  Toolkit::Internal::VectorAnimationScheduler scheduler(8000);
+
+  auto currentTime = std::chrono::steady_clock::now();
+  auto nextWindow  = [&currentTime]() {
+    currentTime += std::chrono::milliseconds(110);
+    return currentTime;
+  };
+
+  // Within the budget
+  DALI_TEST_CHECK(!scheduler.IsOverloaded());
+  DALI_TEST_CHECK(!scheduler.IsFrozen(Priority::OFFSCREEN));
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::LOW), 1u, TEST_LOCATION);
+
+  // Twice the budget: the small animations are degraded and the culled ones are frozen.
+  scheduler.AddRasterizationTime(105000);
+  scheduler.Update(nextWindow());
+  DALI_TEST_CHECK(scheduler.IsOverloaded());
+  DALI_TEST_CHECK(scheduler.IsFrozen(Priority::OFFSCREEN));
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::LOW), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::NORMAL), 1u, TEST_LOCATION);
+
+  // Still over the budget
+  scheduler.AddRasterizationTime(105000);
+  scheduler.Update(nextWindow());
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::LOW), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::NORMAL), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::HIGH), 1u, TEST_LOCATION);
+
+  // Within the budget but not well below it: the load doesn't oscillate.
+  scheduler.AddRasterizationTime(35000);
+  scheduler.Update(nextWindow());
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::LOW), 4u, TEST_LOCATION);
+
+  // The load goes down a level per window.
+  scheduler.Update(nextWindow());
+  DALI_TEST_EQUALS(scheduler.GetFrameInterval(Priority::LOW), 2u, TEST_LOCATION);
+  scheduler.Update(nextWindow());
+  DALI_TEST_CHECK(!scheduler.IsOverloaded());
+
+  scheduler.AddSkippedFrames(3u);
+  Property::Map statistics = scheduler.GetStatistics();
+  DALI_TEST_EQUALS(statistics.Find("skippedFrames")->Get<int32_t>(), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.Find("budget")->Get<float>(), 8.0f, TEST_LOCATION);
+
+  // No budget disables the scheduling.
+  Toolkit::Internal::VectorAnimationScheduler disabledScheduler(0);
+  disabledScheduler.AddRasterizationTime(1000000);
+  disabledScheduler.Update(currentTime + std::chrono::seconds(1));
+  DALI_TEST_CHECK(!disabledScheduler.IsOverloaded());
+
+  END_TEST;
+}
@@ -1416,3 +1416,101 @@ int UtcDaliStyleManagerNewWithAdditionalBehavior(void)
 
   END_TEST;
 }
+
+namespace
+{
+int gCreatedTextLabelCount = 0;
+
+void OnObjectCreated(BaseHandle handle)
+{
+  if(TextLabel::DownCast(handle))
+  {
+    ++gCreatedTextLabelCount;
+  }
+}
+} // namespace
+
+int UtcDaliStyleManagerSetStylePrecompileEnabled(void)
+{
+  tet_infoline("Test that the styles of the theme are precompiled in the idle callbacks without creating controls");
+
+  const char* defaultTheme =
+    "{\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"TextLabel\":\n"
+    "    {\n"
+    "      \"pointSize\":18,\n"
+    "      \"padding\":[1,2,3,4]\n"
+    "    },\n"
+    "    \"TextField\":\n"
+    "    {\n"
+    "      \"pointSize\":18,\n"
+    "      \"notAProperty\":1\n"
+    "    },\n"
+    "    \"NotAControlType\":\n"
+    "    {\n"
+    "      \"pointSize\":18\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  Test::StyleMonitor::SetThemeFileOutput(DALI_STYLE_DIR "dali-toolkit-default-theme.json", defaultTheme);
+
+  ToolkitTestApplication application;
+
+  ObjectRegistry registry = application.GetCore().GetObjectRegistry();
+  registry.ObjectCreatedSignal().Connect(&OnObjectCreated);
+  gCreatedTextLabelCount = 0;
+
+  Toolkit::StyleManager            styleManager     = Toolkit::StyleManager::Get();
+  Toolkit::Internal::StyleManager& styleManagerImpl = GetImpl(styleManager);
+  DevelStyleManager::SetStylePrecompileEnabled(styleManager, true);
+
+  // Nothing is recorded until the main loop is idle.
+  DALI_TEST_CHECK(!styleManagerImpl.GetRecordedStyle("TextLabel"));
+
+  application.RunIdles();
+
+  // The style is recorded in the theme builder, but no control is created to record it.
+  const Toolkit::Internal::StylePtr recordedStyle = styleManagerImpl.GetRecordedStyle("TextLabel");
+  DALI_TEST_CHECK(recordedStyle);
+  DALI_TEST_CHECK(!styleManagerImpl.GetRecordedStyle("NotAControlType"));
+  DALI_TEST_EQUALS(gCreatedTextLabelCount, 0, TEST_LOCATION);
+
+  // The values have the types the properties are registered with, not the ones guessed from the JSON.
+  const Property::Value* pointSize = recordedStyle->properties.Find(TextLabel::Property::POINT_SIZE);
+  DALI_TEST_CHECK(pointSize);
+  DALI_TEST_EQUALS(pointSize->GetType(), Property::FLOAT, TEST_LOCATION);
+  DALI_TEST_EQUALS(pointSize->Get<float>(), 18.0f, TEST_LOCATION);
+
+  const Property::Value* padding = recordedStyle->properties.Find(Control::Property::PADDING);
+  DALI_TEST_CHECK(padding);
+  DALI_TEST_EQUALS(padding->GetType(), Property::EXTENTS, TEST_LOCATION);
+  DALI_TEST_EQUALS(padding->Get<Extents>(), Extents(1, 2, 3, 4), TEST_LOCATION);
+
+  // A style with a key the type doesn't have is left to the first control of the type.
+  DALI_TEST_CHECK(!styleManagerImpl.GetRecordedStyle("TextField"));
+
+  // The idle callback is removed after all the styles are precompiled.
+  application.RunIdles();
+  DALI_TEST_EQUALS(gCreatedTextLabelCount, 0, TEST_LOCATION);
+
+  // A control created later gets the precompiled style, which is not recorded again.
+  TextLabel label = TextLabel::New("Precompiled");
+  DALI_TEST_EQUALS(gCreatedTextLabelCount, 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(label.GetProperty<float>(TextLabel::Property::POINT_SIZE), 18.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(label.GetProperty<Extents>(Control::Property::PADDING), Extents(1, 2, 3, 4), TEST_LOCATION);
+  DALI_TEST_CHECK(styleManagerImpl.GetRecordedStyle("TextLabel") == recordedStyle);
+
+  TextField field = TextField::New();
+  DALI_TEST_CHECK(styleManagerImpl.GetRecordedStyle("TextField"));
+
+  // The styles queued before it's disabled are not precompiled.
+  DevelStyleManager::SetStylePrecompileEnabled(styleManager, true);
+  DevelStyleManager::SetStylePrecompileEnabled(styleManager, false);
+  application.RunIdles();
+  DALI_TEST_EQUALS(gCreatedTextLabelCount, 1, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -31,6 +31,7 @@
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/animated-vector-image-visual-actions-devel.h>
+#include <dali-toolkit/devel-api/visuals/animated-vector-image-visual-scheduler-devel.h>
 #include <dali-toolkit/devel-api/visuals/animated-vector-image-visual-signals-devel.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-actions-devel.h>
@@ -2724,4 +2725,50 @@ int UtcDaliAnimatedVectorImageNativeTextureChangeShader(void)
   Test::VectorAnimationRenderer::UseNativeImageTexture(false);
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliAnimatedVectorImageVisualSchedulerStatistics(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliAnimatedVectorImageVisualSchedulerStatistics: The scheduling statistics are retrieved after rasterizing");
+
+  Property::Map propertyMap;
+  propertyMap.Add(Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE)
+    .Add(ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME)
+    .Add(ImageVisual::Property::SYNCHRONOUS_LOADING, false);
+
+  Visual::Base visual = VisualFactory::Get().CreateVisual(propertyMap);
+  DALI_TEST_CHECK(visual);
+
+  DummyControl      actor     = DummyControl::New(true);
+  DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>(actor.GetImplementation());
+  dummyImpl.RegisterVisual(DummyControl::Property::TEST_VISUAL, visual);
+  actor.SetProperty(Actor::Property::SIZE, Vector2(20.0f, 20.0f));
+
+  application.GetScene().Add(actor);
+
+  application.SendNotification();
+  application.Render();
+
+  // Trigger count is 2 - load & render a frame
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(2), true, TEST_LOCATION);
+
+  Property::Map statistics = DevelAnimatedVectorImageVisual::GetSchedulerStatistics();
+
+  Property::Value* value = statistics.Find("budget");
+  DALI_TEST_CHECK(value);
+  DALI_TEST_CHECK(value->Get<float>() > 0.0f);
+
+  value = statistics.Find("loadLevel");
+  DALI_TEST_CHECK(value);
+  DALI_TEST_EQUALS(value->Get<int32_t>(), 0, TEST_LOCATION);
+
+  DALI_TEST_CHECK(statistics.Find("utilization"));
+  DALI_TEST_CHECK(statistics.Find("skippedFrames"));
+
+  value = statistics.Find("frozenAnimations");
+  DALI_TEST_CHECK(value);
+  DALI_TEST_EQUALS(value->Get<int32_t>(), 0, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -585,3 +585,77 @@ int UtcDaliCanvasViewRasterizationRequestManually(void)
 
   END_TEST;
 }
+
+int UtcDaliCanvasViewRasterizationSuspendedWhileHidden(void)
+{
+  ToolkitTestApplication application;
+
+  CanvasView canvasView = CanvasView::New(Vector2(300, 300));
+  DALI_TEST_CHECK(canvasView);
+
+  application.GetScene().Add(canvasView);
+
+  canvasView.SetProperty(Actor::Property::SIZE, Vector2(300, 300));
+  canvasView.SetProperty(Toolkit::CanvasView::Property::SYNCHRONOUS_LOADING, false);
+
+  Dali::CanvasRenderer::Shape shape = Dali::CanvasRenderer::Shape::New();
+  shape.AddRect(Rect<float>(10, 10, 10, 10), Vector2(0, 0));
+  canvasView.AddDrawable(shape);
+
+  application.SendNotification();
+  application.Render();
+
+  // Rasterization occured
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  canvasView.SetProperty(Actor::Property::VISIBLE, false);
+
+  application.SendNotification();
+  application.Render();
+
+  // The latest rasterization request is not cancelled.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  shape.AddRect(Rect<float>(20, 20, 10, 10), Vector2(0, 0));
+  application.SendNotification();
+  application.Render();
+
+  // Check if the hidden canvasView is not rasterized.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 0), false, TEST_LOCATION);
+
+  canvasView.SetProperty(Actor::Property::VISIBLE, true);
+
+  application.SendNotification();
+  application.Render();
+
+  // The changes are rasterized when it's shown again.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  canvasView.Unparent();
+
+  // Wait the rasterization requested before the canvasView is removed.
+  Test::WaitForEventThreadTrigger(1, 1);
+
+  application.SendNotification();
+  application.Render();
+
+  // Check if the canvasView off the scene is not rasterized.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 0), false, TEST_LOCATION);
+
+  shape.AddRect(Rect<float>(30, 30, 10, 10), Vector2(0, 0));
+  application.SendNotification();
+  application.Render();
+
+  // Check if the change off the scene is not rasterized.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1, 0), false, TEST_LOCATION);
+
+  application.GetScene().Add(canvasView);
+
+  application.SendNotification();
+  application.Render();
+
+  // The changes are rasterized when it's added to the scene again.
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  END_TEST;
+}
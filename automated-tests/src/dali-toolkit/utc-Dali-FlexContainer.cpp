@@ -590,3 +590,58 @@ int UtcDaliToolkitFlexContainerRTLSupportP(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexContainerNestedP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitFlexContainerNestedP");
+
+  FlexContainer flexContainer = FlexContainer::New();
+  flexContainer.SetProperty(Actor::Property::SIZE, Vector2(400.0f, 400.0f));
+  flexContainer.SetProperty(FlexContainer::Property::FLEX_DIRECTION, FlexContainer::ROW);
+  application.GetScene().Add(flexContainer);
+
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  flexContainer.Add(actor);
+
+  // The nested container is laid out with its parent.
+  FlexContainer nestedContainer = FlexContainer::New();
+  nestedContainer.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  flexContainer.Add(nestedContainer);
+
+  Actor nestedActor1 = Actor::New();
+  Actor nestedActor2 = Actor::New();
+  nestedActor1.SetProperty(Actor::Property::SIZE, Vector2(50.0f, 50.0f));
+  nestedActor2.SetProperty(Actor::Property::SIZE, Vector2(50.0f, 50.0f));
+  nestedContainer.Add(nestedActor1);
+  nestedContainer.Add(nestedActor2);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(nestedContainer.GetProperty<Vector3>(Actor::Property::POSITION).x, 100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(nestedActor1.GetProperty<Vector3>(Actor::Property::POSITION).y, 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(nestedActor2.GetProperty<Vector3>(Actor::Property::POSITION).y, 50.0f, TEST_LOCATION);
+
+  tet_infoline(" Change a child property of a nested child");
+  nestedActor1.SetProperty(FlexContainer::ChildProperty::FLEX_MARGIN, Vector4(0.0f, 10.0f, 0.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(nestedActor1.GetProperty<Vector3>(Actor::Property::POSITION).y, 10.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(nestedActor2.GetProperty<Vector3>(Actor::Property::POSITION).y, 60.0f, TEST_LOCATION);
+
+  tet_infoline(" Detach the nested container and destroy its former parent");
+  application.GetScene().Add(nestedContainer);
+  flexContainer.Unparent();
+  flexContainer.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(nestedActor2.GetProperty<Vector3>(Actor::Property::POSITION).y, 60.0f, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -2455,4 +2455,218 @@ int UtcDaliKeyboardFocusManagerKeyEventOtherWindow(void)
   DALI_TEST_CHECK(manager.GetCurrentFocusActor() == button1);
 
   END_TEST;
-}
\ No newline at end of file
+}
+int UtcDaliKeyboardFocusManagerFocusSpatialIndex(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliKeyboardFocusManagerFocusSpatialIndex");
+
+  KeyboardFocusManager manager = KeyboardFocusManager::Get();
+  DALI_TEST_CHECK(manager);
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableDefaultAlgorithm(manager, true);
+  DALI_TEST_CHECK(!Dali::Toolkit::DevelKeyboardFocusManager::IsFocusSpatialIndexEnabled(manager));
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusSpatialIndex(manager, true);
+  DALI_TEST_CHECK(Dali::Toolkit::DevelKeyboardFocusManager::IsFocusSpatialIndexEnabled(manager));
+
+  // button1 -- button2
+  //    |          |
+  // button3 -- button4
+  PushButton buttons[4];
+  for(int i = 0; i < 4; ++i)
+  {
+    buttons[i] = PushButton::New();
+    buttons[i].SetProperty(Actor::Property::SIZE, Vector2(50, 50));
+    buttons[i].SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    buttons[i].SetProperty(Actor::Property::POSITION, Vector2((i % 2) * 100.0f, (i / 2) * 100.0f));
+    buttons[i].SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+    application.GetScene().Add(buttons[i]);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[1]);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::DOWN) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[3]);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::LEFT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[2]);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::UP) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[0]);
+
+  // An added actor is found
+  // button1 -- button2 -- button5
+  PushButton button5 = PushButton::New();
+  button5.SetProperty(Actor::Property::SIZE, Vector2(50, 50));
+  button5.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  button5.SetProperty(Actor::Property::POSITION, Vector2(200.0f, 0.0f));
+  button5.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+  application.GetScene().Add(button5);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[1]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == button5);
+
+  // A moved actor is not found where it was
+  // button1 -- ------- -- button5
+  buttons[1].SetProperty(Actor::Property::POSITION, Vector2(400.0f, 400.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == button5);
+
+  // A hidden actor is not found
+  button5.SetProperty(Actor::Property::VISIBLE, false);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[2]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[3]);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::UP) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[0]);
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusSpatialIndex(manager, false);
+  DALI_TEST_CHECK(!Dali::Toolkit::DevelKeyboardFocusManager::IsFocusSpatialIndexEnabled(manager));
+
+  END_TEST;
+}
+
+int UtcDaliKeyboardFocusManagerFocusSpatialIndexUpdate(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliKeyboardFocusManagerFocusSpatialIndexUpdate");
+
+  KeyboardFocusManager manager = KeyboardFocusManager::Get();
+  DALI_TEST_CHECK(manager);
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableDefaultAlgorithm(manager, true);
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusSpatialIndex(manager, true);
+
+  // button1 -- button2 -- control -- button3
+  PushButton buttons[3];
+  for(int i = 0; i < 3; ++i)
+  {
+    buttons[i] = PushButton::New();
+    buttons[i].SetProperty(Actor::Property::SIZE, Vector2(50, 50));
+    buttons[i].SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    buttons[i].SetProperty(Actor::Property::POSITION, Vector2(i * 200.0f, 0.0f));
+    buttons[i].SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+    application.GetScene().Add(buttons[i]);
+  }
+
+  Control control = Control::New();
+  control.SetProperty(Actor::Property::SIZE, Vector2(50, 50));
+  control.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  control.SetProperty(Actor::Property::POSITION, Vector2(300.0f, 0.0f));
+  control.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, false);
+  application.GetScene().Add(control);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[1]);
+
+  // An actor moved without a relayout is found where it is now
+  // button1 -- button3 -- button2 -- control
+  buttons[2].SetProperty(Actor::Property::POSITION, Vector2(100.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[2]);
+
+  // An actor made focusable is found
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[1]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == false);
+
+  control.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == control);
+
+  // An actor removed with its parent is not found
+  Actor parent = Actor::New();
+  application.GetScene().Add(parent);
+  control.Unparent();
+  parent.Add(control);
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[1]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == control);
+
+  parent.Unparent();
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[1]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == false);
+
+  END_TEST;
+}
+
+int UtcDaliKeyboardFocusManagerFocusSpatialIndexAnimatedMove(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliKeyboardFocusManagerFocusSpatialIndexAnimatedMove");
+
+  KeyboardFocusManager manager = KeyboardFocusManager::Get();
+  DALI_TEST_CHECK(manager);
+
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableDefaultAlgorithm(manager, true);
+  Dali::Toolkit::DevelKeyboardFocusManager::EnableFocusSpatialIndex(manager, true);
+
+  // button1 -- button2 -- button3
+  PushButton buttons[3];
+  for(int i = 0; i < 3; ++i)
+  {
+    buttons[i] = PushButton::New();
+    buttons[i].SetProperty(Actor::Property::SIZE, Vector2(50, 50));
+    buttons[i].SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    buttons[i].SetProperty(Actor::Property::POSITION, Vector2(i * 200.0f, 0.0f));
+    buttons[i].SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+    application.GetScene().Add(buttons[i]);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[1]);
+
+  // An animation moves the actor without reporting it. The query finds the move when it compares the actor.
+  // button1 -- button3 -- button2
+  Animation animation = Animation::New(0.1f);
+  animation.AnimateTo(Property(buttons[1], Actor::Property::POSITION), Vector3(500.0f, 0.0f, 0.0f));
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(200);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(manager.SetCurrentFocusActor(buttons[0]) == true);
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[2]);
+
+  DALI_TEST_CHECK(manager.MoveFocus(Control::KeyboardFocus::RIGHT) == true);
+  DALI_TEST_CHECK(manager.GetCurrentFocusActor() == buttons[1]);
+
+  END_TEST;
+}
@@ -16,6 +16,7 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali-toolkit/public-api/particle-system/particle-builtin-modifiers.h>
 #include <dali-toolkit/public-api/particle-system/particle-domain.h>
 #include <dali-toolkit/public-api/particle-system/particle-emitter.h>
 #include <dali-toolkit/public-api/particle-system/particle-list.h>
@@ -166,6 +167,46 @@ public:
   uint32_t               mStreamBasePos{0u};
   ParticleEmitter&       mEmitter;
 };
+
+/**
+ * Test source emitting the initial particles only, alternating short and long lifetimes.
+ * The position stream stores the lifetime of each particle to check it's moved with it.
+ */
+class TestSourceLifetimes : public ParticleSourceInterface
+{
+public:
+  TestSourceLifetimes(ParticleEmitter* emitter)
+  {
+  }
+
+  uint32_t Update(ParticleList& outList, uint32_t count) override
+  {
+    if(mEmitted)
+    {
+      return 0u;
+    }
+    mEmitted = true;
+
+    for(auto i = 0u; i < count; ++i)
+    {
+      auto lifetime = (i % 2u) ? 2.0f : 0.5f;
+      auto particle = outList.NewParticle(lifetime);
+      if(!particle)
+      {
+        return i;
+      }
+      particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT) = Vector3(lifetime, float(i), 0.0f);
+    }
+    return count;
+  }
+
+  void Init() override
+  {
+  }
+
+  bool mEmitted{false};
+};
+
 /**
  * Sample of FlameModifier
  */
@@ -423,6 +464,28 @@ int UtcDaliParticleSystemEmitterDefaultStreams(void)
   END_TEST;
 }
 
+int UtcDaliParticleSystemListMissingDefaultStream(void)
+{
+  TestApplication application;
+
+  auto particleList = ParticleList::New(10, ParticleStream::POSITION_STREAM_BIT);
+
+  DALI_TEST_EQUALS(particleList.GetDefaultStreamIndex(ParticleStream::POSITION_STREAM_BIT), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(particleList.GetDefaultStream<Vector3>(ParticleStream::POSITION_STREAM_BIT) != nullptr);
+
+  // Streams which were not requested are not created on demand
+  DALI_TEST_EQUALS(particleList.GetDefaultStreamIndex(ParticleStream::COLOR_STREAM_BIT), -1, TEST_LOCATION);
+  DALI_TEST_CHECK(particleList.GetDefaultStream<Vector4>(ParticleStream::COLOR_STREAM_BIT) == nullptr);
+  DALI_TEST_EQUALS(particleList.GetDefaultStreamIndex(ParticleStream::COLOR_STREAM_BIT), -1, TEST_LOCATION);
+
+  // Without the lifetime streams, a new particle is still allocated
+  auto particle = particleList.NewParticle(1.0f);
+  DALI_TEST_EQUALS(bool(particle), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(particleList.GetActiveParticleCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliParticleSystemEmitterModifierStack(void)
 {
   // create particle emitter
@@ -1062,4 +1125,154 @@ int UtcDaliParticleSystemReplaceEmitter(void)
   DALI_TEST_EQUALS(bool(emitter.GetObjectPtr() != oldEmitter), true, TEST_LOCATION);
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliParticleSystemReleaseKeepsStreamsDense(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  auto emitter = CreateEmitter<TestSourceLifetimes, TestModifier>();
+  emitter.SetParticleCount(100);
+  emitter.SetInitialParticleCount(100);
+  emitter.AttachTo(actor);
+  emitter.Start();
+
+  application.SendNotification();
+  application.Render();
+
+  auto particleList = emitter.GetParticleList();
+  DALI_TEST_EQUALS(particleList.GetActiveParticleCount(), 100u, TEST_LOCATION);
+
+  // List is full
+  DALI_TEST_EQUALS(bool(particleList.NewParticle(1.0f)), false, TEST_LOCATION);
+
+  // Kill the particles with short lifetimes
+  AdvanceTimeByMs(1000);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(particleList.GetActiveParticleCount(), 50u, TEST_LOCATION);
+
+  // Surviving particles occupy the first slots and kept all their data
+  auto* positions     = particleList.GetDefaultStream<Vector3>(ParticleStream::POSITION_STREAM_BIT);
+  auto* lifetimes     = particleList.GetDefaultStream<float>(ParticleStream::LIFETIME_STREAM_BIT);
+  auto* lifetimeBases = particleList.GetDefaultStream<float>(ParticleStream::LIFETIME_BASE_STREAM_BIT);
+
+  std::vector<bool> found(100u, false);
+  for(auto i = 0u; i < 50u; ++i)
+  {
+    DALI_TEST_EQUALS(positions[i].x, 2.0f, TEST_LOCATION);
+    DALI_TEST_EQUALS(lifetimeBases[i], 2.0f, TEST_LOCATION);
+    DALI_TEST_EQUALS(lifetimes[i], 1.0f, 0.001f, TEST_LOCATION);
+    found[uint32_t(positions[i].y)] = true;
+  }
+  for(auto i = 1u; i < 100u; i += 2u)
+  {
+    DALI_TEST_CHECK(found[i]);
+  }
+
+  // Views on the active particles match the stream slots
+  auto& particles = particleList.GetActiveParticles();
+  DALI_TEST_EQUALS(particles.size(), 50u, TEST_LOCATION);
+  auto index = 0u;
+  for(auto& particle : particles)
+  {
+    DALI_TEST_EQUALS(particle.GetIndex(), index, TEST_LOCATION);
+    DALI_TEST_EQUALS(particle.Get<Vector3>(ParticleStream::POSITION_STREAM_BIT), positions[index], TEST_LOCATION);
+    ++index;
+  }
+
+  // Freed slots can be reused
+  auto particle = particleList.NewParticle(1.0f);
+  DALI_TEST_EQUALS(bool(particle), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(particle.GetIndex(), 50u, TEST_LOCATION);
+  DALI_TEST_EQUALS(particleList.GetActiveParticleCount(), 51u, TEST_LOCATION);
+
+  // The list of views is kept, and follows the new particle
+  DALI_TEST_EQUALS(&particleList.GetActiveParticles(), &particles, TEST_LOCATION);
+  DALI_TEST_EQUALS(particles.size(), 51u, TEST_LOCATION);
+  DALI_TEST_EQUALS(particles.back().GetIndex(), 50u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemInstancedStreams(void)
+{
+  TestApplication application;
+
+  auto& bufferTrace = application.GetGlAbstraction().GetBufferTrace();
+  bufferTrace.Enable(true);
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+  actor.SetProperty(Actor::Property::SIZE, Vector2(100, 100));
+
+  auto emitter = CreateEmitter<TestSource, TestModifier>();
+  emitter.SetInitialParticleCount(100);
+  emitter.AttachTo(actor);
+  emitter.Start();
+
+  auto& sourceCallback = dynamic_cast<TestSource&>(emitter.GetSource().GetSourceCallback());
+  sourceCallback.NewFrame();
+  application.SendNotification();
+  application.Render();
+
+  // The stream attributes are stepped once per particle instead of being replicated for each vertex
+  TraceCallStack::NamedParams params;
+  params["divisor"] << 1;
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("VertexAttribDivisor", params));
+
+  END_TEST;
+}
+
+int UtcDaliParticleSystemBuiltinModifiers(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  auto emitter = CreateEmitter<TestSourceLifetimes, TestModifier>();
+  emitter.SetParticleCount(100);
+  emitter.SetInitialParticleCount(100);
+  emitter.EnableParallelProcessing(true);
+  emitter.AddModifier(ParticleModifier::New<GravityModifier>(Vector3(0.0f, 10.0f, 0.0f)));
+  emitter.AddModifier(ParticleModifier::New<DragModifier>(1.0f));
+  emitter.AddModifier(ParticleModifier::New<ColorOverLifeModifier>(Vector4::ONE, Vector4::ZERO));
+  emitter.AddModifier(ParticleModifier::New<ScaleOverLifeModifier>(Vector3::ONE, Vector3(3.0f, 3.0f, 3.0f)));
+  emitter.AttachTo(actor);
+  emitter.Start();
+
+  application.SendNotification();
+  application.Render();
+
+  AdvanceTimeByMs(250);
+  application.SendNotification();
+  application.Render();
+
+  auto particleList = emitter.GetParticleList();
+  DALI_TEST_EQUALS(particleList.GetActiveParticleCount(), 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(particleList.GetUpdateDeltaTime(), 0.25f, 0.001f, TEST_LOCATION);
+
+  auto* positions  = particleList.GetDefaultStream<Vector3>(ParticleStream::POSITION_STREAM_BIT);
+  auto* velocities = particleList.GetDefaultStream<Vector3>(ParticleStream::VELOCITY_STREAM_BIT);
+  auto* colors     = particleList.GetDefaultStream<Vector4>(ParticleStream::COLOR_STREAM_BIT);
+  auto* scales     = particleList.GetDefaultStream<Vector3>(ParticleStream::SCALE_STREAM_BIT);
+
+  for(auto i = 0u; i < 100u; ++i)
+  {
+    // Gravity accelerates to 2.5 and moves by 2.5 * 0.25, then drag slows down by 1 / (1 + 0.25)
+    DALI_TEST_EQUALS(velocities[i], Vector3(0.0f, 2.0f, 0.0f), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(positions[i].y, float(i) + 0.625f, 0.001f, TEST_LOCATION);
+
+    // Short lived particles are half way through their lives, long lived ones an eighth
+    float age = (i % 2u) ? 0.125f : 0.5f;
+    DALI_TEST_EQUALS(colors[i], Vector4::ONE * (1.0f - age), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(scales[i], Vector3::ONE * (1.0f + 2.0f * age), 0.001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
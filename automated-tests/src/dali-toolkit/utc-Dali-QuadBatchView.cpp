@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdlib.h>
+#include <iostream>
+
+#include <dali-toolkit-test-suite-utils.h>
+
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/controls/quad-batch-view/quad-batch-view.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+
+using namespace Dali;
+using namespace Toolkit;
+
+namespace
+{
+int GetStatistic(QuadBatchView view, const std::string& key)
+{
+  Property::Map    statistics = view.GetStatistics();
+  Property::Value* value      = statistics.Find(key);
+  return value ? value->Get<int>() : -1;
+}
+
+Control CreateTile(const Vector3& position)
+{
+  Control tile = Control::New();
+  tile.SetProperty(Actor::Property::SIZE, Vector2(10.0f, 10.0f));
+  tile.SetProperty(Actor::Property::POSITION, position);
+  tile.SetBackgroundColor(Color::RED);
+  return tile;
+}
+
+} // namespace
+
+void utc_dali_toolkit_quadbatchview_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_quadbatchview_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliQuadBatchViewConstructorP(void)
+{
+  ToolkitTestApplication application;
+  QuadBatchView          view;
+
+  DALI_TEST_CHECK(!view);
+
+  view = QuadBatchView::New();
+  DALI_TEST_CHECK(view);
+
+  BaseHandle    handle(view);
+  QuadBatchView downCast = QuadBatchView::DownCast(handle);
+  DALI_TEST_CHECK(downCast);
+  DALI_TEST_CHECK(downCast == view);
+
+  QuadBatchView moved = std::move(view);
+  DALI_TEST_CHECK(moved);
+  DALI_TEST_CHECK(!view);
+
+  END_TEST;
+}
+
+int UtcDaliQuadBatchViewBatchBackgrounds(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the backgrounds of the children are drawn by the view");
+
+  QuadBatchView view = QuadBatchView::New();
+  view.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  application.GetScene().Add(view);
+
+  std::vector<Control> tiles;
+  for(int i = 0; i < 10; ++i)
+  {
+    tiles.push_back(CreateTile(Vector3(i * 12.0f, 0.0f, 0.0f)));
+    view.Add(tiles.back());
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 10, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetStatistic(view, "drawCallsSaved"), 9, TEST_LOCATION);
+  DALI_TEST_EQUALS(view.GetRendererCount(), 1u, TEST_LOCATION);
+  for(auto& tile : tiles)
+  {
+    DALI_TEST_EQUALS(tile.GetRendererCount(), 0u, TEST_LOCATION);
+  }
+
+  tet_infoline("Only the moved child is rebuilt");
+  const int updatedQuads = GetStatistic(view, "updatedQuads");
+  tiles[3].SetProperty(Actor::Property::POSITION, Vector3(36.0f, 20.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "updatedQuads"), updatedQuads + 1, TEST_LOCATION);
+
+  tet_infoline("The removed child draws its background again");
+  view.Remove(tiles[0]);
+  application.GetScene().Add(tiles[0]);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 9, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetStatistic(view, "drawCallsSaved"), 8, TEST_LOCATION);
+  DALI_TEST_EQUALS(tiles[0].GetRendererCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliQuadBatchViewUnbatchableBackground(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that a background with a corner radius is not batched");
+
+  QuadBatchView view = QuadBatchView::New();
+  view.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  application.GetScene().Add(view);
+
+  Control tile = CreateTile(Vector3::ZERO);
+  view.Add(tile);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(tile.GetRendererCount(), 0u, TEST_LOCATION);
+
+  Property::Map background;
+  background[Visual::Property::TYPE]               = Visual::COLOR;
+  background[ColorVisual::Property::MIX_COLOR]     = Color::BLUE;
+  background[DevelVisual::Property::CORNER_RADIUS] = 5.0f;
+  tile.SetProperty(Control::Property::BACKGROUND, background);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetStatistic(view, "drawCallsSaved"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(tile.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(view.GetRendererCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliQuadBatchViewOverlappingChildren(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the overlapping backgrounds are not batched, to keep the drawing order");
+
+  QuadBatchView view = QuadBatchView::New();
+  view.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  application.GetScene().Add(view);
+
+  Control first  = CreateTile(Vector3::ZERO);
+  Control second = CreateTile(Vector3(5.0f, 5.0f, 0.0f));
+  view.Add(first);
+  view.Add(second);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(first.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(second.GetRendererCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("The backgrounds are batched once they don't overlap");
+  second.SetProperty(Actor::Property::POSITION, Vector3(20.0f, 0.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(first.GetRendererCount(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(second.GetRendererCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliQuadBatchViewBatchDescendants(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("Test that the backgrounds of the descendants are batched below their children");
+
+  QuadBatchView view = QuadBatchView::New();
+  view.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  application.GetScene().Add(view);
+
+  Control panel = CreateTile(Vector3::ZERO);
+  panel.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  panel.Add(CreateTile(Vector3::ZERO));
+  panel.Add(CreateTile(Vector3(20.0f, 0.0f, 0.0f)));
+  view.Add(panel);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetStatistic(view, "drawCallsSaved"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(panel.GetRendererCount(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(panel.GetChildAt(0).GetRendererCount(), 0u, TEST_LOCATION);
+
+  tet_infoline("The children are not batched below a panel which draws its own background");
+  Property::Map background;
+  background[Visual::Property::TYPE]               = Visual::COLOR;
+  background[ColorVisual::Property::MIX_COLOR]     = Color::BLUE;
+  background[DevelVisual::Property::CORNER_RADIUS] = 5.0f;
+  panel.SetProperty(Control::Property::BACKGROUND, background);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(panel.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(panel.GetChildAt(0).GetRendererCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("A child added to a descendant is batched");
+  panel.SetProperty(Control::Property::BACKGROUND, Color::BLUE);
+  panel.Add(CreateTile(Vector3(40.0f, 0.0f, 0.0f)));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(GetStatistic(view, "batchedVisuals"), 4, TEST_LOCATION);
+  DALI_TEST_EQUALS(panel.GetChildAt(2).GetRendererCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -16,6 +16,10 @@
  */
 
 #include <dali-toolkit-test-suite-utils.h>
+#include <algorithm>
+#include <vector>
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
+#include <dali-toolkit/devel-api/controls/render-effects/render-effect-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -305,3 +309,124 @@ int UtcDaliRenderEffectInvalidTargetSize(void)
 
   END_TEST;
 }
+
+int UtcDaliRenderEffectReuseRenderTargets(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectReuseRenderTargets");
+
+  Integration::Scene scene = application.GetScene();
+
+  Control control1 = Control::New();
+  control1.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  scene.Add(control1);
+
+  Control control2 = Control::New();
+  control2.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  scene.Add(control2);
+
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), 0u, TEST_LOCATION);
+
+  // 100 * 0.4 = 40 pixels, rounded up to 48. An effect uses an input and a half-blurred target.
+  const uint32_t effectBytes = 2u * 48u * 48u * 4u;
+
+  control1.SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  // A concurrent effect of the same size shares the pair of targets.
+  control2.SetRenderEffect(BackgroundBlurEffect::New());
+  RenderTaskList taskList = scene.GetRenderTaskList();
+  DALI_TEST_EQUALS(taskList.GetTaskCount(), 7u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  // Which is safe as the render tasks of the effects don't interleave.
+  std::vector<int32_t> orderIndices;
+  for(uint32_t i = 1u; i < taskList.GetTaskCount(); ++i)
+  {
+    orderIndices.push_back(taskList.GetTask(i).GetOrderIndex());
+  }
+  std::sort(orderIndices.begin(), orderIndices.end());
+  DALI_TEST_CHECK(orderIndices == std::vector<int32_t>({101, 102, 103, 104, 105, 106}));
+
+  application.SendNotification();
+  application.Render();
+
+  // The targets are kept while any effect uses them, then kept for reuse.
+  control1.ClearRenderEffect();
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  control2.ClearRenderEffect();
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  // A new effect of the same size takes the kept targets instead of creating new ones.
+  control1.SetRenderEffect(BackgroundBlurEffect::New());
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  control1.ClearRenderEffect();
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), effectBytes, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRenderEffectDualFilterBlur(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliRenderEffectDualFilterBlur");
+
+  Integration::Scene scene = application.GetScene();
+
+  Control control = Control::New();
+  control.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  scene.Add(control);
+
+  // A radius of 16 takes 3 levels: an input task, 3 downsampling tasks and 3 upsampling tasks.
+  control.SetRenderEffect(DevelBackgroundBlurEffect::New(0.4f, 16u, DevelBackgroundBlurEffect::BlurAlgorithm::DUAL_FILTER));
+  DALI_TEST_EQUALS(scene.GetRenderTaskList().GetTaskCount(), 8u, TEST_LOCATION);
+
+  // 200 * 0.4 = 80 pixels, then 40, 20 and 10, rounded up to 48, 32 and 16.
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), (80u * 80u + 48u * 48u + 32u * 32u + 16u * 16u) * 4u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  // A radius of 1000 would take 9 levels, but the 80 pixels only allow 6 of them, down to a pixel.
+  control.SetRenderEffect(DevelBackgroundBlurEffect::New(0.4f, 1000u, DevelBackgroundBlurEffect::BlurAlgorithm::DUAL_FILTER));
+  DALI_TEST_EQUALS(scene.GetRenderTaskList().GetTaskCount(), 14u, TEST_LOCATION);
+
+  // The sample offset makes up for the missing levels, but only up to 2 texels.
+  uint32_t             passCount = 0u;
+  std::vector<Actor>   actors{control};
+  while(!actors.empty())
+  {
+    Actor actor = actors.back();
+    actors.pop_back();
+    for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+    {
+      actors.push_back(actor.GetChildAt(i));
+    }
+
+    Property::Index halfPixelIndex = actor.GetPropertyIndex("uHalfPixel");
+    if(halfPixelIndex != Property::INVALID_INDEX && actor.GetRendererCount() > 0u && actor.GetRendererAt(0).GetTextures().GetTextureCount() > 0u)
+    {
+      Vector2 halfPixel = actor.GetProperty<Vector2>(halfPixelIndex);
+      Texture input     = actor.GetRendererAt(0).GetTextures().GetTexture(0);
+      DALI_TEST_EQUALS(2.0f * halfPixel.x * input.GetWidth(), 2.0f, 0.001f, TEST_LOCATION);
+      DALI_TEST_EQUALS(2.0f * halfPixel.y * input.GetHeight(), 2.0f, 0.001f, TEST_LOCATION);
+      ++passCount;
+    }
+  }
+  DALI_TEST_EQUALS(passCount, 12u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  // Only the last two released targets, 10 and 5 pixels rounded up to 16, are kept.
+  control.ClearRenderEffect();
+  DALI_TEST_EQUALS(scene.GetRenderTaskList().GetTaskCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(DevelRenderEffect::GetSharedRenderTargetBytes(), (16u * 16u + 16u * 16u) * 4u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -1087,3 +1087,95 @@ int UtcDaliTableViewKeyboardFocusInNestedTableView(void)
 
   END_TEST;
 }
+
+namespace
+{
+struct PositionSetCounter : public ConnectionTracker
+{
+  void OnPropertySet(Handle& handle, Property::Index index, const Property::Value& value)
+  {
+    if(index == Actor::Property::POSITION_X || index == Actor::Property::POSITION_Y)
+    {
+      ++count;
+    }
+  }
+
+  int count{0};
+};
+
+} // namespace
+
+int UtcDaliTableViewRelayoutUnchangedCells(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTableViewRelayoutUnchangedCells: only the cells which move are updated");
+
+  TableView tableView;
+  Actor     actor1;
+  Actor     actor2;
+  Actor     actor3;
+
+  SetupTableViewAndActors(application.GetScene(), tableView, actor1, actor2, actor3);
+
+  application.SendNotification();
+  application.Render();
+
+  PositionSetCounter counter;
+  actor1.PropertySetSignal().Connect(&counter, &PositionSetCounter::OnPropertySet);
+
+  // The first row shrinks, so the second row moves up.
+  tableView.SetFixedHeight(1, 30.0f);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(counter.count, 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(actor1.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 0.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor3.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 70.0f / 9.0f, 0.0f), Math::MACHINE_EPSILON_1000, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTableViewFitSizeCachedPerChild(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTableViewFitSizeCachedPerChild: a FIT row follows its children and keeps its size when the table is resized");
+
+  TableView tableView;
+  Actor     actor1;
+  Actor     actor2;
+  Actor     actor3;
+
+  SetupTableViewAndActors(application.GetScene(), tableView, actor1, actor2, actor3);
+  tableView.SetFitHeight(0);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor3.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 10.0f, 0.0f), TEST_LOCATION);
+
+  // The child grows, so the FIT row must be calculated again.
+  actor1.SetProperty(Actor::Property::SIZE, Vector2(10.0f, 30.0f));
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor3.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 30.0f, 0.0f), TEST_LOCATION);
+
+  // Resizing the table only changes the FILL rows.
+  tableView.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 200.0f));
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor3.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 30.0f, 0.0f), TEST_LOCATION);
+
+  // The removed child no longer contributes to the row.
+  tableView.RemoveChildAt(TableView::CellPosition(0, 0));
+  actor2.SetProperty(Actor::Property::SIZE, Vector2(10.0f, 20.0f));
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor3.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 20.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -26,10 +26,12 @@
 #include <dali-toolkit/devel-api/text/bitmap-font.h>
 #include <dali-toolkit/devel-api/text/rendering-backend.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
+#include <dali-toolkit/devel-api/text/text-profiler-devel.h>
 #include <dali-toolkit/devel-api/text/text-utils-devel.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include <toolkit-environment-variable.h>
 #include "test-text-geometry-utils.h"
 
 using namespace Dali;
@@ -3419,4 +3421,127 @@ int utcDaliTextLabelRemoveBackInset(void)
   DALI_TEST_CHECK(DevelTextLabel::IsRemoveBackInset(label));
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcDaliToolkitTextlabelSharedTexture(void)
+{
+  tet_infoline(" UtcDaliToolkitTextlabelSharedTexture");
+
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_TEXT_TEXTURE_CACHE", "1");
+
+  ToolkitTestApplication application;
+
+  TextLabel labels[3];
+  for(auto& label : labels)
+  {
+    label = TextLabel::New("Add to cart");
+    label.SetProperty(Actor::Property::SIZE, Vector2(100.f, 50.f));
+    label.SetProperty(TextLabel::Property::TEXT_COLOR, Color::BLUE);
+    application.GetScene().Add(label);
+  }
+  labels[2].SetProperty(TextLabel::Property::TEXT, "Buy now");
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(labels[0].GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(labels[1].GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(labels[2].GetRendererCount(), 1u, TEST_LOCATION);
+
+  // The labels with the same text and style share a texture set.
+  TextureSet textureSet = labels[0].GetRendererAt(0u).GetTextures();
+  DALI_TEST_CHECK(textureSet);
+  DALI_TEST_CHECK(textureSet == labels[1].GetRendererAt(0u).GetTextures());
+  DALI_TEST_CHECK(textureSet != labels[2].GetRendererAt(0u).GetTextures());
+
+  // A different style renders another texture.
+  labels[1].SetProperty(TextLabel::Property::TEXT_COLOR, Color::RED);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(textureSet == labels[0].GetRendererAt(0u).GetTextures());
+  DALI_TEST_CHECK(textureSet != labels[1].GetRendererAt(0u).GetTextures());
+
+  // The same text again shares the texture of the first label.
+  labels[2].SetProperty(TextLabel::Property::TEXT, "Add to cart");
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(textureSet == labels[2].GetRendererAt(0u).GetTextures());
+
+  // The shared texture outlives the label which rendered it.
+  labels[0].Unparent();
+  labels[0].Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK(textureSet == labels[2].GetRendererAt(0u).GetTextures());
+  DALI_TEST_EQUALS(textureSet.GetTextureCount(), labels[2].GetRendererAt(0u).GetTextures().GetTextureCount(), TEST_LOCATION);
+
+  EnvironmentVariable::SetTestEnvironmentVariable("DALI_TEXT_TEXTURE_CACHE", "0");
+
+  END_TEST;
+}
+
+int UtcDaliToolkitTextlabelProfilerStatistics(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelProfilerStatistics");
+
+  Text::TextProfiler::ResetStatistics();
+
+  TextLabel label = TextLabel::New("Hello world");
+  label.SetProperty(Actor::Property::SIZE, Vector2(200.f, 50.f));
+  application.GetScene().Add(label);
+
+  application.SendNotification();
+  application.Render();
+
+  // The statistics of the process and of the label count the stages run to render the label.
+  Property::Map processStatistics = Text::TextProfiler::GetStatistics();
+  Property::Map labelStatistics   = Text::TextProfiler::GetStatistics(label);
+
+  for(const auto stageName : {"shaping", "layout", "typesetting"})
+  {
+    Property::Value* processStage = processStatistics.Find(stageName);
+    Property::Value* labelStage   = labelStatistics.Find(stageName);
+    DALI_TEST_CHECK(processStage && processStage->GetMap());
+    DALI_TEST_CHECK(labelStage && labelStage->GetMap());
+
+    const int processCount = processStage->GetMap()->Find("count")->Get<int>();
+    const int labelCount   = labelStage->GetMap()->Find("count")->Get<int>();
+    DALI_TEST_CHECK(labelCount > 0);
+    DALI_TEST_CHECK(processCount >= labelCount);
+
+    // Every run is in a bucket of the histogram.
+    const Property::Array* histogram = labelStage->GetMap()->Find("histogram")->GetArray();
+    DALI_TEST_CHECK(histogram);
+    int histogramCount = 0;
+    for(uint32_t bucket = 0u; bucket < histogram->Count(); ++bucket)
+    {
+      histogramCount += histogram->GetElementAt(bucket).Get<int>();
+    }
+    DALI_TEST_EQUALS(histogramCount, labelCount, TEST_LOCATION);
+    DALI_TEST_CHECK(labelStage->GetMap()->Find("maxTime")->Get<float>() <= labelStage->GetMap()->Find("totalTime")->Get<float>());
+  }
+
+  Property::Value* histogramBounds = processStatistics.Find("histogramBounds");
+  DALI_TEST_CHECK(histogramBounds && histogramBounds->GetArray());
+  DALI_TEST_EQUALS(histogramBounds->GetArray()->Count() + 1u, processStatistics.Find("shaping")->GetMap()->Find("histogram")->GetArray()->Count(), TEST_LOCATION);
+
+  const std::string dump = Text::TextProfiler::DumpStatistics();
+  DALI_TEST_CHECK(dump.find("shaping count:") != std::string::npos);
+
+  // Resetting the process statistics keeps the statistics of the label.
+  Text::TextProfiler::ResetStatistics();
+
+  processStatistics = Text::TextProfiler::GetStatistics();
+  labelStatistics   = Text::TextProfiler::GetStatistics(label);
+  DALI_TEST_EQUALS(processStatistics.Find("shaping")->GetMap()->Find("count")->Get<int>(), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(labelStatistics.Find("shaping")->GetMap()->Find("count")->Get<int>() > 0);
+
+  END_TEST;
+}
@@ -2925,3 +2925,109 @@ int UtcDaliVisualFactoryGetPreCompiler(void)
 
   END_TEST;
 }
+
+int UtcDaliVisualFactoryCreateVisualWithDescriptor(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualWithDescriptor: Request image visuals with a descriptor parsed once");
+
+  Property::Map propertyMap;
+  propertyMap.Insert("visualType", "IMAGE");
+  propertyMap.Insert("url", TEST_IMAGE_FILE_NAME);
+  propertyMap.Insert("fittingMode", "FIT_WIDTH");
+  propertyMap.Insert("wrapModeU", "REPEAT");
+  propertyMap.Insert("releasePolicy", "NEVER");
+  propertyMap.Insert("mixColor", Color::BLUE);
+  propertyMap.Insert("visualFittingMode", "FILL");
+
+  VisualDescriptor descriptor = VisualDescriptor::New(propertyMap);
+  DALI_TEST_CHECK(descriptor);
+
+  tet_printf("Check the keys and the enumeration names are converted\n");
+  const Property::Map& descriptorMap = descriptor.GetPropertyMap();
+  DALI_TEST_EQUALS(descriptorMap.Count(), propertyMap.Count(), TEST_LOCATION);
+  DALI_TEST_CHECK(!descriptorMap.Find("fittingMode"));
+
+  Property::Value* valuePtr = descriptorMap.Find(ImageVisual::Property::FITTING_MODE);
+  DALI_TEST_CHECK(valuePtr);
+  DALI_TEST_EQUALS(valuePtr->Get<int>(), static_cast<int>(FittingMode::FIT_WIDTH), TEST_LOCATION);
+  valuePtr = descriptorMap.Find(ImageVisual::Property::WRAP_MODE_U);
+  DALI_TEST_CHECK(valuePtr);
+  DALI_TEST_EQUALS(valuePtr->Get<int>(), static_cast<int>(WrapMode::REPEAT), TEST_LOCATION);
+  valuePtr = descriptorMap.Find(ImageVisual::Property::RELEASE_POLICY);
+  DALI_TEST_CHECK(valuePtr);
+  DALI_TEST_EQUALS(valuePtr->Get<int>(), static_cast<int>(ImageVisual::ReleasePolicy::NEVER), TEST_LOCATION);
+  valuePtr = descriptorMap.Find(DevelVisual::Property::VISUAL_FITTING_MODE);
+  DALI_TEST_CHECK(valuePtr);
+  DALI_TEST_EQUALS(valuePtr->Get<int>(), static_cast<int>(DevelVisual::FILL), TEST_LOCATION);
+  DALI_TEST_CHECK(descriptorMap.Find(Visual::Property::MIX_COLOR));
+
+  tet_printf("Check the visuals are the same as the visual created with the map\n");
+  VisualFactory factory        = VisualFactory::Get();
+  Visual::Base  expectedVisual = factory.CreateVisual(propertyMap);
+  Property::Map expectedMap;
+  expectedVisual.CreatePropertyMap(expectedMap);
+
+  for(int i = 0; i < 2; ++i)
+  {
+    Visual::Base visual = factory.CreateVisual(descriptor);
+    DALI_TEST_CHECK(visual);
+
+    Property::Map resultMap;
+    visual.CreatePropertyMap(resultMap);
+
+    const Property::Index intIndices[] = {Visual::Property::TYPE,
+                                          ImageVisual::Property::FITTING_MODE,
+                                          ImageVisual::Property::WRAP_MODE_U,
+                                          ImageVisual::Property::RELEASE_POLICY};
+    for(auto index : intIndices)
+    {
+      DALI_TEST_CHECK(resultMap.Find(index) && expectedMap.Find(index));
+      DALI_TEST_EQUALS(resultMap.Find(index)->Get<int>(), expectedMap.Find(index)->Get<int>(), TEST_LOCATION);
+    }
+
+    const Property::Index stringIndices[] = {ImageVisual::Property::URL,
+                                             DevelVisual::Property::VISUAL_FITTING_MODE};
+    for(auto index : stringIndices)
+    {
+      DALI_TEST_CHECK(resultMap.Find(index) && expectedMap.Find(index));
+      DALI_TEST_EQUALS(resultMap.Find(index)->Get<std::string>(), expectedMap.Find(index)->Get<std::string>(), TEST_LOCATION);
+    }
+
+    DALI_TEST_EQUALS(resultMap.Find(Visual::Property::MIX_COLOR)->Get<Vector4>(), Color::BLUE, TEST_LOCATION);
+
+    DummyControl actor = DummyControl::New(true);
+    if(i == 0)
+    {
+      TestVisualAsynchronousRender(application, actor, visual);
+    }
+    else
+    {
+      // We will use cached image.
+      TestVisualRender(application, actor, visual);
+    }
+  }
+
+  tet_printf("Check the creation options are applied when the visual is created\n");
+  Property::Map gifMap;
+  gifMap.Add(Toolkit::Visual::Property::TYPE, Visual::IMAGE)
+    .Add(ImageVisual::Property::URL, TEST_GIF_FILE_NAME);
+  VisualDescriptor gifDescriptor = VisualDescriptor::New(gifMap);
+
+  Visual::Base  gifVisual = factory.CreateVisual(gifDescriptor);
+  Property::Map gifResultMap;
+  gifVisual.CreatePropertyMap(gifResultMap);
+  DALI_TEST_EQUALS(gifResultMap.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::ANIMATED_IMAGE), TEST_LOCATION);
+
+  gifVisual = factory.CreateVisual(gifDescriptor, VisualFactory::CreationOptions::IMAGE_VISUAL_LOAD_STATIC_IMAGES_ONLY);
+  gifResultMap.Clear();
+  gifVisual.CreatePropertyMap(gifResultMap);
+  DALI_TEST_EQUALS(gifResultMap.Find(Visual::Property::TYPE)->Get<int>(), static_cast<int>(Visual::IMAGE), TEST_LOCATION);
+
+  tet_printf("Check an empty url creates no visual\n");
+  Property::Map emptyMap;
+  emptyMap.Add(Toolkit::Visual::Property::TYPE, Visual::IMAGE);
+  DALI_TEST_CHECK(!factory.CreateVisual(VisualDescriptor::New(emptyMap)));
+
+  END_TEST;
+}
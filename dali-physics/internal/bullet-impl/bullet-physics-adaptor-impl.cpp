@@ -38,20 +38,31 @@ Debug::Filter* gLogFilter = Debug::Filter::New(Debug::Concise, false, "LOG_PHYSI
 
 namespace Dali::Toolkit::Physics::Internal
 {
-PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize)
+PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize, Physics::PhysicsAdaptor::WorldThreading threading)
 {
-  PhysicsAdaptorPtr adaptor(new BulletPhysicsAdaptor());
+  // Bullet treats the first thread that asks for its thread index as the main thread,
+  // which is the only one allowed to install a task scheduler. Claim it for the event thread.
+  btGetCurrentThreadIndex();
+
+  PhysicsAdaptorPtr adaptor(new BulletPhysicsAdaptor(threading));
   adaptor->Initialize(transform, worldSize);
   return adaptor;
 }
 
-BulletPhysicsAdaptor::BulletPhysicsAdaptor()
-: PhysicsAdaptor()
+BulletPhysicsAdaptor::BulletPhysicsAdaptor(Physics::PhysicsAdaptor::WorldThreading threading)
+: PhysicsAdaptor(),
+  mWorldThreading(threading)
 {
 }
 
 BulletPhysicsAdaptor::~BulletPhysicsAdaptor()
 {
+  // Stop the integration thread before the debug renderer and the actors are destroyed
+  if(mPhysicsWorld)
+  {
+    mPhysicsWorld->SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode::UPDATE_THREAD, nullptr);
+  }
+
   // @todo Ensure physics bodies don't leak
 }
 
@@ -64,7 +75,8 @@ void BulletPhysicsAdaptor::OnInitialize(const Dali::Matrix& transform, Uint16Pai
 
   mPhysicsWorld = BulletPhysicsWorld::New(mRootActor,
                                           Dali::MakeCallback(mSlotDelegate.GetSlot(),
-                                                             &PhysicsAdaptor::OnUpdateActors));
+                                                             &PhysicsAdaptor::OnUpdateActors),
+                                          mWorldThreading);
 }
 
 Layer BulletPhysicsAdaptor::CreateDebugLayer(Dali::Window window)
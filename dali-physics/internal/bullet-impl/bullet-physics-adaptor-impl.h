@@ -29,7 +29,7 @@ class PhysicsDebugRenderer;
 class BulletPhysicsAdaptor : public PhysicsAdaptor
 {
 public:
-  BulletPhysicsAdaptor();
+  explicit BulletPhysicsAdaptor(Physics::PhysicsAdaptor::WorldThreading threading);
 
   /**
    * A reference counted object may only be deleted by calling Unreference()
@@ -114,8 +114,9 @@ public:
   Dali::Vector3 ProjectPoint(Dali::Vector3 origin, Dali::Vector3 direction, float distance) override;
 
 private:
-  Actor                                 mDebugActor;
-  std::unique_ptr<PhysicsDebugRenderer> mDebugRenderer;
+  Actor                                   mDebugActor;
+  std::unique_ptr<PhysicsDebugRenderer>   mDebugRenderer;
+  Physics::PhysicsAdaptor::WorldThreading mWorldThreading;
 };
 
 } // namespace Dali::Toolkit::Physics::Internal
@@ -18,26 +18,31 @@
 #include <dali-physics/internal/bullet-impl/bullet-physics-world-impl.h>
 
 // External Headers
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 #include <BulletCollision/NarrowPhaseCollision/btRaycastCallback.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 #include <btBulletCollisionCommon.h>
 #include <memory>
 
 // Internal Headers
+#include <dali-physics/internal/bullet-impl/bullet-task-scheduler.h>
 #include <dali/dali.h>
 #include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/integration-api/debug.h>
 
 namespace Dali::Toolkit::Physics::Internal
 {
-std::unique_ptr<PhysicsWorld> BulletPhysicsWorld::New(Dali::Actor rootActor, Dali::CallbackBase* updateCallback)
+std::unique_ptr<PhysicsWorld> BulletPhysicsWorld::New(Dali::Actor rootActor, Dali::CallbackBase* updateCallback, Physics::PhysicsAdaptor::WorldThreading threading)
 {
-  std::unique_ptr<BulletPhysicsWorld> world = std::make_unique<BulletPhysicsWorld>(rootActor, updateCallback);
+  std::unique_ptr<BulletPhysicsWorld> world = std::make_unique<BulletPhysicsWorld>(rootActor, updateCallback, threading);
   world->Initialize();
   return world;
 }
 
-BulletPhysicsWorld::BulletPhysicsWorld(Dali::Actor rootActor, Dali::CallbackBase* updateCallback)
-: PhysicsWorld(rootActor, updateCallback)
+BulletPhysicsWorld::BulletPhysicsWorld(Dali::Actor rootActor, Dali::CallbackBase* updateCallback, Physics::PhysicsAdaptor::WorldThreading threading)
+: PhysicsWorld(rootActor, updateCallback),
+  mWorldThreading(threading)
 {
 }
 
@@ -46,14 +51,40 @@ void BulletPhysicsWorld::OnInitialize(/*void* dynamicsWorld*/)
   // @todo Should enable developer to supply their own created DynamicsWorld.
 
   mCollisionConfiguration = new btDefaultCollisionConfiguration();
-  mDispatcher             = new btCollisionDispatcher(mCollisionConfiguration);
   mBroadphase             = new btDbvtBroadphase();
-  mSolver                 = new btSequentialImpulseConstraintSolver;
-  mDynamicsWorld          = new btDiscreteDynamicsWorld(mDispatcher, mBroadphase, mSolver, mCollisionConfiguration);
+
+  // The Mt classes need bullet's task scheduler to be installed before they are created
+  BulletTaskScheduler* scheduler{nullptr};
+  if(mWorldThreading == Physics::PhysicsAdaptor::WorldThreading::MULTI_THREADED)
+  {
+#if BT_THREADSAFE
+    scheduler = BulletTaskScheduler::Get();
+#endif
+    if(!scheduler)
+    {
+      DALI_LOG_ERROR("Unable to create a multithreaded physics world, using a single threaded world\n");
+    }
+  }
+
+  if(scheduler)
+  {
+    mDispatcher    = new btCollisionDispatcherMt(mCollisionConfiguration);
+    mSolverPool    = new btConstraintSolverPoolMt(scheduler->getMaxNumThreads());
+    mSolver        = new btSequentialImpulseConstraintSolverMt;
+    mDynamicsWorld = new btDiscreteDynamicsWorldMt(mDispatcher, mBroadphase, mSolverPool, mSolver, mCollisionConfiguration);
+  }
+  else
+  {
+    mDispatcher    = new btCollisionDispatcher(mCollisionConfiguration);
+    mSolver        = new btSequentialImpulseConstraintSolver;
+    mDynamicsWorld = new btDiscreteDynamicsWorld(mDispatcher, mBroadphase, mSolver, mCollisionConfiguration);
+  }
 }
 
 BulletPhysicsWorld::~BulletPhysicsWorld()
 {
+  StopIntegrationThread();
+
   Lock();
 
   if(mDynamicsWorld)
@@ -80,6 +111,7 @@ BulletPhysicsWorld::~BulletPhysicsWorld()
 
   delete mDynamicsWorld;
   delete mSolver;
+  delete mSolverPool;
   delete mBroadphase;
   delete mDispatcher;
   delete mCollisionConfiguration;
@@ -24,6 +24,7 @@
 #include <dali-physics/internal/physics-world-impl.h>
 #include <dali-physics/public-api/physics-adaptor.h>
 
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 #include <btBulletDynamicsCommon.h>
 
 namespace Dali::Toolkit::Physics::Internal
@@ -34,9 +35,9 @@ class FrameCallback;
 class BulletPhysicsWorld : public PhysicsWorld
 {
 public:
-  static std::unique_ptr<PhysicsWorld> New(Dali::Actor rootActor, Dali::CallbackBase* updateCallback);
+  static std::unique_ptr<PhysicsWorld> New(Dali::Actor rootActor, Dali::CallbackBase* updateCallback, Physics::PhysicsAdaptor::WorldThreading threading);
 
-  BulletPhysicsWorld(Dali::Actor rootActor, Dali::CallbackBase* updateCallback);
+  BulletPhysicsWorld(Dali::Actor rootActor, Dali::CallbackBase* updateCallback, Physics::PhysicsAdaptor::WorldThreading threading);
   ~BulletPhysicsWorld();
 
   void OnInitialize(/*void* dynamicsWorld*/) override;
@@ -63,6 +64,9 @@ private:
   btDefaultCollisionConfiguration*     mCollisionConfiguration{nullptr};
   btBroadphaseInterface*               mBroadphase{nullptr};
   btSequentialImpulseConstraintSolver* mSolver{nullptr};
+  btConstraintSolverPoolMt*            mSolverPool{nullptr};
+
+  Physics::PhysicsAdaptor::WorldThreading mWorldThreading;
 };
 
 } // namespace Dali::Toolkit::Physics::Internal
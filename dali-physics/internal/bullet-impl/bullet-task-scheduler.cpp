@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Class Header
+#include <dali-physics/internal/bullet-impl/bullet-task-scheduler.h>
+
+// External Headers
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Internal Headers
+#include <dali/integration-api/debug.h>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+namespace
+{
+// Leave bullet thread indices for the event, update and integration threads.
+constexpr uint32_t MAX_WORKER_THREAD_COUNT{15u};
+} // namespace
+
+BulletTaskScheduler* BulletTaskScheduler::Get()
+{
+  static std::unique_ptr<BulletTaskScheduler> gScheduler{nullptr};
+  static std::once_flag                       onceFlag;
+
+  std::call_once(onceFlag, [&scheduler = gScheduler] {
+    // btSetTaskScheduler() silently ignores any thread but the first one that bullet has seen.
+    if(btGetCurrentThreadIndex() != 0u)
+    {
+      DALI_LOG_ERROR("Bullet task scheduler must be installed from bullet's main thread\n");
+      return;
+    }
+
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    const uint32_t workerCount     = std::clamp(hardwareThreads > 1u ? hardwareThreads - 1u : 1u, 1u, MAX_WORKER_THREAD_COUNT);
+
+    scheduler = std::make_unique<BulletTaskScheduler>(workerCount);
+    btSetTaskScheduler(scheduler.get());
+  });
+
+  return gScheduler.get();
+}
+
+BulletTaskScheduler::BulletTaskScheduler(uint32_t workerCount)
+: btITaskScheduler("DaliThreadPool")
+{
+  mThreadPool.Initialize(workerCount);
+  mNumThreads = static_cast<int>(workerCount) + 1;
+}
+
+int BulletTaskScheduler::getMaxNumThreads() const
+{
+  return static_cast<int>(BT_MAX_THREAD_COUNT);
+}
+
+int BulletTaskScheduler::getNumThreads() const
+{
+  return static_cast<int>(BT_MAX_THREAD_COUNT);
+}
+
+void BulletTaskScheduler::setNumThreads(int numThreads)
+{
+  // The pool threads, plus the calling thread
+  mNumThreads = std::clamp(numThreads, 1, static_cast<int>(mThreadPool.GetWorkerCount()) + 1);
+}
+
+void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body)
+{
+  grainSize = std::max(grainSize, 1);
+
+  const int threadCount = BeginLoop(iBegin, iEnd, grainSize);
+  if(threadCount == 0)
+  {
+    body.forLoop(iBegin, iEnd);
+    return;
+  }
+
+  // Each thread takes the next job until all of them are done
+  std::atomic<int> nextJob{iBegin};
+  Dispatch(threadCount, [&](uint32_t) {
+    for(int begin = nextJob.fetch_add(grainSize); begin < iEnd; begin = nextJob.fetch_add(grainSize))
+    {
+      body.forLoop(begin, std::min(begin + grainSize, iEnd));
+    }
+  });
+
+  mLoopRunning.clear();
+}
+
+btScalar BulletTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body)
+{
+  grainSize = std::max(grainSize, 1);
+
+  const int threadCount = BeginLoop(iBegin, iEnd, grainSize);
+  if(threadCount == 0)
+  {
+    return body.sumLoop(iBegin, iEnd);
+  }
+
+  // Each thread adds up its own jobs, then the partial sums are added up here
+  std::vector<btScalar> sums(threadCount, btScalar(0));
+  std::atomic<int>      nextJob{iBegin};
+  std::atomic<int>      nextSum{0};
+  Dispatch(threadCount, [&](uint32_t) {
+    btScalar& sum = sums[nextSum.fetch_add(1)];
+    for(int begin = nextJob.fetch_add(grainSize); begin < iEnd; begin = nextJob.fetch_add(grainSize))
+    {
+      sum += body.sumLoop(begin, std::min(begin + grainSize, iEnd));
+    }
+  });
+
+  mLoopRunning.clear();
+
+  btScalar total(0);
+  for(auto sum : sums)
+  {
+    total += sum;
+  }
+  return total;
+}
+
+int BulletTaskScheduler::BeginLoop(int iBegin, int iEnd, int grainSize)
+{
+  const int jobCount    = (iEnd - iBegin + grainSize - 1) / grainSize;
+  const int threadCount = std::min(jobCount, mNumThreads);
+  if(threadCount < 2 || mLoopRunning.test_and_set())
+  {
+    return 0;
+  }
+  return threadCount;
+}
+
+void BulletTaskScheduler::Dispatch(int threadCount, const Dali::Task& task)
+{
+  std::vector<Dali::Task> tasks(threadCount - 1, task);
+  auto                    future = mThreadPool.SubmitTasks(tasks, 0);
+  task(0u);
+  future->Wait();
+}
+
+} // namespace Dali::Toolkit::Physics::Internal
@@ -0,0 +1,102 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// External includes
+#include <LinearMath/btThreads.h>
+#include <dali/devel-api/threading/thread-pool.h>
+
+#include <atomic>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+/**
+ * Bullet task scheduler that runs the parallel loops of the multithreaded
+ * dynamics world on a DALi thread pool.
+ *
+ * The calling thread always takes part in the loop, so a loop never waits
+ * for a pool thread to wake up before any work is done. Nested loops are
+ * run serially on the calling thread.
+ *
+ * Bullet keeps per-thread storage indexed by btGetCurrentThreadIndex(), sized
+ * by getNumThreads(). Any thread may step a world, and bullet hands out a new
+ * index to each of them, so the reported thread count is BT_MAX_THREAD_COUNT.
+ */
+class BulletTaskScheduler : public btITaskScheduler
+{
+public:
+  /**
+   * Get the task scheduler, installing it as bullet's task scheduler on first use.
+   *
+   * Bullet only allows its main thread to install a task scheduler, so this
+   * should be called in the event thread.
+   * @return The task scheduler, or nullptr if it couldn't be installed.
+   */
+  static BulletTaskScheduler* Get();
+
+  /**
+   * Constructor
+   * @param[in] workerCount The number of threads in the pool
+   */
+  explicit BulletTaskScheduler(uint32_t workerCount);
+
+  /**
+   * @copydoc btITaskScheduler::getMaxNumThreads()
+   * @note This is the number of bullet thread indices, not the number of threads in a loop.
+   */
+  int getMaxNumThreads() const override;
+
+  /**
+   * @copydoc btITaskScheduler::getNumThreads()
+   * @note As getMaxNumThreads(), as bullet sizes its per-thread storage with it.
+   */
+  int getNumThreads() const override;
+
+  /**
+   * @copydoc btITaskScheduler::setNumThreads()
+   * @note This limits the number of threads which take part in a loop.
+   */
+  void setNumThreads(int numThreads) override;
+
+  void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+
+  btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+private:
+  /**
+   * Try to start a parallel loop.
+   * @param[in] iBegin The start of the loop
+   * @param[in] iEnd The end of the loop
+   * @param[in] grainSize The number of iterations of each job
+   * @return The number of threads to run the loop on, or 0 if it should be run serially.
+   */
+  int BeginLoop(int iBegin, int iEnd, int grainSize);
+
+  /**
+   * Run the task on the given number of threads, including the calling thread, and wait for all of them.
+   * @param[in] threadCount The number of threads to run the task on
+   * @param[in] task The task
+   */
+  void Dispatch(int threadCount, const Dali::Task& task);
+
+private:
+  Dali::ThreadPool mThreadPool;
+  int              mNumThreads; ///< The number of threads which take part in a loop, including the calling thread
+  std::atomic_flag mLoopRunning = ATOMIC_FLAG_INIT;
+};
+
+} // namespace Dali::Toolkit::Physics::Internal
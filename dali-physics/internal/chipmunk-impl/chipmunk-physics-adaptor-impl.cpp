@@ -40,8 +40,9 @@ inline cpVect ConvertVector(Dali::Vector3 vector)
 
 namespace Dali::Toolkit::Physics::Internal
 {
-PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize)
+PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize, Physics::PhysicsAdaptor::WorldThreading /*threading*/)
 {
+  // Chipmunk spaces are always single threaded
   PhysicsAdaptorPtr adaptor(new ChipmunkPhysicsAdaptor());
   adaptor->Initialize(transform, worldSize);
   return adaptor;
@@ -54,6 +55,12 @@ ChipmunkPhysicsAdaptor::ChipmunkPhysicsAdaptor()
 
 ChipmunkPhysicsAdaptor::~ChipmunkPhysicsAdaptor()
 {
+  // Stop the integration thread before the debug renderer and the actors are destroyed
+  if(mPhysicsWorld)
+  {
+    mPhysicsWorld->SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode::UPDATE_THREAD, nullptr);
+  }
+
   // @todo Ensure physics bodies don't leak
 }
 
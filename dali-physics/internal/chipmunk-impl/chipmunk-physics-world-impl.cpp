@@ -90,6 +90,8 @@ void ChipmunkPhysicsWorld::OnInitialize(/*void* dynamicsWorld*/)
 
 ChipmunkPhysicsWorld::~ChipmunkPhysicsWorld()
 {
+  StopIntegrationThread();
+
   Lock();
   if(mSpace)
   {
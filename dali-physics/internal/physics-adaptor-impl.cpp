@@ -18,6 +18,7 @@
 #include <dali-physics/internal/physics-adaptor-impl.h>
 
 // External Headers
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -98,6 +99,16 @@ Physics::PhysicsAdaptor::DebugState PhysicsAdaptor::GetDebugState() const
   return mPhysicsWorld->GetDebugState();
 }
 
+void PhysicsAdaptor::SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode mode)
+{
+  mPhysicsWorld->SetIntegrationMode(mode, [this]() { OnPublishActors(); });
+}
+
+Physics::PhysicsAdaptor::IntegrationMode PhysicsAdaptor::GetIntegrationMode() const
+{
+  return mPhysicsWorld->GetIntegrationMode();
+}
+
 Dali::Actor PhysicsAdaptor::GetRootActor() const
 {
   return mRootActor;
@@ -105,6 +116,22 @@ Dali::Actor PhysicsAdaptor::GetRootActor() const
 
 void PhysicsAdaptor::OnUpdateActors(Dali::UpdateProxy* updateProxy)
 {
+  if(mPhysicsWorld->GetIntegrationMode() == Physics::PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD)
+  {
+    // Interpolate between the last two integration steps, without locking the physics world
+    const PhysicsTransformBuffer::State* state = mTransformBuffer.GetReadState();
+    if(state)
+    {
+      const float alpha = PhysicsTransformBuffer::GetInterpolationFactor(*state, PhysicsTransformBuffer::Clock::now());
+      for(auto&& body : state->bodies)
+      {
+        updateProxy->BakePosition(body.actorId, body.previousPosition + (body.position - body.previousPosition) * alpha);
+        updateProxy->BakeOrientation(body.actorId, Quaternion::Slerp(body.previousRotation, body.rotation, alpha));
+      }
+    }
+    return;
+  }
+
   for(auto&& actor : mPhysicsActors)
   {
     // Get position, orientation from physics world.
@@ -115,6 +142,47 @@ void PhysicsAdaptor::OnUpdateActors(Dali::UpdateProxy* updateProxy)
   }
 }
 
+void PhysicsAdaptor::OnPublishActors()
+{
+  PhysicsTransformBuffer::State& state = mTransformBuffer.GetWriteState();
+  state.bodies.clear();
+  for(auto&& actor : mPhysicsActors)
+  {
+    PhysicsTransformBuffer::BodyTransform transform;
+    transform.actorId  = actor.first;
+    transform.position = actor.second->GetActorPosition();
+    transform.rotation = actor.second->GetActorRotation();
+
+    auto iter = mLastPublished.find(actor.first);
+    if(iter != mLastPublished.end())
+    {
+      transform.previousPosition = iter->second.position;
+      transform.previousRotation = iter->second.rotation;
+      iter->second               = transform;
+    }
+    else
+    {
+      transform.previousPosition = transform.position;
+      transform.previousRotation = transform.rotation;
+      mLastPublished.emplace(actor.first, transform);
+    }
+    state.bodies.push_back(transform);
+  }
+
+  // Forget the transforms of actors that have been removed
+  if(mLastPublished.size() > mPhysicsActors.size())
+  {
+    for(auto iter = mLastPublished.begin(); iter != mLastPublished.end();)
+    {
+      iter = mPhysicsActors.count(iter->first) ? std::next(iter) : mLastPublished.erase(iter);
+    }
+  }
+
+  state.stepTime = PhysicsTransformBuffer::Clock::now();
+  state.timestep = mPhysicsWorld->GetTimestep();
+  mTransformBuffer.Publish();
+}
+
 void PhysicsAdaptor::Queue(std::function<void()> function)
 {
   mPhysicsWorld->Queue(function);
@@ -24,6 +24,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-physics/internal/physics-actor-impl.h>
+#include <dali-physics/internal/physics-transform-buffer.h>
 #include <dali-physics/internal/physics-world-impl.h>
 #include <dali-physics/public-api/physics-adaptor.h>
 
@@ -37,7 +38,7 @@ class PhysicsDebugRenderer;
 using PhysicsAdaptorPtr = IntrusivePtr<PhysicsAdaptor>;
 
 // Declaration of factory function, implemented by derived class
-PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize);
+PhysicsAdaptorPtr CreateNewPhysicsAdaptor(const Dali::Matrix& transform, Uint16Pair worldSize, Physics::PhysicsAdaptor::WorldThreading threading);
 
 class PhysicsAdaptor : public BaseObject
 {
@@ -134,6 +135,16 @@ public:
    */
   Physics::PhysicsAdaptor::DebugState GetDebugState() const;
 
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::SetIntegrationMode
+   */
+  void SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode mode);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetIntegrationMode
+   */
+  Physics::PhysicsAdaptor::IntegrationMode GetIntegrationMode() const;
+
   /**
    * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::AddActorBody
    */
@@ -179,12 +190,20 @@ public:
    */
   void OnUpdateActors(Dali::UpdateProxy* updateProxy);
 
+  /**
+   * Publish the transforms of all of the known bound actors after an integration step.
+   * Called in the integration thread with the physics world locked.
+   */
+  void OnPublishActors();
+
   std::unique_ptr<PhysicsWorld>& GetPhysicsWorld();
 
 protected:
-  std::unique_ptr<PhysicsWorld>                 mPhysicsWorld;
-  std::unordered_map<uint32_t, PhysicsActorPtr> mPhysicsActors;
-  Dali::Actor                                   mRootActor;
+  std::unique_ptr<PhysicsWorld>                                       mPhysicsWorld;
+  std::unordered_map<uint32_t, PhysicsActorPtr>                       mPhysicsActors;
+  PhysicsTransformBuffer                                              mTransformBuffer;
+  std::unordered_map<uint32_t, PhysicsTransformBuffer::BodyTransform> mLastPublished; ///< Only accessed in the integration thread
+  Dali::Actor                                                         mRootActor;
 
   Dali::Matrix     mTransform;
   Dali::Matrix     mInverseTransform;
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Class Header
+#include <dali-physics/internal/physics-integration-thread.h>
+
+// External Headers
+#include <algorithm>
+
+// Internal Headers
+#include <dali-physics/internal/physics-world-impl.h>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+namespace
+{
+/**
+ * The most integration steps a world may fall behind. If the solver can't keep up,
+ * the remaining time is dropped rather than stepping the world back to back.
+ */
+constexpr int MAX_CATCH_UP_STEPS{8};
+} // namespace
+
+PhysicsIntegrationThread& PhysicsIntegrationThread::Get()
+{
+  static PhysicsIntegrationThread gIntegrationThread;
+  return gIntegrationThread;
+}
+
+PhysicsIntegrationThread::PhysicsIntegrationThread()
+: mThread(&PhysicsIntegrationThread::Run, this)
+{
+}
+
+PhysicsIntegrationThread::~PhysicsIntegrationThread()
+{
+  {
+    std::scoped_lock<std::mutex> lock(mMutex);
+    mStopping = true;
+  }
+  mCondition.notify_all();
+  mThread.join();
+}
+
+void PhysicsIntegrationThread::Add(PhysicsWorld& world)
+{
+  {
+    std::scoped_lock<std::mutex> lock(mMutex);
+    mWorlds.push_back(Entry{&world, Clock::now()});
+  }
+  mCondition.notify_all();
+}
+
+void PhysicsIntegrationThread::Remove(PhysicsWorld& world)
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mWorlds.erase(std::remove_if(mWorlds.begin(), mWorlds.end(), [&world](const Entry& entry) { return entry.world == &world; }), mWorlds.end());
+  mCondition.notify_all();
+  mCondition.wait(lock, [this, &world]() { return mStepping != &world; });
+}
+
+void PhysicsIntegrationThread::Run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(!mStopping)
+  {
+    if(mWorlds.empty())
+    {
+      mCondition.wait(lock);
+      continue;
+    }
+
+    auto next = std::min_element(mWorlds.begin(), mWorlds.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.nextStep < rhs.nextStep; });
+    if(Clock::now() < next->nextStep)
+    {
+      // Worlds may have been added or removed while waiting, so look again
+      mCondition.wait_until(lock, next->nextStep);
+      continue;
+    }
+
+    PhysicsWorld* world = next->world;
+    mStepping           = world;
+    lock.unlock();
+
+    const float timestep = world->IntegrateDedicated();
+
+    lock.lock();
+    mStepping = nullptr;
+    mCondition.notify_all();
+
+    // Keep a fixed rate, but don't try to catch up with more than a few steps
+    auto entry = std::find_if(mWorlds.begin(), mWorlds.end(), [world](const Entry& entry) { return entry.world == world; });
+    if(entry != mWorlds.end())
+    {
+      const auto stepDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(timestep));
+      const auto now          = Clock::now();
+      entry->nextStep += stepDuration;
+      if(now - entry->nextStep > stepDuration * MAX_CATCH_UP_STEPS)
+      {
+        entry->nextStep = now;
+      }
+    }
+  }
+}
+
+} // namespace Dali::Toolkit::Physics::Internal
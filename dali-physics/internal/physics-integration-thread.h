@@ -0,0 +1,91 @@
+#ifndef DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_INTEGRATION_THREAD_H
+#define DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_INTEGRATION_THREAD_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+class PhysicsWorld;
+
+/**
+ * The thread which steps the physics worlds in DEDICATED_THREAD mode.
+ *
+ * One thread is shared by every world and lives until the library is
+ * unloaded, so changing the integration mode never creates a new thread.
+ * This matters for bullet, which gives each new thread that runs its code
+ * a new index, and runs out of them after BT_MAX_THREAD_COUNT threads.
+ */
+class PhysicsIntegrationThread
+{
+public:
+  /**
+   * Get the integration thread, starting it on first use.
+   * @return The integration thread
+   */
+  static PhysicsIntegrationThread& Get();
+
+  /**
+   * Destructor. Stops the thread.
+   */
+  ~PhysicsIntegrationThread();
+
+  /**
+   * Start stepping the world at its own timestep.
+   * @param[in] world The world to step
+   */
+  void Add(PhysicsWorld& world);
+
+  /**
+   * Stop stepping the world. Waits for any step of the world in progress to finish.
+   * @param[in] world The world to stop stepping
+   */
+  void Remove(PhysicsWorld& world);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry
+  {
+    PhysicsWorld*     world;
+    Clock::time_point nextStep;
+  };
+
+  PhysicsIntegrationThread();
+
+  /**
+   * Main loop of the thread, stepping the world which is due first.
+   */
+  void Run();
+
+private:
+  std::vector<Entry>      mWorlds;             ///< The worlds to step, guarded by mMutex
+  PhysicsWorld*           mStepping{nullptr};  ///< The world being stepped, guarded by mMutex
+  bool                    mStopping{false};    ///< Guarded by mMutex
+  std::mutex              mMutex;
+  std::condition_variable mCondition;
+  std::thread             mThread;
+};
+
+} // namespace Dali::Toolkit::Physics::Internal
+
+#endif //DALI_TOOLKIT_PHYSICS_INTERNAL_PHYSICS_INTEGRATION_THREAD_H
@@ -0,0 +1,130 @@
+#ifndef DALI_TOOLKIT_PHYSICS_INTERNAL_TRANSFORM_BUFFER_H
+#define DALI_TOOLKIT_PHYSICS_INTERNAL_TRANSFORM_BUFFER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Dali::Toolkit::Physics::Internal
+{
+/**
+ * Hands off the actor transforms from the physics integration thread to the
+ * update thread without locking.
+ *
+ * Each published state holds the previous and the current transform of every
+ * body, so that the reader can interpolate between the last two integration
+ * steps. The writer and the reader each own one of three states, and exchange
+ * theirs with the latest published state atomically; neither ever waits for
+ * the other.
+ */
+class PhysicsTransformBuffer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * The transform of a single body, in actor space.
+   */
+  struct BodyTransform
+  {
+    uint32_t         actorId;
+    Dali::Vector3    previousPosition;
+    Dali::Vector3    position;
+    Dali::Quaternion previousRotation;
+    Dali::Quaternion rotation;
+  };
+
+  /**
+   * The transforms of all bodies after an integration step.
+   */
+  struct State
+  {
+    std::vector<BodyTransform> bodies;
+    Clock::time_point          stepTime;
+    float                      timestep{0.0f};
+  };
+
+  /**
+   * Get the state that the writer should fill in. Only call from the writer thread.
+   * @return The state to write
+   */
+  State& GetWriteState()
+  {
+    return mStates[mWriteIndex];
+  }
+
+  /**
+   * Publish the write state, and take ownership of another state to write into.
+   * Only call from the writer thread.
+   */
+  void Publish()
+  {
+    mWriteIndex = mLatest.exchange(mWriteIndex | NEW_STATE_FLAG) & INDEX_MASK;
+  }
+
+  /**
+   * Get the latest published state. Only call from the reader thread.
+   * @return The latest state, or nullptr if nothing has been published yet.
+   */
+  const State* GetReadState()
+  {
+    if(mLatest.load() & NEW_STATE_FLAG)
+    {
+      mReadIndex = mLatest.exchange(mReadIndex) & INDEX_MASK;
+      mHasRead   = true;
+    }
+    return mHasRead ? &mStates[mReadIndex] : nullptr;
+  }
+
+  /**
+   * Get how far between the previous and the current transforms of the state the given time is.
+   * @param[in] state The state to interpolate
+   * @param[in] now The time to interpolate to
+   * @return The interpolation factor, between 0 and 1
+   */
+  static float GetInterpolationFactor(const State& state, Clock::time_point now)
+  {
+    if(state.timestep <= 0.0f)
+    {
+      return 1.0f;
+    }
+    float elapsed = std::chrono::duration<float>(now - state.stepTime).count();
+    float alpha   = elapsed / state.timestep;
+    return alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+  }
+
+private:
+  static constexpr uint8_t INDEX_MASK{0x03};
+  static constexpr uint8_t NEW_STATE_FLAG{0x04};
+
+  std::array<State, 3> mStates;
+  std::atomic<uint8_t> mLatest{0};     ///< Index of the latest state, and whether the reader has seen it
+  uint8_t              mWriteIndex{1}; ///< Owned by the writer thread
+  uint8_t              mReadIndex{2};  ///< Owned by the reader thread
+  bool                 mHasRead{false};
+};
+
+} // namespace Dali::Toolkit::Physics::Internal
+
+#endif //DALI_TOOLKIT_PHYSICS_INTERNAL_TRANSFORM_BUFFER_H
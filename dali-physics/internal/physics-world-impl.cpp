@@ -18,14 +18,25 @@
 #include <dali-physics/internal/physics-world-impl.h>
 
 // External Headers
+#include <algorithm>
 
 // Internal Headers
+#include <dali-physics/internal/physics-integration-thread.h>
 #include <dali/dali.h>
 #include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/update/frame-callback-interface.h>
 
 thread_local int gLocked{0};
 
+namespace
+{
+/**
+ * The most integration steps to run to catch up with elapsed time. If the solver can't keep up,
+ * the remaining time is dropped rather than making the next frame even slower.
+ */
+constexpr int MAX_CATCH_UP_STEPS{8};
+} // namespace
+
 namespace Dali::Toolkit::Physics::Internal
 {
 /**
@@ -79,37 +90,50 @@ void PhysicsWorld::Initialize()
 
 PhysicsWorld::~PhysicsWorld()
 {
-  // Derived class's destructor should clean down physics objects under mutex lock
-  // On completion, can remove the callback.
+  // Derived class's destructor should stop the integration thread, then clean down
+  // physics objects under mutex lock. On completion, can remove the callback.
 
   Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), *mFrameCallback);
 }
 
 bool PhysicsWorld::OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
 {
-  ScopedLock lock(*this);
-
-  // Process command queue
+  // Queued functions become ready to run once their sync point is seen
   if(mNotifySyncPoint != Dali::UpdateProxy::INVALID_SYNC &&
      mNotifySyncPoint == updateProxy.PopSyncPoint())
   {
+    std::scoped_lock<std::mutex> queueLock(mQueueMutex);
     while(!commandQueue.empty())
     {
-      commandQueue.front()(); // Execute the queued methods
+      mReadyCommands.push(std::move(commandQueue.front()));
       commandQueue.pop();
     }
 
     mNotifySyncPoint = Dali::UpdateProxy::INVALID_SYNC;
   }
 
+  if(mIntegrationMode == Physics::PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD)
+  {
+    // The integration thread runs the ready functions. The actors are updated from
+    // the published transforms, so there is no need to lock the world.
+    if(mUpdateCallback)
+    {
+      Dali::CallbackBase::Execute(*mUpdateCallback, &updateProxy);
+    }
+    return true;
+  }
+
+  ScopedLock lock(*this);
+
+  ProcessCommands();
+
   // Perform as many integration steps as needed to handle elapsed time
-  static float frameTime = 0;
-  frameTime += elapsedSeconds;
-  do
+  mFrameTime = std::min(mFrameTime + elapsedSeconds, mPhysicsTimeStep * MAX_CATCH_UP_STEPS);
+  while(mFrameTime >= mPhysicsTimeStep)
   {
     Integrate(mPhysicsTimeStep);
-    frameTime -= mPhysicsTimeStep;
-  } while(frameTime > 0);
+    mFrameTime -= mPhysicsTimeStep;
+  }
 
   // Update the corresponding actors to their physics spaces
   if(mUpdateCallback)
@@ -121,6 +145,35 @@ bool PhysicsWorld::OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds
   return true;
 }
 
+void PhysicsWorld::ProcessCommands()
+{
+  std::queue<std::function<void(void)>> commands;
+  {
+    std::scoped_lock<std::mutex> queueLock(mQueueMutex);
+    std::swap(commands, mReadyCommands);
+  }
+
+  while(!commands.empty())
+  {
+    commands.front()(); // Execute the queued methods
+    commands.pop();
+  }
+}
+
+float PhysicsWorld::IntegrateDedicated()
+{
+  ScopedLock lock(*this);
+
+  const float timestep = mPhysicsTimeStep;
+  ProcessCommands();
+  Integrate(timestep);
+  if(mPublishFunction)
+  {
+    mPublishFunction();
+  }
+  return timestep;
+}
+
 void PhysicsWorld::SetTimestep(float timeStep)
 {
   mPhysicsTimeStep = timeStep;
@@ -156,7 +209,7 @@ void PhysicsWorld::Unlock()
 
 void PhysicsWorld::Queue(std::function<void(void)> function)
 {
-  ScopedLock lock(*this);
+  std::scoped_lock<std::mutex> queueLock(mQueueMutex);
   commandQueue.push(function);
 }
 
@@ -185,4 +238,38 @@ Physics::PhysicsAdaptor::DebugState PhysicsWorld::GetDebugState()
   return mPhysicsDebugState;
 }
 
+void PhysicsWorld::SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode mode, std::function<void(void)> publishFunction)
+{
+  if(mode == mIntegrationMode)
+  {
+    return;
+  }
+
+  if(mode == Physics::PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD)
+  {
+    // The integration thread isn't stepping this world, so the publish function can be replaced
+    mPublishFunction = std::move(publishFunction);
+    mIntegrationMode = mode;
+    PhysicsIntegrationThread::Get().Add(*this);
+  }
+  else
+  {
+    StopIntegrationThread();
+  }
+}
+
+Physics::PhysicsAdaptor::IntegrationMode PhysicsWorld::GetIntegrationMode()
+{
+  return mIntegrationMode;
+}
+
+void PhysicsWorld::StopIntegrationThread()
+{
+  if(mIntegrationMode == Physics::PhysicsAdaptor::IntegrationMode::DEDICATED_THREAD)
+  {
+    PhysicsIntegrationThread::Get().Remove(*this);
+  }
+  mIntegrationMode = Physics::PhysicsAdaptor::IntegrationMode::UPDATE_THREAD;
+}
+
 } // namespace Dali::Toolkit::Physics::Internal
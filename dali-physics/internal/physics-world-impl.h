@@ -23,6 +23,7 @@
 
 #include <dali-physics/public-api/physics-adaptor.h>
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -163,23 +164,60 @@ public:
    */
   Physics::PhysicsAdaptor::DebugState GetDebugState();
 
+  /**
+   * Set which thread runs the integration step.
+   * @param[in] mode The new integration mode
+   * @param[in] publishFunction In DEDICATED_THREAD mode, called after each integration
+   * step with the world locked, to publish the body transforms for the update thread.
+   */
+  void SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode mode, std::function<void(void)> publishFunction);
+
+  /**
+   * @copydoc Dali::Toolkit::Physics::PhysicsAdaptor::GetIntegrationMode
+   */
+  Physics::PhysicsAdaptor::IntegrationMode GetIntegrationMode();
+
 public:
   bool OnUpdate(Dali::UpdateProxy& updateProxy, float elapsedSeconds);
 
+  /**
+   * Run one integration step in the integration thread, and publish the result.
+   * @return The timestep that was integrated
+   */
+  float IntegrateDedicated();
+
 protected:
   virtual void Integrate(float timestep) = 0;
 
+  /**
+   * Stop stepping this world in the integration thread, if it is.
+   * Derived classes must call this before destroying the physics world.
+   */
+  void StopIntegrationThread();
+
+private:
+  /**
+   * Run the queued functions that have reached their sync point. Call with the world locked.
+   */
+  void ProcessCommands();
+
 protected:
   std::mutex                            mMutex;
+  std::mutex                            mQueueMutex; ///< Guards the command queues, so queueing never waits for integration
   std::queue<std::function<void(void)>> commandQueue;
+  std::queue<std::function<void(void)>> mReadyCommands; ///< Commands whose sync point has been seen, still to be run
   Dali::UpdateProxy::NotifySyncPoint    mNotifySyncPoint{Dali::UpdateProxy::INVALID_SYNC};
   Dali::CallbackBase*                   mUpdateCallback{nullptr};
   std::unique_ptr<FrameCallback>        mFrameCallback;
   Dali::Actor                           mRootActor;
 
   float                                     mPhysicsTimeStep{1.0 / 180.0};
+  float                                     mFrameTime{0.0f}; ///< Elapsed time not yet integrated in UPDATE_THREAD mode
   Physics::PhysicsAdaptor::IntegrationState mPhysicsIntegrateState{Physics::PhysicsAdaptor::IntegrationState::ON};
   Physics::PhysicsAdaptor::DebugState       mPhysicsDebugState{Physics::PhysicsAdaptor::DebugState::OFF};
+
+  std::atomic<Physics::PhysicsAdaptor::IntegrationMode> mIntegrationMode{Physics::PhysicsAdaptor::IntegrationMode::UPDATE_THREAD};
+  std::function<void(void)>                             mPublishFunction;
 };
 
 } // namespace Dali::Toolkit::Physics::Internal
@@ -38,7 +38,12 @@ PhysicsAdaptor& PhysicsAdaptor::operator=(PhysicsAdaptor&& handle) noexcept = de
 
 PhysicsAdaptor PhysicsAdaptor::New(const Dali::Matrix& transform, Uint16Pair size)
 {
-  Internal::PhysicsAdaptorPtr internal = Internal::CreateNewPhysicsAdaptor(transform, size);
+  return New(transform, size, WorldThreading::SINGLE_THREADED);
+}
+
+PhysicsAdaptor PhysicsAdaptor::New(const Dali::Matrix& transform, Uint16Pair size, WorldThreading threading)
+{
+  Internal::PhysicsAdaptorPtr internal = Internal::CreateNewPhysicsAdaptor(transform, size, threading);
   return PhysicsAdaptor(internal.Get());
 }
 
@@ -117,6 +122,16 @@ Physics::PhysicsAdaptor::DebugState PhysicsAdaptor::GetDebugState() const
   return GetImplementation(*this).GetDebugState();
 }
 
+void PhysicsAdaptor::SetIntegrationMode(Physics::PhysicsAdaptor::IntegrationMode mode)
+{
+  GetImplementation(*this).SetIntegrationMode(mode);
+}
+
+Physics::PhysicsAdaptor::IntegrationMode PhysicsAdaptor::GetIntegrationMode() const
+{
+  return GetImplementation(*this).GetIntegrationMode();
+}
+
 PhysicsActor PhysicsAdaptor::AddActorBody(Dali::Actor actor, Dali::Any body)
 {
   Internal::PhysicsActorPtr physicsActor = GetImplementation(*this).AddActorBody(actor, body);
@@ -65,6 +65,28 @@ public:
     ON
   };
 
+  /**
+   * @brief Enumeration to choose whether the physics world solves in parallel.
+   *
+   * @SINCE_2_3.34
+   */
+  enum class WorldThreading
+  {
+    SINGLE_THREADED, ///< The world runs collision detection and the solver in the integrating thread
+    MULTI_THREADED   ///< The world spreads collision detection and the solver over a thread pool
+  };
+
+  /**
+   * @brief Enumeration to choose which thread runs the integration step.
+   *
+   * @SINCE_2_3.34
+   */
+  enum class IntegrationMode
+  {
+    UPDATE_THREAD,   ///< Integrate in the update thread, as many steps as each frame needs
+    DEDICATED_THREAD ///< Integrate at a fixed rate in a separate thread; actors are interpolated between the last two steps
+  };
+
   /**
    * @brief Scoped accessor to the physics world.
    *
@@ -190,6 +212,21 @@ public:
    */
   static PhysicsAdaptor New(const Dali::Matrix& transform, Uint16Pair size);
 
+  /**
+   * @brief Initialize the physics system, choosing whether the world solves in parallel.
+   *
+   * @SINCE_2_3.34
+   * A MULTI_THREADED 3D world is a btDiscreteDynamicsWorldMt, which can still be
+   * accessed as a btDiscreteDynamicsWorld. It needs bullet to be built with
+   * BULLET3_THREADSAFE, otherwise a single threaded world is created. The 2D
+   * adaptor always creates a single threaded space.
+   * @note Create the adaptor in the event thread.
+   * @param[in] transform The transform matrix for DALi to Physics world space
+   * @param[in] size The size of the layer the physics actors will be drawn in
+   * @param[in] threading Whether the world solves in parallel
+   */
+  static PhysicsAdaptor New(const Dali::Matrix& transform, Uint16Pair size, WorldThreading threading);
+
   /**
    * @brief Downcasts a handle to PhysicsAdaptor handle.
    *
@@ -351,6 +388,30 @@ public:
    */
   DebugState GetDebugState() const;
 
+  /**
+   * @brief Set which thread runs the integration step.
+   *
+   * @SINCE_2_3.34
+   * In DEDICATED_THREAD mode, the solver cost no longer adds to the frame time,
+   * and the update thread never waits for the ScopedPhysicsAccessor. Actors
+   * follow their bodies one timestep behind, interpolated between the last two
+   * integration steps. Queued functions are run in the integration thread.
+   * @note This is UPDATE_THREAD by default
+   * @note In DEDICATED_THREAD mode, the physics world must only be accessed through the
+   * ScopedPhysicsAccessor, including PhysicsActor::GetPhysicsPosition() and similar.
+   * @note Don't call this whilst holding a ScopedPhysicsAccessor.
+   * @param[in] mode the new integration mode
+   */
+  void SetIntegrationMode(IntegrationMode mode);
+
+  /**
+   * @brief Get which thread runs the integration step.
+   *
+   * @SINCE_2_3.34
+   * @return the integration mode
+   */
+  IntegrationMode GetIntegrationMode() const;
+
   /**
    * @brief Add an actor / body pair.
    * @pre It's expected that the client has added the body to the physics world.
@@ -9,4 +9,4 @@ Description: Bullet Continuous Collision Detection and Physics Library
 Version: ${apiversion}
 Requires:
 Libs: -L${libdir} -lbullet3
-Cflags: -I${includedir}
\ No newline at end of file
+Cflags: -I${includedir} @BULLET3_CFLAGS@
\ No newline at end of file
@@ -24,10 +24,12 @@
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/object/base-object.h>
 
+#include <filesystem>
 #include <mutex>
 
 // INTERNAL INCLUDES
 #include <dali-scene3d/internal/common/image-resource-loader.h>
+#include <dali-scene3d/internal/common/model-disk-cache.h>
 #include <dali-scene3d/public-api/loader/load-result.h>
 #include <dali-scene3d/public-api/loader/scene-definition.h>
 
@@ -126,6 +128,24 @@ public:
     cache.isSceneLoading          = isSceneLoading;
   }
 
+  void SetDiskCacheDirectory(std::string directory)
+  {
+    Dali::Scene3D::Internal::ModelDiskCache::SetCacheDirectory(directory);
+  }
+
+  std::string GetDiskCacheDirectory()
+  {
+    return Dali::Scene3D::Internal::ModelDiskCache::GetCacheDirectory();
+  }
+
+  bool HasDiskCache(std::string modelUri)
+  {
+    auto cachePath = Dali::Scene3D::Internal::ModelDiskCache::GetCacheFilePath(modelUri);
+
+    std::error_code errorCode;
+    return !cachePath.empty() && std::filesystem::exists(cachePath, errorCode);
+  }
+
 protected:
   /**
    * A reference counted object may only be deleted by calling Unreference()
@@ -269,4 +289,22 @@ void ModelCacheManager::SetSceneLoading(std::string modelUri, bool isSceneLoadin
   impl.SetSceneLoading(modelUri, isSceneLoading);
 }
 
+void ModelCacheManager::SetDiskCacheDirectory(std::string directory)
+{
+  ModelCacheManager::Impl& impl = static_cast<ModelCacheManager::Impl&>(GetBaseObject());
+  impl.SetDiskCacheDirectory(directory);
+}
+
+std::string ModelCacheManager::GetDiskCacheDirectory()
+{
+  ModelCacheManager::Impl& impl = static_cast<ModelCacheManager::Impl&>(GetBaseObject());
+  return impl.GetDiskCacheDirectory();
+}
+
+bool ModelCacheManager::HasDiskCache(std::string modelUri)
+{
+  ModelCacheManager::Impl& impl = static_cast<ModelCacheManager::Impl&>(GetBaseObject());
+  return impl.HasDiskCache(modelUri);
+}
+
 } // namespace Dali::Scene3D::Internal
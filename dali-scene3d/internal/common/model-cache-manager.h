@@ -141,6 +141,27 @@ public:
    */
   void SetSceneLoading(std::string modelUri, bool isSceneLoading);
 
+  /**
+   * @brief Sets the directory of the on-disk cache, the second tier below the in-memory cache.
+   * Processed meshes of loaded models are written there, and reused by the next launch.
+   * @param[in] directory The directory path. An empty path disables the on-disk cache.
+   */
+  void SetDiskCacheDirectory(std::string directory);
+
+  /**
+   * @brief Retrieves the directory of the on-disk cache.
+   * @return The directory path, or an empty string if the on-disk cache is disabled.
+   */
+  std::string GetDiskCacheDirectory();
+
+  /**
+   * @brief Retrieves whether the on-disk cache has a file for the model with the given URI.
+   * The file is validated against the model when it is read.
+   * @param[in] modelUri The unique model URI with its absolute path.
+   * @return Whether the on-disk cache file of the model exists.
+   */
+  bool HasDiskCache(std::string modelUri);
+
 public:
   // Default copy and move operator
   ModelCacheManager(const ModelCacheManager& rhs) = default;
@@ -0,0 +1,457 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/common/model-disk-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/pixel-data-integ.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/loader/hash.h>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+namespace ModelDiskCache
+{
+namespace
+{
+constexpr char     CACHE_FILE_MAGIC[8]     = {'D', 'A', 'L', 'I', 'M', 'D', 'L', 'C'};
+constexpr uint32_t CACHE_FORMAT_VERSION    = 2u;
+constexpr char     CACHE_FILE_EXTENSION[]  = ".dmc";
+constexpr char     TEMPORARY_FILE_SUFFIX[] = ".XXXXXX";
+constexpr char     MODEL_CACHE_DIR_ENV[]   = "DALI_SCENE3D_MODEL_CACHE_DIR";
+
+static constexpr std::string_view EMBEDDED_DATA_PREFIX = "data:";
+
+std::mutex  gCacheDirectoryMutex;
+std::string gCacheDirectory;
+bool        gCacheDirectoryInitialized = false;
+
+struct CacheFileHeader
+{
+  char     magic[8];
+  uint32_t version;
+  uint32_t meshCount;
+  uint64_t sourceKey;
+};
+
+/**
+ * @brief Applies the size and the modification time of the file to the hash, so the cache is invalidated when it changes.
+ */
+void AddFileStamp(Dali::Scene3D::Loader::Hash& hash, const std::string& path)
+{
+  std::error_code errorCode;
+  auto            size = std::filesystem::file_size(path, errorCode);
+  hash.Add(static_cast<uint64_t>(errorCode ? 0u : size));
+
+  auto time = std::filesystem::last_write_time(path, errorCode);
+  hash.Add(static_cast<uint64_t>(errorCode ? 0 : time.time_since_epoch().count()));
+}
+
+uint64_t CalculateSourceKey(const std::string& modelUrl, const std::string& modelsPath, const Dali::Scene3D::Loader::ResourceBundle& resources)
+{
+  Dali::Scene3D::Loader::Hash hash;
+  hash.Add(modelUrl);
+  AddFileStamp(hash, modelUrl);
+
+  for(auto& buffer : resources.mBuffers)
+  {
+    if(!buffer.mUri.empty() && buffer.mUri.find(EMBEDDED_DATA_PREFIX.data()) != 0)
+    {
+      const std::string path = buffer.mResourcePath + buffer.mUri;
+      hash.Add(path);
+      AddFileStamp(hash, path);
+    }
+  }
+
+  for(auto& mesh : resources.mMeshes)
+  {
+    if(!mesh.first.mUri.empty())
+    {
+      const std::string path = modelsPath + mesh.first.mUri;
+      hash.Add(path);
+      AddFileStamp(hash, path);
+    }
+  }
+
+  hash.Add(static_cast<uint32_t>(resources.mMeshes.size()));
+  return hash;
+}
+
+/**
+ * @brief The mesh data read from the cache file.
+ */
+struct CachedMesh
+{
+  std::shared_ptr<Dali::Scene3D::Loader::MeshDefinition::RawData> rawData;
+  std::vector<float>                                              positionMin; ///< The bounds of the positions, computed by LoadRaw()
+  std::vector<float>                                              positionMax;
+};
+
+template<typename T>
+void WriteValue(std::ostream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadValue(std::istream& stream, T& value)
+{
+  return !!stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Checks whether the rest of the file has the given number of bytes, so that a broken size isn't allocated.
+ */
+bool CanRead(std::istream& stream, uint64_t size)
+{
+  const auto position = stream.tellg();
+  stream.seekg(0, std::ios::end);
+  const auto end = stream.tellg();
+  stream.seekg(position);
+  return position >= 0 && end >= position && size <= static_cast<uint64_t>(end - position);
+}
+
+void WriteBytes(std::ostream& stream, const void* data, uint64_t size)
+{
+  WriteValue(stream, size);
+  if(size > 0u)
+  {
+    stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+  }
+}
+
+template<typename T>
+void WriteVector(std::ostream& stream, const std::vector<T>& data)
+{
+  WriteBytes(stream, data.data(), data.size() * sizeof(T));
+}
+
+template<typename T>
+bool ReadVector(std::istream& stream, std::vector<T>& data)
+{
+  uint64_t size = 0u;
+  if(!ReadValue(stream, size) || size % sizeof(T) != 0u || !CanRead(stream, size))
+  {
+    return false;
+  }
+  data.resize(static_cast<size_t>(size / sizeof(T)));
+  return size == 0u || !!stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+}
+
+void WriteMesh(std::ostream& stream, const Dali::Scene3D::Loader::MeshDefinition& mesh)
+{
+  WriteVector(stream, mesh.mPositions.mBlob.mMin);
+  WriteVector(stream, mesh.mPositions.mBlob.mMax);
+
+  auto& raw = *mesh.mRawData;
+  WriteVector(stream, raw.mIndices);
+
+  WriteValue(stream, static_cast<uint32_t>(raw.mAttribs.size()));
+  for(auto& attrib : raw.mAttribs)
+  {
+    WriteBytes(stream, attrib.mName.data(), attrib.mName.size());
+    WriteValue(stream, static_cast<uint32_t>(attrib.mType));
+    WriteValue(stream, attrib.mNumElements);
+    WriteVector(stream, attrib.mData);
+  }
+
+  WriteValue(stream, static_cast<uint32_t>(raw.mBlendShapeBufferOffset));
+  WriteBytes(stream, raw.mBlendShapeUnnormalizeFactor.Begin(), raw.mBlendShapeUnnormalizeFactor.Count() * sizeof(float));
+
+  const bool hasBlendShapeData = !!raw.mBlendShapeData;
+  WriteValue(stream, static_cast<uint32_t>(hasBlendShapeData));
+  if(hasBlendShapeData)
+  {
+    auto pixelDataBuffer = Dali::Integration::GetPixelDataBuffer(raw.mBlendShapeData);
+    WriteValue(stream, raw.mBlendShapeData.GetWidth());
+    WriteValue(stream, raw.mBlendShapeData.GetHeight());
+    WriteValue(stream, static_cast<uint32_t>(raw.mBlendShapeData.GetPixelFormat()));
+    WriteBytes(stream, pixelDataBuffer.buffer, pixelDataBuffer.bufferSize);
+  }
+}
+
+bool ReadMesh(std::istream& stream, CachedMesh& mesh)
+{
+  if(!ReadVector(stream, mesh.positionMin) || !ReadVector(stream, mesh.positionMax))
+  {
+    return false;
+  }
+
+  mesh.rawData = std::make_shared<Dali::Scene3D::Loader::MeshDefinition::RawData>();
+  auto& raw    = *mesh.rawData;
+  if(!ReadVector(stream, raw.mIndices))
+  {
+    return false;
+  }
+
+  uint32_t attribCount = 0u;
+  if(!ReadValue(stream, attribCount))
+  {
+    return false;
+  }
+  raw.mAttribs.resize(attribCount);
+  for(auto& attrib : raw.mAttribs)
+  {
+    std::vector<char> name;
+    uint32_t          type = 0u;
+    if(!ReadVector(stream, name) || !ReadValue(stream, type) || !ReadValue(stream, attrib.mNumElements) || !ReadVector(stream, attrib.mData))
+    {
+      return false;
+    }
+    attrib.mName = std::string(name.begin(), name.end());
+    attrib.mType = static_cast<Property::Type>(type);
+  }
+
+  uint32_t           blendShapeBufferOffset = 0u;
+  std::vector<float> unnormalizeFactor;
+  if(!ReadValue(stream, blendShapeBufferOffset) || !ReadVector(stream, unnormalizeFactor))
+  {
+    return false;
+  }
+  raw.mBlendShapeBufferOffset = blendShapeBufferOffset;
+  raw.mBlendShapeUnnormalizeFactor.Resize(static_cast<uint32_t>(unnormalizeFactor.size()));
+  if(!unnormalizeFactor.empty())
+  {
+    std::memcpy(raw.mBlendShapeUnnormalizeFactor.Begin(), unnormalizeFactor.data(), unnormalizeFactor.size() * sizeof(float));
+  }
+
+  uint32_t hasBlendShapeData = 0u;
+  if(!ReadValue(stream, hasBlendShapeData))
+  {
+    return false;
+  }
+  if(hasBlendShapeData)
+  {
+    uint32_t width  = 0u;
+    uint32_t height = 0u;
+    uint32_t format = 0u;
+    uint64_t size   = 0u;
+    if(!ReadValue(stream, width) || !ReadValue(stream, height) || !ReadValue(stream, format) || !ReadValue(stream, size) ||
+       size > std::numeric_limits<uint32_t>::max() || !CanRead(stream, size))
+    {
+      return false;
+    }
+
+    uint8_t* buffer = new uint8_t[size];
+    if(!stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(size)))
+    {
+      delete[] buffer;
+      return false;
+    }
+    raw.mBlendShapeData = PixelData::New(buffer, static_cast<uint32_t>(size), width, height, static_cast<Pixel::Format>(format), PixelData::DELETE_ARRAY);
+  }
+  return true;
+}
+
+} // namespace
+
+void SetCacheDirectory(const std::string& directory)
+{
+  std::scoped_lock<std::mutex> lock(gCacheDirectoryMutex);
+  gCacheDirectory            = directory;
+  gCacheDirectoryInitialized = true;
+}
+
+std::string GetCacheDirectory()
+{
+  std::scoped_lock<std::mutex> lock(gCacheDirectoryMutex);
+  if(!gCacheDirectoryInitialized)
+  {
+    auto directory             = Dali::EnvironmentVariable::GetEnvironmentVariable(MODEL_CACHE_DIR_ENV);
+    gCacheDirectory            = directory ? directory : std::string();
+    gCacheDirectoryInitialized = true;
+  }
+  return gCacheDirectory;
+}
+
+std::string GetCacheFilePath(const std::string& modelUrl)
+{
+  auto directory = GetCacheDirectory();
+  if(directory.empty())
+  {
+    return std::string();
+  }
+
+  std::ostringstream path;
+  path << directory;
+  if(directory.back() != '/')
+  {
+    path << '/';
+  }
+  path << std::hex << std::setw(16) << std::setfill('0') << static_cast<uint64_t>(Dali::Scene3D::Loader::Hash().Add(modelUrl)) << CACHE_FILE_EXTENSION;
+  return path.str();
+}
+
+bool ReadMeshes(const std::string& modelUrl, const std::string& modelsPath, Dali::Scene3D::Loader::ResourceBundle& resources)
+{
+  auto cachePath = GetCacheFilePath(modelUrl);
+  if(cachePath.empty())
+  {
+    return false;
+  }
+
+  std::ifstream stream(cachePath, std::ios::binary);
+  if(!stream)
+  {
+    return false;
+  }
+
+  CacheFileHeader header;
+  if(!ReadValue(stream, header) ||
+     std::memcmp(header.magic, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)) != 0 ||
+     header.version != CACHE_FORMAT_VERSION ||
+     header.meshCount != resources.mMeshes.size() ||
+     header.sourceKey != CalculateSourceKey(modelUrl, modelsPath, resources))
+  {
+    DALI_LOG_DEBUG_INFO("Model cache of %s is outdated\n", modelUrl.c_str());
+    return false;
+  }
+
+  // Read everything first, so that a broken file doesn't leave the meshes half filled.
+  std::vector<CachedMesh> cachedMeshes(header.meshCount);
+  for(auto& cachedMesh : cachedMeshes)
+  {
+    uint32_t isCached = 0u;
+    if(!ReadValue(stream, isCached))
+    {
+      return false;
+    }
+    if(isCached)
+    {
+      if(!ReadMesh(stream, cachedMesh))
+      {
+        DALI_LOG_ERROR("Failed to read model cache %s\n", cachePath.c_str());
+        return false;
+      }
+    }
+  }
+
+  bool        allFound       = true;
+  const auto& refCountMeshes = resources.mReferenceCounts[Dali::Scene3D::Loader::ResourceType::Mesh];
+  for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
+  {
+    auto& iMesh = resources.mMeshes[i];
+    if(refCountMeshes[i] > 0 && !iMesh.first.mRawData && !iMesh.second.geometry)
+    {
+      if(cachedMeshes[i].rawData)
+      {
+        // LoadRaw() is skipped, so restore the bounds it would compute. They're used for the extents of the model.
+        iMesh.first.mRawData              = std::move(cachedMeshes[i].rawData);
+        iMesh.first.mPositions.mBlob.mMin = std::move(cachedMeshes[i].positionMin);
+        iMesh.first.mPositions.mBlob.mMax = std::move(cachedMeshes[i].positionMax);
+      }
+      else
+      {
+        allFound = false;
+      }
+    }
+  }
+  return allFound;
+}
+
+bool WriteMeshes(const std::string& modelUrl, const std::string& modelsPath, const Dali::Scene3D::Loader::ResourceBundle& resources)
+{
+  auto cachePath = GetCacheFilePath(modelUrl);
+  if(cachePath.empty())
+  {
+    return false;
+  }
+
+  // Write into a uniquely named temporary file first, so that other processes and threads writing the same
+  // model never share it, and never read a partially written cache.
+  std::string temporaryPath = cachePath + TEMPORARY_FILE_SUFFIX;
+  {
+    std::error_code errorCode;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), errorCode);
+
+    const int fileDescriptor = mkstemp(temporaryPath.data());
+    if(fileDescriptor < 0)
+    {
+      DALI_LOG_ERROR("Failed to create model cache %s\n", temporaryPath.c_str());
+      return false;
+    }
+    fchmod(fileDescriptor, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH); // mkstemp() creates the file for the owner only
+    close(fileDescriptor);
+
+    std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+    if(!stream)
+    {
+      DALI_LOG_ERROR("Failed to create model cache %s\n", temporaryPath.c_str());
+      std::filesystem::remove(temporaryPath, errorCode);
+      return false;
+    }
+
+    CacheFileHeader header;
+    std::memcpy(header.magic, CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    header.version   = CACHE_FORMAT_VERSION;
+    header.meshCount = static_cast<uint32_t>(resources.mMeshes.size());
+    header.sourceKey = CalculateSourceKey(modelUrl, modelsPath, resources);
+    WriteValue(stream, header);
+
+    for(auto& mesh : resources.mMeshes)
+    {
+      const bool isCached = !!mesh.first.mRawData;
+      WriteValue(stream, static_cast<uint32_t>(isCached));
+      if(isCached)
+      {
+        WriteMesh(stream, mesh.first);
+      }
+    }
+
+    if(!stream)
+    {
+      DALI_LOG_ERROR("Failed to write model cache %s\n", temporaryPath.c_str());
+      stream.close();
+      std::filesystem::remove(temporaryPath, errorCode);
+      return false;
+    }
+  }
+
+  std::error_code errorCode;
+  std::filesystem::rename(temporaryPath, cachePath, errorCode);
+  if(errorCode)
+  {
+    std::filesystem::remove(temporaryPath, errorCode);
+    return false;
+  }
+  return true;
+}
+
+} // namespace ModelDiskCache
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
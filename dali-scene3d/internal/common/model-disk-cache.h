@@ -0,0 +1,89 @@
+#ifndef DALI_SCENE3D_MODEL_DISK_CACHE_H
+#define DALI_SCENE3D_MODEL_DISK_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/public-api/loader/resource-bundle.h>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+/**
+ * The namespace to store the processed mesh data of models on disk, so that the next launch can skip
+ * reading, dequantizing and generating normals and tangents of the meshes.
+ *
+ * The cache is disabled until a directory is set, either by SetCacheDirectory() or by the
+ * DALI_SCENE3D_MODEL_CACHE_DIR environment variable. A cache file is only used if the format version,
+ * the model url, and the size and modification time of the model and its buffer files all match.
+ * @note This namespace can be called from worker threads.
+ */
+namespace ModelDiskCache
+{
+/**
+ * @brief Sets the directory where cache files are stored. An empty path disables the cache.
+ * @param[in] directory The directory path.
+ */
+void SetCacheDirectory(const std::string& directory);
+
+/**
+ * @brief Retrieves the directory where cache files are stored.
+ * @return The directory path, or an empty string if the cache is disabled.
+ */
+std::string GetCacheDirectory();
+
+/**
+ * @brief Retrieves the path of the cache file for the given model.
+ * @param[in] modelUrl The url of the model.
+ * @return The path of the cache file, or an empty string if the cache is disabled.
+ */
+std::string GetCacheFilePath(const std::string& modelUrl);
+
+/**
+ * @brief Fills the raw data of the meshes that are referenced but not loaded yet, from the cache file of the model.
+ * @param[in] modelUrl The url of the model.
+ * @param[in] modelsPath The path that mesh uris are relative to.
+ * @param[in,out] resources The resources of the model. Its reference counts should be set already.
+ * @return True if every mesh that needed loading was found in the cache.
+ */
+bool ReadMeshes(const std::string& modelUrl, const std::string& modelsPath, Dali::Scene3D::Loader::ResourceBundle& resources);
+
+/**
+ * @brief Writes the raw data of all the loaded meshes to the cache file of the model.
+ * @param[in] modelUrl The url of the model.
+ * @param[in] modelsPath The path that mesh uris are relative to.
+ * @param[in] resources The resources of the model.
+ * @return True if the cache file was written.
+ */
+bool WriteMeshes(const std::string& modelUrl, const std::string& modelsPath, const Dali::Scene3D::Loader::ResourceBundle& resources);
+
+} // namespace ModelDiskCache
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
+
+#endif // DALI_SCENE3D_MODEL_DISK_CACHE_H
@@ -22,6 +22,9 @@
 #include <dali/integration-api/debug.h>
 #include <filesystem>
 
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/shader-variant-cache.h>
+
 namespace Dali
 {
 namespace Scene3D
@@ -96,6 +99,9 @@ void ModelLoadTask::Process()
     return;
   }
 
+  // Prepare the shader sources that the model will request on the main thread, while we are still on the worker thread.
+  Dali::Scene3D::Internal::ShaderVariantCache::Prepare(GetScene(), GetResources());
+
   mHasSucceeded = true;
 }
 
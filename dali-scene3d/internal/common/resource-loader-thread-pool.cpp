@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/common/resource-loader-thread-pool.h>
+
+// EXTERNAL INCLUDES
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+namespace ResourceLoaderThreadPool
+{
+namespace
+{
+constexpr uint32_t WORKER_THREAD_COUNT = 4u;
+} // namespace
+
+Dali::ThreadPool& Get()
+{
+  static std::unique_ptr<Dali::ThreadPool> gThreadPool{nullptr};
+  static std::once_flag                    onceFlag;
+
+  // ModelLoadTasks could be processed by several async task threads at once,
+  // so the creation should be synchronized.
+  std::call_once(onceFlag, [&threadPool = gThreadPool] {
+    threadPool = std::make_unique<Dali::ThreadPool>();
+    threadPool->Initialize(WORKER_THREAD_COUNT);
+  });
+
+  return *gThreadPool;
+}
+
+uint32_t GetWorkerCount()
+{
+  return static_cast<uint32_t>(Get().GetWorkerCount());
+}
+
+void ProcessJobs(std::vector<Job>& jobs)
+{
+  if(jobs.empty())
+  {
+    return;
+  }
+
+  if(jobs.size() == 1u)
+  {
+    jobs[0]();
+    return;
+  }
+
+  // Loaders report failures by throwing, e.g. ExceptionFlinger. Exceptions can't leave the worker thread,
+  // so keep them, and rethrow the one of the earliest job on the calling thread.
+  std::vector<std::exception_ptr> exceptions(jobs.size());
+
+  std::vector<Dali::Task> tasks;
+  tasks.reserve(jobs.size());
+  for(uint32_t i = 0u, iEnd = static_cast<uint32_t>(jobs.size()); i < iEnd; ++i)
+  {
+    tasks.emplace_back([&job = jobs[i], &exception = exceptions[i]](uint32_t) {
+      try
+      {
+        job();
+      }
+      catch(...)
+      {
+        exception = std::current_exception();
+      }
+    });
+  }
+
+  auto future = Get().SubmitTasks(tasks, 0);
+  future->Wait();
+
+  for(auto& exception : exceptions)
+  {
+    if(exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+} // namespace ResourceLoaderThreadPool
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
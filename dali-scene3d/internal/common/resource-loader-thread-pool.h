@@ -0,0 +1,72 @@
+#ifndef DALI_SCENE3D_RESOURCE_LOADER_THREAD_POOL_H
+#define DALI_SCENE3D_RESOURCE_LOADER_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <functional>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+/**
+ * The namespace to run independent resource loading jobs in parallel.
+ * @note This namespace can be called from worker threads, e.g. ModelLoadTask::Process().
+ */
+namespace ResourceLoaderThreadPool
+{
+using Job = std::function<void()>;
+
+/**
+ * @brief Retrieves the thread pool shared by all resource loading jobs.
+ * The pool is created when it is first used.
+ * @return The thread pool.
+ */
+Dali::ThreadPool& Get();
+
+/**
+ * @brief Retrieves the number of worker threads in the pool.
+ * @return The number of workers.
+ */
+uint32_t GetWorkerCount();
+
+/**
+ * @brief Runs the given jobs in parallel, and returns when all of them have been completed.
+ *
+ * Jobs are expected to be independent of each other. Each job should write its result
+ * into its own storage, so the outcome does not depend on the order of execution.
+ * If there is only one job, it is run on the calling thread.
+ * If any job throws, the exception of the first such job is rethrown after all jobs have finished.
+ * @param[in] jobs The jobs to run.
+ */
+void ProcessJobs(std::vector<Job>& jobs);
+
+} // namespace ResourceLoaderThreadPool
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
+
+#endif // DALI_SCENE3D_RESOURCE_LOADER_THREAD_POOL_H
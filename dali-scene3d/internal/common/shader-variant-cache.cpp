@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-scene3d/internal/common/shader-variant-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/map-wrapper.h>
+#include <dali/integration-api/adaptor-framework/shader-precompiler.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/adaptor-framework/async-task-manager.h>
+#include <dali/public-api/rendering/shader.h>
+#include <dali/public-api/signals/callback.h>
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/internal/model-components/material-impl.h>
+#include <dali-scene3d/internal/model-components/model-primitive-impl.h>
+#include <dali-scene3d/public-api/loader/node-definition.h>
+#include <dali-scene3d/public-api/loader/shader-manager.h>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+namespace ShaderVariantCache
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_SCENE3D_SHADER_VARIANT_CACHE");
+#endif
+
+constexpr uint32_t MAXIMUM_CACHED_VARIANT_COUNT = 64u;
+
+using UsageList = std::list<Dali::Scene3D::Loader::ShaderOption::HashType>;
+
+struct CacheEntry
+{
+  RawDataPtr          rawData;
+  UsageList::iterator usage;
+};
+
+std::mutex                                                          gCacheMutex;
+std::map<Dali::Scene3D::Loader::ShaderOption::HashType, CacheEntry> gRawDataCache;
+UsageList                                                           gUsage; ///< Most recently used first.
+
+RawDataPtr BuildRawData(const Dali::Scene3D::Loader::ShaderOption& shaderOption)
+{
+  Dali::Scene3D::Loader::ShaderDefinition shaderDef;
+  shaderDef.mUseBuiltInShader = true;
+  shaderOption.GetDefines(shaderDef.mDefines);
+  shaderDef.mMacros = shaderOption.GetMacroDefinitions();
+
+  return std::make_shared<const Dali::Scene3D::Loader::ShaderDefinition::RawData>(shaderDef.LoadRaw(""));
+}
+
+constexpr std::string_view PRECOMPILE_SHADER_NAME_PREFIX = "SCENE3D_";
+
+/**
+ * @brief The sources of a shader registered to the shader precompiler.
+ */
+struct PrecompileShader
+{
+  RawDataPtr       rawData;        ///< Owns the sources which the views below refer to.
+  std::string_view vertexShader;   ///< Without the shader prefix, as the precompiler adds it by itself.
+  std::string_view fragmentShader; ///< Without the shader prefix, as the precompiler adds it by itself.
+};
+
+std::map<std::string, PrecompileShader> gPrecompileShaders; ///< Keyed by the shader name. Used from the main thread only.
+
+std::string GetPrecompileShaderName(std::string_view type, Dali::Scene3D::Loader::ShaderOption::HashType hash)
+{
+  std::ostringstream oss;
+  oss << PRECOMPILE_SHADER_NAME_PREFIX << type << "_" << std::hex << hash;
+  return oss.str();
+}
+
+std::string_view StripPrefix(const std::string& source, const std::string& prefix)
+{
+  std::string_view view(source);
+  if(!prefix.empty() && view.substr(0u, prefix.size()) == prefix)
+  {
+    view.remove_prefix(prefix.size());
+  }
+  return view;
+}
+
+/**
+ * @brief Saves the registered shaders to the shader precompiler, along with the shaders other modules saved there.
+ */
+void SavePrecompileShaders()
+{
+  std::vector<RawShaderData> rawShaderList;
+  ShaderPreCompiler::Get().GetPreCompileShaderList(rawShaderList);
+
+  // Replace the ones saved by the previous call.
+  rawShaderList.erase(std::remove_if(rawShaderList.begin(), rawShaderList.end(), [](const RawShaderData& shaderData) { return !shaderData.shaderName.empty() && shaderData.shaderName[0].substr(0u, PRECOMPILE_SHADER_NAME_PREFIX.size()) == PRECOMPILE_SHADER_NAME_PREFIX; }),
+                      rawShaderList.end());
+
+  for(auto& [name, shader] : gPrecompileShaders)
+  {
+    RawShaderData shaderData;
+    shaderData.vertexPrefix   = {""};
+    shaderData.fragmentPrefix = {""};
+    shaderData.shaderName     = {name};
+    shaderData.vertexShader   = shader.vertexShader;
+    shaderData.fragmentShader = shader.fragmentShader;
+    shaderData.shaderCount    = 1;
+    rawShaderList.push_back(shaderData);
+  }
+
+  ShaderPreCompiler::Get().SavePreCompileShaderList(rawShaderList);
+}
+
+/**
+ * @brief Registers the built sources of the options to the shader precompiler, if the application enabled it.
+ * @note Should be called from the main thread.
+ */
+void AddPrecompileShaders(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions)
+{
+  if(!ShaderPreCompiler::Get().IsEnable())
+  {
+    // The application didn't ask for precompiled shaders, e.g. by VisualFactory::UsePreCompiledShader().
+    return;
+  }
+
+  const std::string vertexPrefix   = Dali::Shader::GetVertexShaderPrefix();
+  const std::string fragmentPrefix = Dali::Shader::GetFragmentShaderPrefix();
+
+  bool added = false;
+  for(auto& shaderOption : shaderOptions)
+  {
+    const auto  hash = shaderOption.GetOptionHash();
+    std::string name = GetPrecompileShaderName("PBR", hash);
+    if(gPrecompileShaders.find(name) != gPrecompileShaders.end())
+    {
+      continue;
+    }
+
+    auto rawData = GetRawData(shaderOption);
+    gPrecompileShaders.emplace(std::move(name), PrecompileShader{rawData, StripPrefix(rawData->mVertexShaderSource, vertexPrefix), StripPrefix(rawData->mFragmentShaderSource, fragmentPrefix)});
+    gPrecompileShaders.emplace(GetPrecompileShaderName("SHADOW_MAP", hash), PrecompileShader{rawData, StripPrefix(rawData->mShadowVertexShaderSource, vertexPrefix), StripPrefix(rawData->mShadowFragmentShaderSource, fragmentPrefix)});
+    added = true;
+  }
+
+  if(added)
+  {
+    SavePrecompileShaders();
+  }
+}
+
+/**
+ * @brief Task to build the shader sources of the options on a worker thread.
+ */
+class ShaderVariantPrepareTask : public AsyncTask
+{
+public:
+  ShaderVariantPrepareTask(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions)
+  : AsyncTask(MakeCallback(&ShaderVariantPrepareTask::OnCompleted), AsyncTask::PriorityType::LOW),
+    mShaderOptions(shaderOptions)
+  {
+  }
+
+  void Process() override
+  {
+    Prepare(mShaderOptions);
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::string_view GetTaskName() const override
+  {
+    return "ShaderVariantPrepareTask";
+  }
+
+  static void OnCompleted(AsyncTaskPtr task)
+  {
+    AddPrecompileShaders(static_cast<ShaderVariantPrepareTask*>(task.Get())->mShaderOptions);
+  }
+
+private:
+  std::vector<Dali::Scene3D::Loader::ShaderOption> mShaderOptions;
+};
+
+} // namespace
+
+RawDataPtr GetRawData(const Dali::Scene3D::Loader::ShaderOption& shaderOption)
+{
+  const auto hash = shaderOption.GetOptionHash();
+  {
+    std::scoped_lock<std::mutex> lock(gCacheMutex);
+    auto                         iter = gRawDataCache.find(hash);
+    if(iter != gRawDataCache.end())
+    {
+      gUsage.splice(gUsage.begin(), gUsage, iter->second.usage);
+      return iter->second.rawData;
+    }
+  }
+
+  // Build without the lock. If another thread built the same variant meanwhile, keep the first one.
+  DALI_LOG_INFO(gLogFilter, Debug::Concise, "Building shader variant: hash: %lx\n", hash);
+  auto rawData = BuildRawData(shaderOption);
+
+  std::scoped_lock<std::mutex> lock(gCacheMutex);
+  auto                         iter = gRawDataCache.find(hash);
+  if(iter != gRawDataCache.end())
+  {
+    gUsage.splice(gUsage.begin(), gUsage, iter->second.usage);
+    return iter->second.rawData;
+  }
+
+  if(gRawDataCache.size() >= MAXIMUM_CACHED_VARIANT_COUNT)
+  {
+    // The shaders produced from the dropped sources keep their own copy, so only a later ProduceShader() rebuilds them.
+    DALI_LOG_INFO(gLogFilter, Debug::Concise, "Drop shader variant: hash: %lx\n", gUsage.back());
+    gRawDataCache.erase(gUsage.back());
+    gUsage.pop_back();
+  }
+  gUsage.push_front(hash);
+  gRawDataCache.emplace(hash, CacheEntry{rawData, gUsage.begin()});
+  return rawData;
+}
+
+void Prepare(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions)
+{
+  for(auto& shaderOption : shaderOptions)
+  {
+    GetRawData(shaderOption);
+  }
+}
+
+Dali::Scene3D::Loader::ShaderOption MakeModelPrimitiveShaderOption(const Dali::Scene3D::Loader::MaterialDefinition& materialDefinition, const Dali::Scene3D::Loader::MeshDefinition& meshDefinition)
+{
+  bool hasPositions = false;
+  bool hasNormals   = false;
+  bool hasTangents  = false;
+  meshDefinition.RetrieveBlendShapeComponents(hasPositions, hasNormals, hasTangents);
+
+  auto shaderOption = Material::MakeShaderOption(materialDefinition);
+  ModelPrimitive::AddShaderOptions(shaderOption, meshDefinition.IsSkinned(), meshDefinition.GetNumberOfJointSets(), meshDefinition.HasVertexColor(), hasPositions, hasNormals, hasTangents, meshDefinition.mBlendShapeVersion);
+  return shaderOption;
+}
+
+void Prepare(const Dali::Scene3D::Loader::SceneDefinition& scene, const Dali::Scene3D::Loader::ResourceBundle& resources)
+{
+  // ProduceShaderOption() doesn't touch the state of the manager, so a local one is enough here.
+  Dali::Scene3D::Loader::ShaderManagerPtr shaderManager = new Dali::Scene3D::Loader::ShaderManager();
+
+  for(uint32_t i = 0, iEnd = scene.GetNodeCount(); i < iEnd; ++i)
+  {
+    for(auto& renderable : scene.GetNode(i)->mRenderables)
+    {
+      auto modelRenderable = dynamic_cast<const Dali::Scene3D::Loader::ModelRenderable*>(renderable.get());
+      if(modelRenderable &&
+         modelRenderable->mMeshIdx < resources.mMeshes.size() &&
+         modelRenderable->mMaterialIdx < resources.mMaterials.size())
+      {
+        const auto& materialDefinition = resources.mMaterials[modelRenderable->mMaterialIdx].first;
+        const auto& meshDefinition     = resources.mMeshes[modelRenderable->mMeshIdx].first;
+
+        // ModelRenderable::OnCreate() produces the loader option first, and the ModelPrimitive replaces it
+        // with the material based one when it is added to the scene. Both are requested.
+        GetRawData(shaderManager->ProduceShaderOption(materialDefinition, meshDefinition));
+        GetRawData(MakeModelPrimitiveShaderOption(materialDefinition, meshDefinition));
+      }
+    }
+  }
+}
+
+void RequestPrepare(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions)
+{
+  if(shaderOptions.empty())
+  {
+    return;
+  }
+
+  Dali::AsyncTaskManager::Get().AddTask(new ShaderVariantPrepareTask(shaderOptions));
+}
+
+bool IsCached(Dali::Scene3D::Loader::ShaderOption::HashType hash)
+{
+  std::scoped_lock<std::mutex> lock(gCacheMutex);
+  return gRawDataCache.find(hash) != gRawDataCache.end();
+}
+
+void ReleasePrecompileShaders(Dali::Scene3D::Loader::ShaderOption::HashType hash)
+{
+  // The nodes keep the names and the sources alive until the precompiler has the list without them.
+  auto pbrShader       = gPrecompileShaders.extract(GetPrecompileShaderName("PBR", hash));
+  auto shadowMapShader = gPrecompileShaders.extract(GetPrecompileShaderName("SHADOW_MAP", hash));
+  if(pbrShader || shadowMapShader)
+  {
+    DALI_LOG_INFO(gLogFilter, Debug::Concise, "Release precompile shader variant: hash: %lx\n", hash);
+    SavePrecompileShaders();
+  }
+}
+
+} // namespace ShaderVariantCache
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
@@ -0,0 +1,113 @@
+#ifndef DALI_SCENE3D_SHADER_VARIANT_CACHE_H
+#define DALI_SCENE3D_SHADER_VARIANT_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include <dali-scene3d/public-api/loader/load-result.h>
+#include <dali-scene3d/public-api/loader/shader-definition.h>
+#include <dali-scene3d/public-api/loader/shader-option.h>
+
+namespace Dali
+{
+namespace Scene3D
+{
+namespace Internal
+{
+/**
+ * The namespace to keep the shader sources of each ShaderOption, shared by all ShaderManagers in the process.
+ *
+ * Building the sources of a variant means applying every define and macro to the built-in shaders.
+ * Each SceneView owns its ShaderManager, and Dali::Shader can't be shared between them as the light
+ * and shadow constraints are per scene. The sources are, though, and the identical sources let the
+ * graphics backend reuse the compiled program. The number of cached variants is bounded, and the least
+ * recently used one is dropped first.
+ * @note This namespace can be called from worker threads.
+ */
+namespace ShaderVariantCache
+{
+using RawDataPtr = std::shared_ptr<const Dali::Scene3D::Loader::ShaderDefinition::RawData>;
+
+/**
+ * @brief Retrieves the shader sources of the option, building them if they are not cached yet.
+ * @param[in] shaderOption The shader option.
+ * @return The shader sources.
+ */
+RawDataPtr GetRawData(const Dali::Scene3D::Loader::ShaderOption& shaderOption);
+
+/**
+ * @brief Builds and caches the shader sources of the options which are not cached yet.
+ * @param[in] shaderOptions The shader options.
+ */
+void Prepare(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions);
+
+/**
+ * @brief Makes the shader option that a ModelPrimitive of the renderable applies once its material is ready.
+ * @param[in] materialDefinition The material definition of the renderable.
+ * @param[in] meshDefinition The mesh definition of the renderable.
+ * @return The shader option.
+ */
+Dali::Scene3D::Loader::ShaderOption MakeModelPrimitiveShaderOption(const Dali::Scene3D::Loader::MaterialDefinition& materialDefinition, const Dali::Scene3D::Loader::MeshDefinition& meshDefinition);
+
+/**
+ * @brief Builds and caches the shader sources that the renderables of the loaded model will request.
+ * @param[in] scene The loaded scene.
+ * @param[in] resources The loaded resources of the scene.
+ */
+void Prepare(const Dali::Scene3D::Loader::SceneDefinition& scene, const Dali::Scene3D::Loader::ResourceBundle& resources);
+
+/**
+ * @brief Requests to build the shader sources of the options on a worker thread.
+ *
+ * Once built, the sources are registered to the shader precompiler too, if the application enabled it,
+ * e.g. by VisualFactory::UsePreCompiledShader(). The precompiler isn't enabled by this.
+ * @param[in] shaderOptions The shader options.
+ * @note Should be called from the main thread.
+ */
+void RequestPrepare(const std::vector<Dali::Scene3D::Loader::ShaderOption>& shaderOptions);
+
+/**
+ * @brief Retrieves whether the shader sources of the option hash are cached.
+ * @param[in] hash The hash of the shader option.
+ * @return True if the sources are cached.
+ */
+bool IsCached(Dali::Scene3D::Loader::ShaderOption::HashType hash);
+
+/**
+ * @brief Removes the sources of the option hash from the shader precompiler.
+ *
+ * Once a shader of the variant is produced, its program is compiled anyway, and the precompiler doesn't
+ * need the sources anymore.
+ * @param[in] hash The hash of the shader option.
+ * @note Should be called from the main thread.
+ */
+void ReleasePrecompileShaders(Dali::Scene3D::Loader::ShaderOption::HashType hash);
+
+} // namespace ShaderVariantCache
+
+} // namespace Internal
+
+} // namespace Scene3D
+
+} // namespace Dali
+
+#endif // DALI_SCENE3D_SHADER_VARIANT_CACHE_H
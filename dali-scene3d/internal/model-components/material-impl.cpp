@@ -75,6 +75,30 @@ enum TextureIndex
   TEXTURE_TYPE_NUMBER,
 };
 
+// The shader option type of each TextureIndex.
+static constexpr Loader::ShaderOption::Type TEXTURE_SHADER_OPTION_TYPES[TEXTURE_TYPE_NUMBER] =
+  {
+    Loader::ShaderOption::Type::BASE_COLOR_TEXTURE,
+    Loader::ShaderOption::Type::METALLIC_ROUGHNESS_TEXTURE,
+    Loader::ShaderOption::Type::NORMAL_TEXTURE,
+    Loader::ShaderOption::Type::OCCLUSION,
+    Loader::ShaderOption::Type::EMISSIVE,
+    Loader::ShaderOption::Type::SPECULAR,
+    Loader::ShaderOption::Type::SPECULAR_COLOR,
+};
+
+// The semantic of each TextureIndex in the MaterialDefinition. It matches the textures ModelRenderable sets to the Material.
+static constexpr uint32_t TEXTURE_DEFINITION_SEMANTICS[TEXTURE_TYPE_NUMBER] =
+  {
+    Scene3D::Loader::MaterialDefinition::ALBEDO,
+    Scene3D::Loader::MaterialDefinition::METALLIC | Scene3D::Loader::MaterialDefinition::ROUGHNESS,
+    Scene3D::Loader::MaterialDefinition::NORMAL,
+    Scene3D::Loader::MaterialDefinition::OCCLUSION,
+    Scene3D::Loader::MaterialDefinition::EMISSIVE,
+    Scene3D::Loader::MaterialDefinition::SPECULAR,
+    Scene3D::Loader::MaterialDefinition::SPECULAR_COLOR,
+};
+
 /**
  * @brief Helper API to register uniform property only if don't register before.
  *
@@ -121,19 +145,48 @@ Material::Material()
   mTextureInformations[SPECULAR].mSemantic       = Scene3D::Loader::MaterialDefinition::SPECULAR;
   mTextureInformations[SPECULAR_COLOR].mSemantic = Scene3D::Loader::MaterialDefinition::SPECULAR_COLOR;
 
-  mTextureInformations[BASE_COLOR].mShaderOptionType         = Loader::ShaderOption::Type::BASE_COLOR_TEXTURE;
-  mTextureInformations[METALLIC_ROUGHNESS].mShaderOptionType = Loader::ShaderOption::Type::METALLIC_ROUGHNESS_TEXTURE;
-  mTextureInformations[NORMAL].mShaderOptionType             = Loader::ShaderOption::Type::NORMAL_TEXTURE;
-  mTextureInformations[OCCLUSION].mShaderOptionType          = Loader::ShaderOption::Type::OCCLUSION;
-  mTextureInformations[EMISSIVE].mShaderOptionType           = Loader::ShaderOption::Type::EMISSIVE;
-  mTextureInformations[SPECULAR].mShaderOptionType           = Loader::ShaderOption::Type::SPECULAR;
-  mTextureInformations[SPECULAR_COLOR].mShaderOptionType     = Loader::ShaderOption::Type::SPECULAR_COLOR;
+  for(uint32_t i = 0; i < TEXTURE_TYPE_NUMBER; ++i)
+  {
+    mTextureInformations[i].mShaderOptionType = TEXTURE_SHADER_OPTION_TYPES[i];
+  }
 
   mTextureInformations[TextureIndex::EMISSIVE].mFactor = Vector4::ZERO;
 }
 
 Material::~Material() = default;
 
+Loader::ShaderOption Material::MakeShaderOption(const Scene3D::Loader::MaterialDefinition& materialDefinition)
+{
+  uint32_t textureMask = 0u;
+  for(uint32_t i = 0; i < TEXTURE_TYPE_NUMBER; ++i)
+  {
+    if(materialDefinition.CheckTextures(TEXTURE_DEFINITION_SEMANTICS[i]))
+    {
+      textureMask |= 1u << i;
+    }
+  }
+  return MakeShaderOption(textureMask, materialDefinition.mAlphaModeType == Scene3D::Material::AlphaModeType::BLEND);
+}
+
+Loader::ShaderOption Material::MakeShaderOption(uint32_t textureMask, bool hasTransparency)
+{
+  Loader::ShaderOption shaderOption;
+  for(uint32_t i = 0; i < TEXTURE_TYPE_NUMBER; ++i)
+  {
+    if(textureMask & (1u << i))
+    {
+      shaderOption.AddOption(TEXTURE_SHADER_OPTION_TYPES[i]);
+    }
+  }
+  shaderOption.AddOption(Loader::ShaderOption::Type::THREE_TEXTURE);
+  shaderOption.AddOption(Loader::ShaderOption::Type::GLTF_CHANNELS);
+  if(hasTransparency)
+  {
+    shaderOption.SetTransparency();
+  }
+  return shaderOption;
+}
+
 void Material::Initialize()
 {
 }
@@ -650,21 +703,15 @@ void Material::UpdateMaterialData()
 
     mMaterialFlag = materialFlag;
 
-    mShaderOption = Loader::ShaderOption();
-    for(auto&& textureInformation : mTextureInformations)
+    uint32_t textureMask = 0u;
+    for(uint32_t i = 0; i < TEXTURE_TYPE_NUMBER; ++i)
     {
-      if(!textureInformation.mTexture)
+      if(mTextureInformations[i].mTexture)
       {
-        continue;
+        textureMask |= 1u << i;
       }
-      mShaderOption.AddOption(textureInformation.mShaderOptionType);
-    }
-    mShaderOption.AddOption(Loader::ShaderOption::Type::THREE_TEXTURE);
-    mShaderOption.AddOption(Loader::ShaderOption::Type::GLTF_CHANNELS);
-    if(materialFlag & Scene3D::Loader::MaterialDefinition::TRANSPARENCY)
-    {
-      mShaderOption.SetTransparency();
     }
+    mShaderOption = MakeShaderOption(textureMask, hasTransparency);
   }
 
   // Finish to make all the material flag according to the gltf2-util.
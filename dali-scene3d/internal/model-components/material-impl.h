@@ -87,6 +87,16 @@ public:
    */
   static MaterialPtr New();
 
+  /**
+   * @brief Makes the shader option a Material gets for the given material definition.
+   *
+   * It matches the option UpdateMaterialData() makes after the textures of the definition are loaded,
+   * so the variant can be prepared before the Material exists.
+   * @param[in] materialDefinition The material definition.
+   * @return The shader option of the material.
+   */
+  static Scene3D::Loader::ShaderOption MakeShaderOption(const Scene3D::Loader::MaterialDefinition& materialDefinition);
+
 protected:
   /**
    * @brief Construct a new Material.
@@ -280,6 +290,14 @@ private:
    */
   void ResourcesLoadComplete();
 
+  /**
+   * @brief Makes the shader option for the given textures.
+   * @param[in] textureMask The bit (1 << TextureIndex) is set for each texture the material has.
+   * @param[in] hasTransparency Whether the material is blended.
+   * @return The shader option of the material.
+   */
+  static Scene3D::Loader::ShaderOption MakeShaderOption(uint32_t textureMask, bool hasTransparency);
+
   /**
    * @brief Updates the material using each attribute of this material and send a notification to the ModelPrimitive class.
    */
@@ -125,6 +125,47 @@ ModelPrimitivePtr ModelPrimitive::New()
   return primitive;
 }
 
+void ModelPrimitive::AddShaderOptions(Scene3D::Loader::ShaderOption& shaderOption, bool hasSkinning, uint32_t numberOfJointSets, bool hasVertexColor, bool hasPositions, bool hasNormals, bool hasTangents, Scene3D::Loader::BlendShapes::Version blendShapeVersion)
+{
+  shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::VEC4_TANGENT);
+  if(hasSkinning)
+  {
+    shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::SKINNING);
+    shaderOption.AddJointMacros(numberOfJointSets);
+  }
+  else
+  {
+    shaderOption.AddJointMacros(0);
+  }
+  if(hasVertexColor)
+  {
+    shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::COLOR_ATTRIBUTE);
+  }
+  if(hasPositions || hasNormals || hasTangents)
+  {
+    if(hasPositions)
+    {
+      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_POSITION);
+    }
+    if(hasNormals)
+    {
+      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_NORMAL);
+    }
+    if(hasTangents)
+    {
+      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_TANGENT);
+    }
+    if(blendShapeVersion == Scene3D::Loader::BlendShapes::Version::VERSION_2_0)
+    {
+      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0);
+    }
+  }
+  if(DALI_UNLIKELY(Dali::Shader::GetShaderLanguageVersion() < MINIMUM_SHADER_VERSION_SUPPORT_TEXTURE_TEXEL_AND_SIZE))
+  {
+    shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::SL_VERSION_LOW);
+  }
+}
+
 ModelPrimitive::ModelPrimitive()
 : mShaderManager(new Scene3D::Loader::ShaderManager())
 {
@@ -210,6 +251,11 @@ Dali::Scene3D::Material ModelPrimitive::GetMaterial() const
   return mMaterial;
 }
 
+Scene3D::Loader::ShaderOption::HashType ModelPrimitive::GetShaderOptionHash() const
+{
+  return mShaderOptionHash;
+}
+
 void ModelPrimitive::AddPrimitiveObserver(ModelPrimitiveModifyObserver* observer)
 {
   mObservers.insert(observer);
@@ -313,46 +359,10 @@ void ModelPrimitive::ApplyMaterialToRenderer(MaterialModifyObserver::ModifyFlag
   if(mIsMaterialChanged || shaderFlag == static_cast<uint32_t>(MaterialModifyObserver::ModifyFlag::SHADER))
   {
     Scene3D::Loader::ShaderOption shaderOption = GetImplementation(mMaterial).GetShaderOption();
+    AddShaderOptions(shaderOption, mHasSkinning, mNumberOfJointSets, mHasVertexColor, mHasPositions, mHasNormals, mHasTangents, mBlendShapeVersion);
 
-    shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::VEC4_TANGENT);
-    if(mHasSkinning)
-    {
-      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::SKINNING);
-      shaderOption.AddJointMacros(mNumberOfJointSets);
-    }
-    else
-    {
-      shaderOption.AddJointMacros(0);
-    }
-    if(mHasVertexColor)
-    {
-      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::COLOR_ATTRIBUTE);
-    }
-    if(mHasPositions || mHasNormals || mHasTangents)
-    {
-      if(mHasPositions)
-      {
-        shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_POSITION);
-      }
-      if(mHasNormals)
-      {
-        shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_NORMAL);
-      }
-      if(mHasTangents)
-      {
-        shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_TANGENT);
-      }
-      if(mBlendShapeVersion == Scene3D::Loader::BlendShapes::Version::VERSION_2_0)
-      {
-        shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::MORPH_VERSION_2_0);
-      }
-    }
-    if(DALI_UNLIKELY(Dali::Shader::GetShaderLanguageVersion() < MINIMUM_SHADER_VERSION_SUPPORT_TEXTURE_TEXEL_AND_SIZE))
-    {
-      shaderOption.AddOption(Scene3D::Loader::ShaderOption::Type::SL_VERSION_LOW);
-    }
-
-    Shader newShader = mShaderManager->ProduceShader(shaderOption);
+    mShaderOptionHash = shaderOption.GetOptionHash();
+    Shader newShader  = mShaderManager->ProduceShader(shaderOption);
     if(mShader != newShader)
     {
       DALI_LOG_INFO(gLogFilter, Debug::General, "Warning!  Model primitive shader changed: OldHash:%x NewHash:%x\n", oldHash, shaderOption.GetOptionHash());
@@ -62,6 +62,20 @@ public:
    */
   static ModelPrimitivePtr New();
 
+  /**
+   * @brief Adds the options a ModelPrimitive puts on top of the shader option of its Material.
+   *
+   * @param[in,out] shaderOption The shader option of the material.
+   * @param[in] hasSkinning Whether the primitive is skinned.
+   * @param[in] numberOfJointSets The number of joint sets when skinned.
+   * @param[in] hasVertexColor Whether the primitive has vertex colors.
+   * @param[in] hasPositions Whether the blend shapes have positions.
+   * @param[in] hasNormals Whether the blend shapes have normals.
+   * @param[in] hasTangents Whether the blend shapes have tangents.
+   * @param[in] blendShapeVersion The version of the blend shapes.
+   */
+  static void AddShaderOptions(Scene3D::Loader::ShaderOption& shaderOption, bool hasSkinning, uint32_t numberOfJointSets, bool hasVertexColor, bool hasPositions, bool hasNormals, bool hasTangents, Scene3D::Loader::BlendShapes::Version blendShapeVersion);
+
 protected:
   /**
    * @brief Construct a new ModelPrimitive.
@@ -109,6 +123,12 @@ public:
    */
   Dali::Scene3D::Material GetMaterial() const;
 
+  /**
+   * @brief Retrieves the hash of the shader option the current shader was produced with.
+   * @return The hash of the shader option, or 0 if no shader is produced yet.
+   */
+  Scene3D::Loader::ShaderOption::HashType GetShaderOptionHash() const;
+
   /**
    * @brief Adds a primitive observer to this model primitive.
    *
@@ -246,7 +266,8 @@ private:
   Dali::TextureSet        mTextureSet;
   Dali::Scene3D::Material mMaterial;
 
-  Scene3D::Loader::ShaderManagerPtr mShaderManager;
+  Scene3D::Loader::ShaderManagerPtr       mShaderManager;
+  Scene3D::Loader::ShaderOption::HashType mShaderOptionHash{0u};
 
   // For Shadow
   Dali::Texture mShadowMapTexture;
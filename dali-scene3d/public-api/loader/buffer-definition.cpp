@@ -58,7 +58,8 @@ BufferDefinition::BufferDefinition(BufferDefinition&& other)
   mUri(std::move(other.mUri)),
   mByteLength(std::move(other.mByteLength)),
   mName(std::move(other.mName)),
-  mImpl(std::move(other.mImpl))
+  mImpl(std::move(other.mImpl)),
+  mIsEmbedded(other.mIsEmbedded)
 {
 }
 
@@ -79,6 +80,24 @@ bool BufferDefinition::IsAvailable()
   return mImpl.get()->stream != nullptr;
 }
 
+BufferDefinition BufferDefinition::CreateReadView()
+{
+  LoadBuffer();
+
+  BufferDefinition view;
+  view.mResourcePath = mResourcePath;
+  view.mUri          = mUri;
+  view.mByteLength   = mByteLength;
+  view.mName         = mName;
+  if(mIsEmbedded)
+  {
+    // Shares the decoded data. Only the read position is owned by the view.
+    view.mImpl.get()->stream = std::make_shared<Dali::FileStream>(reinterpret_cast<uint8_t*>(mImpl.get()->buffer.data()), mImpl.get()->buffer.size(), FileStream::READ | FileStream::BINARY);
+    view.mIsEmbedded         = true;
+  }
+  return view;
+}
+
 void BufferDefinition::LoadBuffer()
 {
   if(mImpl.get()->stream == nullptr)
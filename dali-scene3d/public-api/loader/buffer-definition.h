@@ -72,6 +72,16 @@ struct DALI_SCENE3D_API BufferDefinition
    */
   bool IsAvailable();
 
+  /**
+   * @brief Creates a definition that reads the data of this buffer through its own stream.
+   *
+   * Embedded data is shared rather than copied, and external data is opened again from its uri.
+   * It allows several threads to read from the same buffer at once.
+   * @SINCE_2_3.34
+   * @return A BufferDefinition for reading. It must not outlive this buffer.
+   */
+  BufferDefinition CreateReadView();
+
 private:
   /// @cond internal
   /**
@@ -24,6 +24,7 @@
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/model-disk-cache.h>
 #include <dali-scene3d/internal/loader/dli-loader-impl.h>
 #include <dali-scene3d/internal/loader/glb-loader-impl.h>
 #include <dali-scene3d/internal/loader/gltf2-loader-impl.h>
@@ -144,7 +145,16 @@ void ModelLoader::LoadResource(Dali::Scene3D::Loader::ResourceBundle::PathProvid
 
   if(loadOnlyRawResource)
   {
+    // Meshes found in the on-disk cache already have their raw data, and are skipped by LoadRawResources().
+    auto modelsPath    = pathProvider(Dali::Scene3D::Loader::ResourceType::Mesh);
+    bool allMeshCached = Dali::Scene3D::Internal::ModelDiskCache::ReadMeshes(mModelUrl, modelsPath, GetResources());
+
     GetResources().LoadRawResources(pathProvider);
+
+    if(!allMeshCached && !GetResources().mMeshes.empty())
+    {
+      Dali::Scene3D::Internal::ModelDiskCache::WriteMeshes(mModelUrl, modelsPath, GetResources());
+    }
   }
   else
   {
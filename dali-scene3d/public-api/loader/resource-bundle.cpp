@@ -20,8 +20,10 @@
 
 // EXTERNAL INCLUDES
 #include <dali-scene3d/internal/common/image-resource-loader.h>
+#include <dali-scene3d/internal/common/resource-loader-thread-pool.h>
 #include <dali-toolkit/public-api/image-loader/sync-image-loader.h>
 #include <dali/public-api/rendering/sampler.h>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <istream>
@@ -43,6 +45,115 @@ const char* const RESOURCE_TYPE_NAMES[] = {
   "Material",
 };
 
+/**
+ * @brief The raw data of each resource, indexed the same as its definition in the ResourceBundle.
+ * Slots of resources which were not loaded are left empty.
+ */
+struct RawDataSlots
+{
+  std::vector<std::shared_ptr<EnvironmentDefinition::RawData>> mEnvironmentMaps;
+  std::vector<std::shared_ptr<ShaderDefinition::RawData>>      mShaders;
+  std::vector<std::shared_ptr<MeshDefinition::RawData>>        mMeshes;
+  std::vector<std::shared_ptr<MaterialDefinition::RawData>>    mMaterials;
+};
+
+/**
+ * @brief Loads the raw data of the referenced resources for which @a needsLoad returns true.
+ * Independent resources are loaded on the worker threads, and this returns when all of them are done.
+ */
+RawDataSlots LoadRawData(ResourceBundle& bundle, ResourceBundle::PathProvider& pathProvider, const std::function<bool(ResourceType::Value, uint32_t)>& needsLoad)
+{
+  RawDataSlots raw;
+  raw.mEnvironmentMaps.resize(bundle.mEnvironmentMaps.size());
+  raw.mShaders.resize(bundle.mShaders.size());
+  raw.mMeshes.resize(bundle.mMeshes.size());
+  raw.mMaterials.resize(bundle.mMaterials.size());
+
+  // Every job writes into its own slot only, so the result does not depend on scheduling.
+  std::vector<Dali::Scene3D::Internal::ResourceLoaderThreadPool::Job> jobs;
+
+  const auto& refCountEnvMaps  = bundle.mReferenceCounts[ResourceType::Environment];
+  auto        environmentsPath = pathProvider(ResourceType::Environment);
+  for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
+  {
+    if(refCountEnvMaps[i] > 0 && needsLoad(ResourceType::Environment, i))
+    {
+      jobs.emplace_back([&bundle, &raw, &environmentsPath, i]() {
+        raw.mEnvironmentMaps[i] = std::make_shared<EnvironmentDefinition::RawData>(bundle.mEnvironmentMaps[i].first.LoadRaw(environmentsPath));
+      });
+    }
+  }
+
+  const auto& refCountShaders = bundle.mReferenceCounts[ResourceType::Shader];
+  auto        shadersPath     = pathProvider(ResourceType::Shader);
+  for(uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
+  {
+    if(refCountShaders[i] > 0 && needsLoad(ResourceType::Shader, i))
+    {
+      jobs.emplace_back([&bundle, &raw, &shadersPath, i]() {
+        raw.mShaders[i] = std::make_shared<ShaderDefinition::RawData>(bundle.mShaders[i].first.LoadRaw(shadersPath));
+      });
+    }
+  }
+
+  const auto& refCountMaterials = bundle.mReferenceCounts[ResourceType::Material];
+  auto        imagesPath        = pathProvider(ResourceType::Material);
+  for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
+  {
+    if(refCountMaterials[i] > 0 && needsLoad(ResourceType::Material, i))
+    {
+      jobs.emplace_back([&bundle, &raw, &imagesPath, i]() {
+        raw.mMaterials[i] = std::make_shared<MaterialDefinition::RawData>(bundle.mMaterials[i].first.LoadRaw(imagesPath));
+      });
+    }
+  }
+
+  std::vector<uint32_t> meshIndices;
+  const auto&           refCountMeshes = bundle.mReferenceCounts[ResourceType::Mesh];
+  auto                  modelsPath     = pathProvider(ResourceType::Mesh);
+  for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
+  {
+    if(refCountMeshes[i] > 0 && needsLoad(ResourceType::Mesh, i))
+    {
+      meshIndices.push_back(i);
+    }
+  }
+
+  // Meshes read from the shared buffers, whose streams keep a read position. Split the meshes into
+  // one group per worker, and let each group read through its own views of the buffers.
+  std::vector<BufferDefinition::Vector> bufferViews;
+  const uint32_t                        meshCount  = static_cast<uint32_t>(meshIndices.size());
+  const uint32_t                        groupCount = (meshCount > 1u) ? std::min(meshCount, Dali::Scene3D::Internal::ResourceLoaderThreadPool::GetWorkerCount()) : meshCount;
+  if(groupCount > 1u)
+  {
+    bufferViews.resize(groupCount);
+    for(auto& views : bufferViews)
+    {
+      views.reserve(bundle.mBuffers.size());
+      for(auto& buffer : bundle.mBuffers)
+      {
+        views.push_back(buffer.CreateReadView());
+      }
+    }
+  }
+
+  for(uint32_t group = 0; group < groupCount; ++group)
+  {
+    auto& buffers = (groupCount > 1u) ? bufferViews[group] : bundle.mBuffers;
+    jobs.emplace_back([&bundle, &raw, &modelsPath, &meshIndices, &buffers, group, groupCount]() {
+      for(uint32_t j = group, jEnd = static_cast<uint32_t>(meshIndices.size()); j < jEnd; j += groupCount)
+      {
+        const auto index   = meshIndices[j];
+        raw.mMeshes[index] = std::make_shared<MeshDefinition::RawData>(bundle.mMeshes[index].first.LoadRaw(modelsPath, buffers));
+      }
+    });
+  }
+
+  Dali::Scene3D::Internal::ResourceLoaderThreadPool::ProcessJobs(jobs);
+
+  return raw;
+}
+
 } // namespace
 
 const char* GetResourceTypeName(ResourceType::Value type)
@@ -88,16 +199,30 @@ void ResourceBundle::LoadResources(PathProvider pathProvider, Options::Type opti
   const auto kForceLoad  = MaskMatch(options, Options::ForceReload);
   const auto kKeepUnused = MaskMatch(options, Options::KeepUnused);
 
-  const auto& refCountEnvMaps  = mReferenceCounts[ResourceType::Environment];
-  auto        environmentsPath = pathProvider(ResourceType::Environment);
+  // Decode everything in parallel first. DALi objects are created afterwards, in the same order as before.
+  auto raw = LoadRawData(*this, pathProvider, [&](ResourceType::Value type, uint32_t index) {
+    switch(type)
+    {
+      case ResourceType::Environment:
+        return kForceLoad || !mEnvironmentMaps[index].second.IsLoaded();
+      case ResourceType::Shader:
+        return kForceLoad || !mShaders[index].second;
+      case ResourceType::Mesh:
+        return kForceLoad || !mMeshes[index].second.geometry;
+      case ResourceType::Material:
+        return kForceLoad || !mMaterials[index].second;
+    }
+    return false;
+  });
+
+  const auto& refCountEnvMaps = mReferenceCounts[ResourceType::Environment];
   for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountEnvMaps[i];
     auto& iEnvMap  = mEnvironmentMaps[i];
-    if(refCount > 0 && (kForceLoad || !iEnvMap.second.IsLoaded()))
+    if(raw.mEnvironmentMaps[i])
     {
-      auto raw       = iEnvMap.first.LoadRaw(environmentsPath);
-      iEnvMap.second = iEnvMap.first.Load(std::move(raw));
+      iEnvMap.second = iEnvMap.first.Load(std::move(*raw.mEnvironmentMaps[i]));
     }
     else if(!kKeepUnused && refCount == 0 && iEnvMap.second.IsLoaded())
     {
@@ -107,15 +232,13 @@ void ResourceBundle::LoadResources(PathProvider pathProvider, Options::Type opti
   }
 
   const auto& refCountShaders = mReferenceCounts[ResourceType::Shader];
-  auto        shadersPath     = pathProvider(ResourceType::Shader);
   for(uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountShaders[i];
     auto& iShader  = mShaders[i];
-    if(refCount > 0 && (kForceLoad || !iShader.second))
+    if(raw.mShaders[i])
     {
-      auto raw       = iShader.first.LoadRaw(shadersPath);
-      iShader.second = iShader.first.Load(std::move(raw));
+      iShader.second = iShader.first.Load(std::move(*raw.mShaders[i]));
     }
     else if(!kKeepUnused && refCount == 0 && iShader.second)
     {
@@ -124,15 +247,13 @@ void ResourceBundle::LoadResources(PathProvider pathProvider, Options::Type opti
   }
 
   const auto& refCountMeshes = mReferenceCounts[ResourceType::Mesh];
-  auto        modelsPath     = pathProvider(ResourceType::Mesh);
   for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountMeshes[i];
     auto& iMesh    = mMeshes[i];
-    if(refCount > 0 && (kForceLoad || !iMesh.second.geometry))
+    if(raw.mMeshes[i])
     {
-      auto raw     = iMesh.first.LoadRaw(modelsPath, mBuffers);
-      iMesh.second = iMesh.first.Load(std::move(raw));
+      iMesh.second = iMesh.first.Load(std::move(*raw.mMeshes[i]));
     }
     else if(!kKeepUnused && refCount == 0 && iMesh.second.geometry)
     {
@@ -141,15 +262,13 @@ void ResourceBundle::LoadResources(PathProvider pathProvider, Options::Type opti
   }
 
   const auto& refCountMaterials = mReferenceCounts[ResourceType::Material];
-  auto        imagesPath        = pathProvider(ResourceType::Material);
   for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
   {
     auto  refCount  = refCountMaterials[i];
     auto& iMaterial = mMaterials[i];
-    if(refCount > 0 && (kForceLoad || !iMaterial.second))
+    if(raw.mMaterials[i])
     {
-      auto raw         = iMaterial.first.LoadRaw(imagesPath);
-      iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(raw));
+      iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(*raw.mMaterials[i]));
     }
     else if(!kKeepUnused && refCount == 0 && iMaterial.second)
     {
@@ -172,51 +291,50 @@ void ResourceBundle::LoadRawResources(PathProvider pathProvider, Options::Type o
   {
     mRawResourcesLoading = true;
 
-    const auto& refCountEnvMaps  = mReferenceCounts[ResourceType::Environment];
-    auto        environmentsPath = pathProvider(ResourceType::Environment);
-    for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
+    auto raw = LoadRawData(*this, pathProvider, [&](ResourceType::Value type, uint32_t index) {
+      switch(type)
+      {
+        case ResourceType::Environment:
+          return kForceLoad || (!mEnvironmentMaps[index].first.mRawData && !mEnvironmentMaps[index].second.IsLoaded());
+        case ResourceType::Shader:
+          return kForceLoad || !mShaders[index].second;
+        case ResourceType::Mesh:
+          return kForceLoad || (!mMeshes[index].first.mRawData && !mMeshes[index].second.geometry);
+        case ResourceType::Material:
+          return kForceLoad || (!mMaterials[index].first.mRawData && !mMaterials[index].second);
+      }
+      return false;
+    });
+
+    for(uint32_t i = 0, iEnd = raw.mEnvironmentMaps.size(); i != iEnd; ++i)
     {
-      auto  refCount = refCountEnvMaps[i];
-      auto& iEnvMap  = mEnvironmentMaps[i];
-      if(refCount > 0 && (kForceLoad || (!iEnvMap.first.mRawData && !iEnvMap.second.IsLoaded())))
+      if(raw.mEnvironmentMaps[i])
       {
-        iEnvMap.first.mRawData = std::make_shared<EnvironmentDefinition::RawData>(iEnvMap.first.LoadRaw(environmentsPath));
+        mEnvironmentMaps[i].first.mRawData = std::move(raw.mEnvironmentMaps[i]);
       }
     }
 
-    const auto& refCountShaders = mReferenceCounts[ResourceType::Shader];
-    auto        shadersPath     = pathProvider(ResourceType::Shader);
-    for(uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
+    for(uint32_t i = 0, iEnd = raw.mShaders.size(); i != iEnd; ++i)
     {
-      auto  refCount = refCountShaders[i];
-      auto& iShader  = mShaders[i];
-      if(refCount > 0 && (kForceLoad || !iShader.second))
+      if(raw.mShaders[i])
       {
-        iShader.first.mRawData = std::make_shared<ShaderDefinition::RawData>(iShader.first.LoadRaw(shadersPath));
+        mShaders[i].first.mRawData = std::move(raw.mShaders[i]);
       }
     }
 
-    const auto& refCountMeshes = mReferenceCounts[ResourceType::Mesh];
-    auto        modelsPath     = pathProvider(ResourceType::Mesh);
-    for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
+    for(uint32_t i = 0, iEnd = raw.mMeshes.size(); i != iEnd; ++i)
     {
-      auto  refCount = refCountMeshes[i];
-      auto& iMesh    = mMeshes[i];
-      if(refCount > 0 && (kForceLoad || (!iMesh.first.mRawData && !iMesh.second.geometry)))
+      if(raw.mMeshes[i])
       {
-        iMesh.first.mRawData = std::make_shared<MeshDefinition::RawData>(iMesh.first.LoadRaw(modelsPath, mBuffers));
+        mMeshes[i].first.mRawData = std::move(raw.mMeshes[i]);
       }
     }
 
-    const auto& refCountMaterials = mReferenceCounts[ResourceType::Material];
-    auto        imagesPath        = pathProvider(ResourceType::Material);
-    for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
+    for(uint32_t i = 0, iEnd = raw.mMaterials.size(); i != iEnd; ++i)
     {
-      auto  refCount  = refCountMaterials[i];
-      auto& iMaterial = mMaterials[i];
-      if(refCount > 0 && (kForceLoad || (!iMaterial.first.mRawData && !iMaterial.second)))
+      if(raw.mMaterials[i])
       {
-        iMaterial.first.mRawData = std::make_shared<MaterialDefinition::RawData>(iMaterial.first.LoadRaw(imagesPath));
+        mMaterials[i].first.mRawData = std::move(raw.mMaterials[i]);
       }
     }
 
@@ -24,6 +24,7 @@
 #include <cstring>
 
 // INTERNAL INCLUDES
+#include <dali-scene3d/internal/common/shader-variant-cache.h>
 #include <dali-scene3d/internal/light/light-impl.h>
 #include <dali-scene3d/internal/loader/hash.h>
 #include <dali-scene3d/public-api/loader/blend-shape-details.h>
@@ -235,17 +236,18 @@ Dali::Shader ShaderManager::ProduceShader(const ShaderOption& shaderOption)
   {
     DALI_LOG_INFO(gLogFilter, Debug::Concise, "Creating new shader: hash: %lx\n", hash);
     ShaderDefinition shaderDef;
-    shaderDef.mUseBuiltInShader = true;
-
-    shaderOption.GetDefines(shaderDef.mDefines);
-    shaderDef.mMacros                  = shaderOption.GetMacroDefinitions();
+    shaderDef.mUseBuiltInShader        = true;
     shaderDef.mUniforms["uCubeMatrix"] = Matrix::IDENTITY;
 
     shaderMap[hash] = mImpl->mShaders.size();
 
-    auto raw = shaderDef.LoadRaw("");
+    // The sources are shared by all ShaderManagers, and may have been prepared already by WarmUp().
+    // The light and shadow properties below are still registered per manager.
+    DALI_LOG_INFO(gLogFilter, Debug::Concise, "Shader variant %s: hash: %lx\n", Scene3D::Internal::ShaderVariantCache::IsCached(hash) ? "warmed" : "not warmed", hash);
+    ShaderDefinition::RawData raw = *Scene3D::Internal::ShaderVariantCache::GetRawData(shaderOption);
     mImpl->mShaders.emplace_back(shaderDef.Load(std::move(raw)));
     result = mImpl->mShaders.back();
+    Scene3D::Internal::ShaderVariantCache::ReleasePrecompileShaders(hash);
 
     std::string lightCountPropertyName(Scene3D::Internal::Light::GetLightCountUniformName());
     result.RegisterProperty(lightCountPropertyName, static_cast<int32_t>(mImpl->mLights.size()));
@@ -266,6 +268,11 @@ Dali::Shader ShaderManager::ProduceShader(const ShaderOption& shaderOption)
   return result;
 }
 
+void ShaderManager::WarmUp(const std::vector<ShaderOption>& shaderOptions)
+{
+  Scene3D::Internal::ShaderVariantCache::RequestPrepare(shaderOptions);
+}
+
 RendererState::Type ShaderManager::GetRendererState(const MaterialDefinition& materialDefinition)
 {
   RendererState::Type rendererState = RendererState::DEPTH_TEST;
@@ -73,6 +73,17 @@ public:
    */
   Dali::Shader ProduceShader(const ShaderOption& shaderOption);
 
+  /**
+   * @brief Requests to prepare the shaders of the input ShaderOptions in the background.
+   *
+   * Prepared shader sources are shared by every ShaderManager in the process, so that ProduceShader() of
+   * any SceneView doesn't need to build them again.
+   * @SINCE_2_3.34
+   * @param[in] shaderOptions shader options to prepare.
+   * @note This method should be called from the main thread.
+   */
+  static void WarmUp(const std::vector<ShaderOption>& shaderOptions);
+
   /**
    * @brief Returns RendererState of the input materialDefinition.
    * @SINCE_2_2.34
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/quad-batch-view/quad-batch-view.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/quad-batch-view/quad-batch-view-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+QuadBatchView::QuadBatchView()
+{
+}
+
+QuadBatchView::QuadBatchView(const QuadBatchView& quadBatchView)
+: Control(quadBatchView)
+{
+}
+
+QuadBatchView::QuadBatchView(QuadBatchView&& rhs) = default;
+
+QuadBatchView& QuadBatchView::operator=(const QuadBatchView& rhs)
+{
+  if(&rhs != this)
+  {
+    Control::operator=(rhs);
+  }
+  return *this;
+}
+
+QuadBatchView& QuadBatchView::operator=(QuadBatchView&& rhs) = default;
+
+QuadBatchView::~QuadBatchView()
+{
+}
+
+QuadBatchView QuadBatchView::New()
+{
+  return Internal::QuadBatchView::New();
+}
+
+QuadBatchView QuadBatchView::DownCast(BaseHandle handle)
+{
+  return Control::DownCast<QuadBatchView, Internal::QuadBatchView>(handle);
+}
+
+Property::Map QuadBatchView::GetStatistics() const
+{
+  return Dali::Toolkit::GetImpl(*this).GetStatistics();
+}
+
+QuadBatchView::QuadBatchView(Internal::QuadBatchView& implementation)
+: Control(implementation)
+{
+}
+
+QuadBatchView::QuadBatchView(Dali::Internal::CustomActor* internal)
+: Control(internal)
+{
+  VerifyCustomActorPointer<Internal::QuadBatchView>(internal);
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,167 @@
+#ifndef DALI_TOOLKIT_QUAD_BATCH_VIEW_H
+#define DALI_TOOLKIT_QUAD_BATCH_VIEW_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class QuadBatchView;
+}
+/**
+ * @addtogroup dali_toolkit_controls_quad_batch_view
+ * @{
+ */
+
+/**
+ * @brief QuadBatchView draws the plain color backgrounds of its descendants with a single renderer.
+ *
+ * Every control draws its background color visual with its own renderer, so a grid of colored tiles
+ * costs a draw call per tile even though they share the shader and the state. The backgrounds of
+ * the descendants of a QuadBatchView are merged into a vertex buffer drawn by the view instead.
+ *
+ * A background is batched only while it's a color visual without a corner radius, a borderline, a blur
+ * or a custom shader, while neither the control nor its parents are rotated or scaled, and while they use
+ * the default color mode. The other descendants draw their background as usual.
+ *
+ * As the batched backgrounds are drawn by the view, they're drawn below all the descendants. To keep the
+ * drawing order, a background is not batched while it overlaps another descendant which draws something,
+ * except its own descendants, or while one of its parents draws something but a batched background.
+ *
+ * The batch is updated when a property of a descendant which changes the quads is set, or a descendant is
+ * relaid out. Only the quads of the changed descendants are rebuilt. Animations of the descendants are not
+ * followed, so they are expected to be static.
+ *
+ * @code
+ *    QuadBatchView batchView = QuadBatchView::New();
+ *    for(auto& tile : tiles)
+ *    {
+ *      batchView.Add(tile); // The tiles have a background color.
+ *    }
+ * @endcode
+ */
+class DALI_TOOLKIT_API QuadBatchView : public Control
+{
+public:
+  /**
+   * @brief Creates an uninitialized QuadBatchView.
+   */
+  QuadBatchView();
+
+  /**
+   * @brief Creates an initialized QuadBatchView.
+   *
+   * @return A handle to a newly allocated QuadBatchView
+   */
+  static QuadBatchView New();
+
+  /**
+   * @brief Destructor.
+   *
+   * This is non-virtual since derived Handle types must not contain data or virtual methods.
+   */
+  ~QuadBatchView();
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param[in] quadBatchView QuadBatchView to copy. The copied QuadBatchView will point at the same implementation
+   */
+  QuadBatchView(const QuadBatchView& quadBatchView);
+
+  /**
+   * @brief Move constructor
+   *
+   * @param[in] rhs A reference to the moved handle
+   */
+  QuadBatchView(QuadBatchView&& rhs);
+
+  /**
+   * @brief Assignment operator.
+   *
+   * @param[in] quadBatchView The QuadBatchView to assign from
+   * @return The updated QuadBatchView
+   */
+  QuadBatchView& operator=(const QuadBatchView& quadBatchView);
+
+  /**
+   * @brief Move assignment
+   *
+   * @param[in] rhs A reference to the moved handle
+   * @return A reference to this
+   */
+  QuadBatchView& operator=(QuadBatchView&& rhs);
+
+  /**
+   * @brief Downcasts a handle to QuadBatchView handle.
+   *
+   * If handle points to a QuadBatchView, the downcast produces valid handle.
+   * If not, the returned handle is left uninitialized.
+   *
+   * @param[in] handle Handle to an object
+   * @return Handle to a QuadBatchView or an uninitialized handle
+   */
+  static QuadBatchView DownCast(BaseHandle handle);
+
+  /**
+   * @brief Retrieves the statistics of the batch.
+   *
+   * The map has the following integer values:
+   * - "batchedVisuals" : The number of the backgrounds drawn by the view.
+   * - "drawCallsSaved" : The number of the draw calls saved by batching the visible backgrounds.
+   * - "updatedQuads" : The number of the quads rebuilt since the view was created.
+   *
+   * @return The map of the statistics
+   */
+  Property::Map GetStatistics() const;
+
+public: // Not intended for application developers
+  /// @cond internal
+  /**
+   * @brief Creates a handle using the Toolkit::Internal implementation.
+   *
+   * @param[in] implementation The QuadBatchView implementation
+   */
+  DALI_INTERNAL QuadBatchView(Internal::QuadBatchView& implementation);
+
+  /**
+   * @brief Allows the creation of this QuadBatchView from an Internal::CustomActor pointer.
+   *
+   * @param[in] internal A pointer to the internal CustomActor
+   */
+  DALI_INTERNAL QuadBatchView(Dali::Internal::CustomActor* internal);
+  /// @endcond
+};
+
+/**
+ * @}
+ */
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_QUAD_BATCH_VIEW_H
@@ -0,0 +1,57 @@
+#ifndef DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
+#define DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelBackgroundBlurEffect
+{
+/**
+ * @brief The algorithm used to blur.
+ */
+enum class BlurAlgorithm
+{
+  GAUSSIAN,   ///< Separable Gaussian blur. Its cost and its shader depend on the blur radius.
+  DUAL_FILTER ///< Dual filter blur, down- and upsampling through a chain of half-sized targets. Its cost barely depends on the blur radius, and one shader covers all radii.
+};
+
+/**
+ * @brief Creates an initialized BackgroundBlurEffect with the given algorithm.
+ *
+ * The dual filter suits large radii: each level of its chain doubles the reach of the blur, while
+ * every pass takes a fixed number of samples.
+ * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
+ * @param[in] blurRadius The radius of the blur.
+ * @param[in] algorithm The algorithm used to blur.
+ * @return A handle to a newly allocated Dali resource
+ */
+DALI_TOOLKIT_API BackgroundBlurEffect New(float downscaleFactor, uint32_t blurRadius, BlurAlgorithm algorithm);
+
+} // namespace DevelBackgroundBlurEffect
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_BACKGROUND_BLUR_EFFECT_DEVEL_H
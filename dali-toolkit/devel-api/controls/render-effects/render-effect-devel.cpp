@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/render-effects/render-effect-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/render-effects/render-target-pool.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelRenderEffect
+{
+uint32_t GetSharedRenderTargetBytes()
+{
+  Internal::RenderTargetPool pool = Internal::RenderTargetPool::Get();
+  return pool ? pool.GetPooledBytes() : 0u;
+}
+
+} // namespace DevelRenderEffect
+
+} // namespace Toolkit
+
+} // namespace Dali
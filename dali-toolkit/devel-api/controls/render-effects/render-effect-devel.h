@@ -0,0 +1,48 @@
+#ifndef DALI_TOOLKIT_RENDER_EFFECT_DEVEL_H
+#define DALI_TOOLKIT_RENDER_EFFECT_DEVEL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelRenderEffect
+{
+/**
+ * @brief Retrieves the GPU memory used by the pooled intermediate render targets of render effects.
+ *
+ * It covers the targets shared by the active effects and the few released ones kept for reuse by the
+ * next effect of a similar size. It can be used for profiling.
+ * @return The size of the pooled render targets in bytes.
+ */
+DALI_TOOLKIT_API uint32_t GetSharedRenderTargetBytes();
+
+} // namespace DevelRenderEffect
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_RENDER_EFFECT_DEVEL_H
@@ -29,6 +29,9 @@
 #include <dali/integration-api/adaptor-framework/scene-holder.h>
 #include <dali/public-api/actors/layer.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/focus-manager/focus-finder-impl.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -309,6 +312,38 @@ static bool BeamBeats(Dali::Toolkit::Control::KeyboardFocus::Direction direction
   return (MajorAxisDistance(direction, source, rect1) < MajorAxisDistanceToFarEdge(direction, source, rect2));
 }
 
+Actor FindNextFocus(Actor& actor, Actor& focusedActor, Rect<float>& focusedRect, Rect<float>& bestCandidateRect, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  Actor nearestActor;
+  if(actor && actor.GetProperty<bool>(Actor::Property::VISIBLE) && actor.GetProperty<bool>(DevelActor::Property::KEYBOARD_FOCUSABLE_CHILDREN))
+  {
+    // Recursively children
+    const auto childCount = actor.GetChildCount();
+    for(auto i = childCount; i > 0u; --i)
+    {
+      Dali::Actor child = actor.GetChildAt(i-1);
+      if(child && child != focusedActor && IsFocusable(child))
+      {
+        Rect<float> candidateRect = GetScreenRect(child);
+
+        if(IsBetterCandidate(direction, focusedRect, candidateRect, bestCandidateRect))
+        {
+          bestCandidateRect = candidateRect;
+          nearestActor      = child;
+        }
+      }
+      Actor nextActor = FindNextFocus(child, focusedActor, focusedRect, bestCandidateRect, direction);
+      if(nextActor)
+      {
+        nearestActor = nextActor;
+      }
+    }
+  }
+  return nearestActor;
+}
+
+} // unnamed namespace
+
 bool IsBetterCandidate(Toolkit::Control::KeyboardFocus::Direction direction, Rect<float>& focusedRect, Rect<float>& candidateRect, Rect<float>& bestCandidateRect)
 {
   // to be a better candidate, need to at least be a candidate in the first place
@@ -348,40 +383,24 @@ bool IsFocusable(Actor& actor)
           actor.GetProperty<Vector4>(Actor::Property::WORLD_COLOR).a > FULLY_TRANSPARENT);
 }
 
-Actor FindNextFocus(Actor& actor, Actor& focusedActor, Rect<float>& focusedRect, Rect<float>& bestCandidateRect, Toolkit::Control::KeyboardFocus::Direction direction)
+bool IsInBeam(Toolkit::Control::KeyboardFocus::Direction direction, const Rect<float>& focusedRect, const Rect<float>& candidateRect)
 {
-  Actor nearestActor;
-  if(actor && actor.GetProperty<bool>(Actor::Property::VISIBLE) && actor.GetProperty<bool>(DevelActor::Property::KEYBOARD_FOCUSABLE_CHILDREN))
-  {
-    // Recursively children
-    const auto childCount = actor.GetChildCount();
-    for(auto i = childCount; i > 0u; --i)
-    {
-      Dali::Actor child = actor.GetChildAt(i-1);
-      if(child && child != focusedActor && IsFocusable(child))
-      {
-        Rect<float> candidateRect = DevelActor::CalculateCurrentScreenExtents(child);
-
-        // convert x, y, width, height -> left, right, bottom, top
-        ConvertCoordinate(candidateRect);
+  return BeamsOverlap(direction, focusedRect, candidateRect);
+}
 
-        if(IsBetterCandidate(direction, focusedRect, candidateRect, bestCandidateRect))
-        {
-          bestCandidateRect = candidateRect;
-          nearestActor      = child;
-        }
-      }
-      Actor nextActor = FindNextFocus(child, focusedActor, focusedRect, bestCandidateRect, direction);
-      if(nextActor)
-      {
-        nearestActor = nextActor;
-      }
-    }
-  }
-  return nearestActor;
+uint64_t GetWeightedDistance(Toolkit::Control::KeyboardFocus::Direction direction, const Rect<float>& focusedRect, const Rect<float>& candidateRect)
+{
+  return GetWeightedDistanceFor(MajorAxisDistance(direction, focusedRect, candidateRect), MinorAxisDistance(direction, focusedRect, candidateRect));
 }
 
-} // unnamed namespace
+Rect<float> GetScreenRect(Actor actor)
+{
+  Rect<float> rect = DevelActor::CalculateCurrentScreenExtents(actor);
+
+  // convert x, y, width, height -> left, right, bottom, top
+  ConvertCoordinate(rect);
+  return rect;
+}
 
 Actor GetNearestFocusableActor(Actor rootActor, Actor focusedActor, Toolkit::Control::KeyboardFocus::Direction direction)
 {
@@ -65,6 +65,16 @@ void ResetFocusFinderRootActor(KeyboardFocusManager keyboardFocusManager)
   GetImpl(keyboardFocusManager).ResetFocusFinderRootActor();
 }
 
+void EnableFocusSpatialIndex(KeyboardFocusManager keyboardFocusManager, bool enable)
+{
+  GetImpl(keyboardFocusManager).EnableFocusSpatialIndex(enable);
+}
+
+bool IsFocusSpatialIndexEnabled(KeyboardFocusManager keyboardFocusManager)
+{
+  return GetImpl(keyboardFocusManager).IsFocusSpatialIndexEnabled();
+}
+
 } // namespace DevelKeyboardFocusManager
 
 } // namespace Toolkit
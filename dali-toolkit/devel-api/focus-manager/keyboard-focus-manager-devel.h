@@ -131,6 +131,24 @@ DALI_TOOLKIT_API void SetFocusFinderRootActor(KeyboardFocusManager keyboardFocus
  */
 DALI_TOOLKIT_API void ResetFocusFinderRootActor(KeyboardFocusManager keyboardFocusManager);
 
+/**
+ * @brief Decide whether the default algorithm uses a spatial index of the focusable actors.
+ *
+ * The index spares visiting and measuring every actor under the root on each focus move, which helps UIs with many actors.
+ * It is updated per actor when actors are added, removed, shown, hidden, made focusable, relaid out or moved. Moves are
+ * watched with a property notification on the world position of each focusable actor.
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @param[in] enable Whether the default algorithm uses a spatial index
+ */
+DALI_TOOLKIT_API void EnableFocusSpatialIndex(KeyboardFocusManager keyboardFocusManager, bool enable);
+
+/**
+ * @brief Check whether the default algorithm uses a spatial index.
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @return True when the spatial index is enabled
+ */
+DALI_TOOLKIT_API bool IsFocusSpatialIndexEnabled(KeyboardFocusManager keyboardFocusManager);
+
 } // namespace DevelKeyboardFocusManager
 
 } // namespace Toolkit
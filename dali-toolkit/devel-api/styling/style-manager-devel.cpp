@@ -45,6 +45,11 @@ std::vector<std::string> GetBrokenImageUrlList(StyleManager styleManager)
   return GetImpl(styleManager).GetBrokenImageUrlList();
 }
 
+void SetStylePrecompileEnabled(StyleManager styleManager, bool enabled)
+{
+  GetImpl(styleManager).SetStylePrecompileEnabled(enabled);
+}
+
 BrokenImageChangedSignalType& BrokenImageChangedSignal(StyleManager styleManager)
 {
   return GetImpl(styleManager).BrokenImageChangedSignal();
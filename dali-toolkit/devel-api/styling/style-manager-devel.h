@@ -76,6 +76,19 @@ DALI_TOOLKIT_API std::string GetBrokenImageUrl(StyleManager styleManager, DevelS
  */
 DALI_TOOLKIT_API std::vector<std::string> GetBrokenImageUrlList(StyleManager styleManager);
 
+/**
+ * @brief Sets whether the styles of the theme are precompiled when the main loop is idle.
+ *
+ * A style is built from the theme when the first control of its type is created, which may cost a frame
+ * when many types of controls are shown for the first time. When it's enabled, the styles of the control types
+ * in the theme are built a few at a time in the idle callbacks after the theme is loaded, so that they are ready
+ * before the application creates the controls. No control is created to build them.
+ *
+ * @param[in] styleManager The instance of StyleManager
+ * @param[in] enabled True to precompile the styles. The default is false
+ */
+DALI_TOOLKIT_API void SetStylePrecompileEnabled(StyleManager styleManager, bool enabled);
+
 /**
  * @brief This signal is emitted when the URL of the broken image is set
  *
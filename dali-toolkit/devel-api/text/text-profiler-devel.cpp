@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/text/text-profiler-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/text-controls/text-editor-impl.h>
+#include <dali-toolkit/internal/controls/text-controls/text-field-impl.h>
+#include <dali-toolkit/internal/controls/text-controls/text-label-impl.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace TextProfiler
+{
+Property::Map GetStatistics()
+{
+  return Profiler::GetProcessStatistics();
+}
+
+Property::Map GetStatistics(TextLabel label)
+{
+  return GetImpl(label).GetTextController()->GetProfilerStatistics().GetStatistics();
+}
+
+Property::Map GetStatistics(TextField field)
+{
+  return GetImpl(field).GetTextController()->GetProfilerStatistics().GetStatistics();
+}
+
+Property::Map GetStatistics(TextEditor editor)
+{
+  return GetImpl(editor).GetTextController()->GetProfilerStatistics().GetStatistics();
+}
+
+void ResetStatistics()
+{
+  Profiler::ResetProcessStatistics();
+}
+
+std::string DumpStatistics()
+{
+  return Profiler::DumpProcessStatistics();
+}
+
+} // namespace TextProfiler
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,129 @@
+#ifndef DALI_TOOLKIT_TEXT_PROFILER_DEVEL_H
+#define DALI_TOOLKIT_TEXT_PROFILER_DEVEL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/text-controls/text-editor.h>
+#include <dali-toolkit/public-api/controls/text-controls/text-field.h>
+#include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Counters of the time spent in each stage of the text pipeline.
+ *
+ * Every text controller counts the stages it runs, and so does the whole process.
+ * The counters are always on: each stage only reads the clock when it starts and
+ * when it ends, then updates a few integers.
+ *
+ * The statistics are retrieved as a map with an entry per stage, named as in Stage::Type:
+ * @code
+ * {
+ *   "shaping" : { "count" : 12, "totalTime" : 1.52, "maxTime" : 0.43, "histogram" : [ 3, 5, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0 ] },
+ *   ...
+ *   "histogramBounds" : [ 0.016, 0.032, 0.064, ... ]
+ * }
+ * @endcode
+ * The times are in milliseconds. The histogram counts the runs of a stage by duration,
+ * and "histogramBounds" holds the upper bound of each bucket but the last one, which has no bound.
+ */
+namespace TextProfiler
+{
+namespace Stage
+{
+/**
+ * @brief The stages of the text pipeline.
+ */
+enum Type
+{
+  SEGMENTATION,     ///< "segmentation" The line and word break info of the text.
+  BIDI,             ///< "bidi" The bidirectional info and the mirrored text.
+  FONT_VALIDATION,  ///< "fontValidation" The scripts of the text and the validation of its fonts.
+  SHAPING,          ///< "shaping" The shaping of the text into glyphs.
+  LAYOUT,           ///< "layout" The layout of the glyphs in lines, including the ellipsis of the layout engine.
+  ELLIPSIS,         ///< "ellipsis" The ellipsis of the glyphs being rendered by the typesetter. Process-wide only.
+  TYPESETTING,      ///< "typesetting" The rendering of the laid-out text into textures or meshes.
+  ATLAS_UPLOAD,     ///< "atlasUpload" The upload of glyphs into the text atlas. Process-wide only.
+  GLYPH_CACHE_MISS, ///< "glyphCacheMiss" The rasterization of glyphs missing from the text atlas. Process-wide only.
+  COUNT
+};
+} // namespace Stage
+
+/**
+ * @brief Retrieves the statistics of the whole process.
+ *
+ * @return The statistics of each stage.
+ */
+DALI_TOOLKIT_API Property::Map GetStatistics();
+
+/**
+ * @brief Retrieves the statistics of a text label.
+ *
+ * @param[in] label The text label.
+ * @return The statistics of each stage.
+ */
+DALI_TOOLKIT_API Property::Map GetStatistics(TextLabel label);
+
+/**
+ * @brief Retrieves the statistics of a text field.
+ *
+ * @param[in] field The text field.
+ * @return The statistics of each stage.
+ */
+DALI_TOOLKIT_API Property::Map GetStatistics(TextField field);
+
+/**
+ * @brief Retrieves the statistics of a text editor.
+ *
+ * @param[in] editor The text editor.
+ * @return The statistics of each stage.
+ */
+DALI_TOOLKIT_API Property::Map GetStatistics(TextEditor editor);
+
+/**
+ * @brief Resets the statistics of the whole process.
+ *
+ * The statistics of the text controls are not reset.
+ */
+DALI_TOOLKIT_API void ResetStatistics();
+
+/**
+ * @brief Writes the statistics of the whole process to the log, and returns them as text.
+ *
+ * @return The statistics, a line per stage.
+ */
+DALI_TOOLKIT_API std::string DumpStatistics();
+
+} // namespace TextProfiler
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif //DALI_TOOLKIT_TEXT_PROFILER_DEVEL_H
@@ -24,6 +24,7 @@
 #include <dali/devel-api/text-abstraction/text-renderer-layout-helper.h>
 #include <dali/devel-api/text-abstraction/text-renderer.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
@@ -1177,6 +1178,47 @@ Devel::PixelBuffer Render(const RendererParameters& textParameters, Vector<Embed
   return RenderText(textParameters, rendererParameters);
 }
 
+/**
+ * @brief Retrieves the rectangle [left, right) x [top, bottom) which contains the opaque pixels of the input and their shadow.
+ *
+ * The rectangle is empty if every pixel of the input is transparent.
+ */
+void GetShadowRegion(const unsigned char* const inputPixelBuffer, int width, int height, unsigned int inputPixelSize, int xOffset, int yOffset, int& left, int& top, int& right, int& bottom)
+{
+  // The alpha is the last byte of a pixel, or the only one of an alpha mask.
+  const unsigned int alphaIndex = inputPixelSize - 1u;
+
+  int glyphsLeft   = width;
+  int glyphsTop    = height;
+  int glyphsRight  = 0;
+  int glyphsBottom = 0;
+  for(int rowIndex = 0; rowIndex < height; ++rowIndex)
+  {
+    const unsigned char* const row = inputPixelBuffer + inputPixelSize * static_cast<unsigned int>(rowIndex * width) + alphaIndex;
+    for(int columnIndex = 0; columnIndex < width; ++columnIndex)
+    {
+      if(row[inputPixelSize * static_cast<unsigned int>(columnIndex)] != 0u)
+      {
+        glyphsLeft   = std::min(glyphsLeft, columnIndex);
+        glyphsRight  = std::max(glyphsRight, columnIndex + 1);
+        glyphsTop    = std::min(glyphsTop, rowIndex);
+        glyphsBottom = rowIndex + 1;
+      }
+    }
+  }
+
+  if(glyphsTop >= glyphsBottom)
+  {
+    left = top = right = bottom = 0;
+    return;
+  }
+
+  left   = std::max(std::min(glyphsLeft, glyphsLeft + xOffset), 0);
+  top    = std::max(std::min(glyphsTop, glyphsTop + yOffset), 0);
+  right  = std::min(std::max(glyphsRight, glyphsRight + xOffset), width);
+  bottom = std::min(std::max(glyphsBottom, glyphsBottom + yOffset), height);
+}
+
 Devel::PixelBuffer CreateShadow(const ShadowParameters& shadowParameters)
 {
   // The size of the pixel data.
@@ -1209,8 +1251,19 @@ Devel::PixelBuffer CreateShadow(const ShadowParameters& shadowParameters)
   }
   const float* const shadowColor = shadowParameters.color.AsFloat();
 
+  // Only the pixels around the glyphs and their shadow need to be written, as the rest stay transparent.
+  // Without blending, an alpha mask writes the text color in every pixel, so the whole buffer is traversed.
+  int left   = 0;
+  int top    = 0;
+  int right  = width;
+  int bottom = height;
+  if(shadowParameters.blendShadow || !isA8 || (textColor[3u] <= Dali::Math::MACHINE_EPSILON_1000))
+  {
+    GetShadowRegion(inputPixelBuffer, width, height, inputPixelSize, xOffset, yOffset, left, top, right, bottom);
+  }
+
   // Traverse the input pixel buffer and write the text on the foreground and the shadow on the background.
-  for(int rowIndex = 0; rowIndex < height; ++rowIndex)
+  for(int rowIndex = top; rowIndex < bottom; ++rowIndex)
   {
     // Calculates the rowIndex to the input pixel buffer for the shadow and whether it's within the boundaries.
     const int  yOffsetIndex    = rowIndex - yOffset;
@@ -1218,7 +1271,7 @@ Devel::PixelBuffer CreateShadow(const ShadowParameters& shadowParameters)
 
     const int rows       = rowIndex * width;
     const int offsetRows = yOffsetIndex * width;
-    for(int columnIndex = 0; columnIndex < width; ++columnIndex)
+    for(int columnIndex = left; columnIndex < right; ++columnIndex)
     {
       // Index to the input buffer to retrieve the alpha value of the foreground text.
       const unsigned int index = inputPixelSize * static_cast<unsigned int>(rows + columnIndex);
@@ -0,0 +1,126 @@
+#ifndef DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class VisualDescriptor;
+}
+
+/**
+ * @brief A property map of a visual parsed once to create many visuals.
+ *
+ * Creating a visual from a property map looks up the visual type, parses the url and compares
+ * the string keys and the enumeration names of the map every time. A descriptor does it once
+ * and keeps the result, so that the views creating the same visual for every item of a list
+ * only stamp out the visuals with VisualFactory::CreateVisual(const VisualDescriptor&).
+ *
+ * The descriptor is immutable. Create another descriptor to change the properties.
+ *
+ * @code
+ * VisualDescriptor descriptor = VisualDescriptor::New(propertyMap);
+ * for(auto& item : items)
+ * {
+ *   item.visual = VisualFactory::Get().CreateVisual(descriptor);
+ * }
+ * @endcode
+ */
+class DALI_TOOLKIT_API VisualDescriptor : public BaseHandle
+{
+public:
+  /**
+   * @brief Create an uninitialized handle
+   *
+   * @SINCE_2_3.34
+   */
+  VisualDescriptor();
+
+  /**
+   * @brief Destructor - non virtual
+   *
+   * @SINCE_2_3.34
+   */
+  ~VisualDescriptor();
+
+  /**
+   * @brief Creates a VisualDescriptor object
+   *
+   * @SINCE_2_3.34
+   * @param[in] propertyMap The map contains the properties required by the visual, as passed to VisualFactory::CreateVisual().
+   * @return A handle to an initialized descriptor.
+   */
+  static VisualDescriptor New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Downcast to a VisualDescriptor handle
+   *
+   * @SINCE_2_3.34
+   * If handle is not a VisualDescriptor, the returned handle is left uninitialized.
+   * @param[in] handle Handle to an object
+   * @return VisualDescriptor handle or an uninitialized handle.
+   */
+  static VisualDescriptor DownCast(BaseHandle handle);
+
+  /**
+   * @brief Copy constructor
+   *
+   * @SINCE_2_3.34
+   * @param[in] handle Handle to an object
+   */
+  VisualDescriptor(const VisualDescriptor& handle);
+
+  /**
+   * @brief Assignment Operator
+   *
+   * @SINCE_2_3.34
+   * @param[in] handle Handle to an object
+   * @return A reference to this object.
+   */
+  VisualDescriptor& operator=(const VisualDescriptor& handle);
+
+  /**
+   * @brief Retrieves the parsed properties the visuals are created with.
+   *
+   * The string keys and the enumeration names known to the visual type are converted to
+   * the indices and the integers.
+   *
+   * @SINCE_2_3.34
+   * @return The parsed property map
+   */
+  const Property::Map& GetPropertyMap() const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL VisualDescriptor(Internal::VisualDescriptor* impl);
+};
+
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
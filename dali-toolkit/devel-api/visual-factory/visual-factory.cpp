@@ -111,6 +111,16 @@ Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions
   return GetImplementation(*this).CreateVisual(url, size, creationOptions);
 }
 
+Visual::Base VisualFactory::CreateVisual(const VisualDescriptor& descriptor)
+{
+  return GetImplementation(*this).CreateVisual(descriptor);
+}
+
+Visual::Base VisualFactory::CreateVisual(const VisualDescriptor& descriptor, CreationOptions creationOptions)
+{
+  return GetImplementation(*this).CreateVisual(descriptor, creationOptions);
+}
+
 void VisualFactory::SetPreMultiplyOnLoad(bool preMultiply)
 {
   GetImplementation(*this).SetPreMultiplyOnLoad(preMultiply);
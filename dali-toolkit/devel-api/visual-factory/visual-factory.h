@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
 
 namespace Dali
 {
@@ -134,6 +135,28 @@ public:
    */
   Visual::Base CreateVisual(const std::string& url, ImageDimensions size, CreationOptions creationOptions);
 
+  /**
+   * @brief Request the visual described by a descriptor
+   *
+   * It's faster than creating the visual from the property map when the same visual is created many times,
+   * since the map is parsed only once by the descriptor.
+   *
+   * @SINCE_2_3.34
+   * @param[in] descriptor The descriptor of the visual
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualDescriptor& descriptor);
+
+  /**
+   * @brief Request the visual described by a descriptor with some options
+   *
+   * @SINCE_2_3.34
+   * @param[in] descriptor The descriptor of the visual
+   * @param[in] creationOptions The creation option.
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualDescriptor& descriptor, CreationOptions creationOptions);
+
   /**
    * @brief Enable or disable premultiplying alpha in images and image visuals.
    *
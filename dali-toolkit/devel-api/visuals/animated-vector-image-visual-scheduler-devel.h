@@ -0,0 +1,64 @@
+#ifndef DALI_TOOLKIT_DEVEL_API_VISUALS_ANIMATED_VECTOR_IMAGE_VISUAL_SCHEDULER_DEVEL_H
+#define DALI_TOOLKIT_DEVEL_API_VISUALS_ANIMATED_VECTOR_IMAGE_VISUAL_SCHEDULER_DEVEL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelAnimatedVectorImageVisual
+{
+/**
+ * @brief Retrieves the statistics of the load-adaptive scheduling of the animated vector image visuals.
+ *
+ * The animations share a rasterization time budget per vsync interval, which is read from the
+ * DALI_VECTOR_ANIMATION_RASTERIZATION_BUDGET environment variable in milliseconds (8 by default, 0 disables it).
+ * When the budget is exceeded, the small animations are rasterized at 1/2 or 1/4 of their frame rate,
+ * then the animations of normal size at 1/2, and the culled animations are frozen until the load goes down.
+ * The large animations keep their frame rate.
+ *
+ * The statistics are retrieved as a map:
+ * @code
+ * {
+ *   "budget" : 8.0,           // The budget per vsync interval in milliseconds
+ *   "utilization" : 1.35,     // The ratio of the rasterization time to the budget, evaluated every 100 milliseconds
+ *   "loadLevel" : 1,          // 0 within the budget, 1 and 2 when the animations are degraded
+ *   "skippedFrames" : 240,    // The number of frames skipped to reduce the load
+ *   "frozenAnimations" : 3    // The number of the culled animations frozen now
+ * }
+ * @endcode
+ *
+ * @SINCE_2_3.34
+ * @return The statistics, or an empty map if no animation has been rasterized yet.
+ */
+DALI_TOOLKIT_API Property::Map GetSchedulerStatistics();
+
+} // namespace DevelAnimatedVectorImageVisual
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_DEVEL_API_VISUALS_ANIMATED_VECTOR_IMAGE_VISUAL_SCHEDULER_DEVEL_H
@@ -24,6 +24,7 @@
 
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali/devel-api/common/stage.h>
+#include <dali/devel-api/object/handle-devel.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/actors/camera-actor.h>
@@ -142,6 +143,45 @@ void CollectAllStyles(const TreeNode& stylesCollection, const TreeNode& style, T
   }
 }
 
+/*
+ * Collects the styles a style inherits from.
+ *
+ * root The root of the parse tree
+ * node The style to collect the inherited styles of
+ * styleList The style list to add the inherited styles to
+ * returns false if the parse tree has no styles
+ */
+bool CollectInheritedStyles(const TreeNode& root, const TreeNode& node, TreeNodeList& styleList)
+{
+  OptionalChild styleNodes      = IsChild(root, KEYNAME_STYLES);
+  OptionalChild inheritFromNode = IsChild(node, KEYNAME_INHERIT);
+  if(!inheritFromNode)
+  {
+    inheritFromNode = IsChild(node, KEYNAME_STYLES);
+  }
+
+  if(!styleNodes)
+  {
+    return false;
+  }
+
+  if(inheritFromNode)
+  {
+    CollectAllStyles(*styleNodes, *inheritFromNode, styleList);
+
+#if defined(DEBUG_ENABLED)
+    for(TreeNode::ConstIterator iter = (*inheritFromNode).CBegin(); iter != (*inheritFromNode).CEnd(); ++iter)
+    {
+      if(OptionalString styleName = IsString((*iter).second))
+      {
+        DALI_SCRIPT_VERBOSE("Style Applied '%s'\n", (*styleName).c_str());
+      }
+    }
+#endif
+  }
+  return true;
+}
+
 } // namespace
 
 Builder::Builder()
@@ -366,6 +406,25 @@ const StylePtr Builder::GetStyle(const std::string& styleName)
   }
 }
 
+void Builder::GetStyleNames(std::vector<std::string>& styleNames) const
+{
+  const TreeNode* root = mParser.GetRoot();
+  if(root)
+  {
+    OptionalChild styles = IsChild(*root, KEYNAME_STYLES);
+    if(styles)
+    {
+      for(TreeNode::ConstIterator iter = (*styles).CBegin(); iter != (*styles).CEnd(); ++iter)
+      {
+        if((*iter).first)
+        {
+          styleNames.push_back((*iter).first);
+        }
+      }
+    }
+  }
+}
+
 void Builder::AddActors(Actor toActor)
 {
   // 'stage' is the default/by convention section to add from
@@ -1121,41 +1180,20 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
     matchedStyle = mStyles.Find(styleName);
     if(!matchedStyle)
     {
-      OptionalChild styleNodes      = IsChild(root, KEYNAME_STYLES);
-      OptionalChild inheritFromNode = IsChild(node, KEYNAME_INHERIT);
-      if(!inheritFromNode)
+      TreeNodeList additionalStyleNodes;
+      if(CollectInheritedStyles(root, node, additionalStyleNodes))
       {
-        inheritFromNode = IsChild(node, KEYNAME_STYLES);
-      }
+        const StyleTarget target(handle);
 
-      if(styleNodes)
-      {
-        if(inheritFromNode)
+        // a style may have other styles, which has other styles etc so we apply in reverse by convention.
+        for(TreeNodeList::reverse_iterator iter = additionalStyleNodes.rbegin(); iter != additionalStyleNodes.rend(); ++iter)
         {
-          TreeNodeList additionalStyleNodes;
-
-          CollectAllStyles(*styleNodes, *inheritFromNode, additionalStyleNodes);
-
-#if defined(DEBUG_ENABLED)
-          for(TreeNode::ConstIterator iter = (*inheritFromNode).CBegin(); iter != (*inheritFromNode).CEnd(); ++iter)
-          {
-            if(OptionalString styleName = IsString((*iter).second))
-            {
-              DALI_SCRIPT_VERBOSE("Style Applied '%s'\n", (*styleName).c_str());
-            }
-          }
-#endif
-
-          // a style may have other styles, which has other styles etc so we apply in reverse by convention.
-          for(TreeNodeList::reverse_iterator iter = additionalStyleNodes.rbegin(); iter != additionalStyleNodes.rend(); ++iter)
-          {
-            RecordStyle(style, *(*iter), handle, constant);
-            ApplySignals(root, *(*iter), handle);
-            ApplyStylesByActor(root, *(*iter), handle, constant);
-          }
+          RecordStyle(style, *(*iter), target, constant);
+          ApplySignals(root, *(*iter), handle);
+          ApplyStylesByActor(root, *(*iter), handle, constant);
         }
 
-        RecordStyle(style, node, handle, constant);
+        RecordStyle(style, node, target, constant);
         mStyles.Add(styleName, style); // shallow copy
         matchedStyle = &style;
       }
@@ -1176,9 +1214,84 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
   ApplyStylesByActor(root, node, handle, constant);
 }
 
+bool Builder::PrecompileStyle(const std::string& styleName, Dali::TypeInfo typeInfo)
+{
+  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
+
+  const TreeNode& root   = *mParser.GetRoot();
+  OptionalChild   styles = IsChild(root, KEYNAME_STYLES);
+  if(!styles || !typeInfo)
+  {
+    return false;
+  }
+
+  OptionalChild node = IsChildIgnoreCase(*styles, styleName);
+  if(!node || !(*node).GetName())
+  {
+    return false;
+  }
+
+  const char* name = (*node).GetName();
+  if(mStyles.Find(name))
+  {
+    // Already recorded by an object of the type
+    return true;
+  }
+
+  TreeNodeList additionalStyleNodes;
+  if(!CollectInheritedStyles(root, *node, additionalStyleNodes))
+  {
+    return false;
+  }
+
+  // Record the style the same way as ApplyAllStyleProperties(), without applying anything
+  Replacement       replacement(mReplacementMap);
+  const StyleTarget target(GetPropertyTable(typeInfo));
+  StylePtr          style = Style::New();
+  for(TreeNodeList::reverse_iterator iter = additionalStyleNodes.rbegin(); iter != additionalStyleNodes.rend(); ++iter)
+  {
+    RecordStyle(style, *(*iter), target, replacement);
+  }
+  RecordStyle(style, *node, target, replacement);
+
+  if(!target.complete)
+  {
+    // A value recorded without its property type may not convert to it, so leave it to the first object of the type
+    DALI_SCRIPT_VERBOSE("Style '%s' not precompiled, as a property of %s is not resolved\n", name, typeInfo.GetName().c_str());
+    return false;
+  }
+
+  mStyles.Add(name, style); // shallow copy
+  return true;
+}
+
+const Builder::PropertyTable& Builder::GetPropertyTable(Dali::TypeInfo typeInfo)
+{
+  auto iter = mPropertyTables.find(typeInfo.GetName());
+  if(iter != mPropertyTables.end())
+  {
+    return iter->second;
+  }
+
+  // An object which has only the properties registered for the type, so it can tell their types
+  // without creating an object of the type.
+  Dali::Handle prototype = Dali::Handle::New();
+  DevelHandle::SetTypeInfo(prototype, typeInfo);
+
+  PropertyTable&           propertyTable = mPropertyTables[typeInfo.GetName()];
+  Property::IndexContainer indices;
+  typeInfo.GetPropertyIndices(indices);
+  for(auto&& index : indices)
+  {
+    propertyTable.emplace(std::string(typeInfo.GetPropertyName(index)), std::make_pair(index, prototype.GetPropertyType(index)));
+  }
+
+  return propertyTable;
+}
+
 void Builder::RecordStyle(StylePtr           style,
                           const TreeNode&    node,
-                          Dali::Handle&      handle,
+                          const StyleTarget& target,
                           const Replacement& replacements)
 {
   // With repeated calls, accumulate inherited states, visuals and properties
@@ -1211,12 +1324,12 @@ void Builder::RecordStyle(StylePtr           style,
         if(stylePtr)
         {
           StylePtr subState(*stylePtr);
-          RecordStyle(subState, stateNode, handle, replacements);
+          RecordStyle(subState, stateNode, target, replacements);
         }
         else
         {
           StylePtr subState = Style::New();
-          RecordStyle(subState, stateNode, handle, replacements);
+          RecordStyle(subState, stateNode, target, replacements);
           style->subStates.Add(stateName, subState);
         }
       }
@@ -1273,7 +1386,7 @@ void Builder::RecordStyle(StylePtr           style,
     {
       Property::Index index;
       Property::Value value;
-      if(MapToTargetProperty(handle, key, keyValue.second, replacements, index, value))
+      if(MapToTargetProperty(target, key, keyValue.second, replacements, index, value))
       {
         Property::Value* existingValuePtr = style->properties.Find(index);
         if(existingValuePtr != NULL)
@@ -1447,6 +1560,33 @@ void Builder::SetProperties(const TreeNode& node, Handle& handle, const Replacem
   }
 }
 
+bool Builder::StyleTarget::FindProperty(const std::string& key, Property::Index& index, Property::Type& type) const
+{
+  if(handle)
+  {
+    index = handle.GetPropertyIndex(key);
+    if(Property::INVALID_INDEX != index)
+    {
+      type = handle.GetPropertyType(index);
+      return true;
+    }
+  }
+  else if(propertyTable)
+  {
+    auto iter = propertyTable->find(key);
+    if(iter != propertyTable->end() && iter->second.second != Property::NONE)
+    {
+      index = iter->second.first;
+      type  = iter->second.second;
+      return true;
+    }
+    complete = false;
+  }
+
+  index = Property::INVALID_INDEX;
+  return false;
+}
+
 bool Builder::MapToTargetProperty(
   Handle&            propertyObject,
   const std::string& key,
@@ -1454,14 +1594,23 @@ bool Builder::MapToTargetProperty(
   const Replacement& constant,
   Property::Index&   index,
   Property::Value&   value)
+{
+  return MapToTargetProperty(StyleTarget(propertyObject), key, node, constant, index, value);
+}
+
+bool Builder::MapToTargetProperty(
+  const StyleTarget& target,
+  const std::string& key,
+  const TreeNode&    node,
+  const Replacement& constant,
+  Property::Index&   index,
+  Property::Value&   value)
 {
   bool mapped = false;
 
-  index = propertyObject.GetPropertyIndex(key);
-  if(Property::INVALID_INDEX != index)
+  Property::Type type = Property::NONE;
+  if(target.FindProperty(key, index, type))
   {
-    Property::Type type = propertyObject.GetPropertyType(index);
-
     // if node.value is a mapping, get the property value from the "mappings" table
     if(node.GetType() == TreeNode::STRING)
     {
@@ -1483,7 +1632,7 @@ bool Builder::MapToTargetProperty(
       }
     }
   }
-  else
+  else if(target.handle)
   {
     DALI_LOG_ERROR("Key '%s' not found.\n", key.c_str());
   }
@@ -23,11 +23,13 @@
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/type-info.h>
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/render-tasks/render-task.h>
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/builder.h>
@@ -167,6 +169,23 @@ public:
    */
   const StylePtr GetStyle(const std::string& styleName);
 
+  /**
+   * Retrieves the names of the styles in the parse tree.
+   * @param[out] styleNames The names of the styles
+   */
+  void GetStyleNames(std::vector<std::string>& styleNames) const;
+
+  /**
+   * Records the style before any object of the type is created.
+   * The property names and types are resolved through the properties registered for the type,
+   * so no object of the type has to be created. If any property can't be resolved with its type,
+   * the style isn't recorded, and the first object of the type records it instead.
+   * @param[in] styleName The name of the style in the parse tree
+   * @param[in] typeInfo The type the style is applied to
+   * @return true if the style is recorded
+   */
+  bool PrecompileStyle(const std::string& styleName, Dali::TypeInfo typeInfo);
+
   /**
    * @copydoc Toolkit::Builder::AddActors
    */
@@ -284,9 +303,50 @@ private:
                     Dali::Handle&      handle,
                     const Replacement& replacements);
 
+  /**
+   * The index and the type of each registered property of a type, by name.
+   */
+  using PropertyTable = std::unordered_map<std::string, std::pair<Property::Index, Property::Type>>;
+
+  /**
+   * Retrieves the property table of the type, building it on first use.
+   * @param[in] typeInfo The type
+   * @return The property table
+   */
+  const PropertyTable& GetPropertyTable(Dali::TypeInfo typeInfo);
+
+  /**
+   * The object a style is recorded for. Its property names are resolved through the handle,
+   * or through the property table of the type when no object of the type exists yet.
+   */
+  struct StyleTarget
+  {
+    explicit StyleTarget(Dali::Handle handle)
+    : handle(handle),
+      propertyTable(nullptr)
+    {
+    }
+
+    explicit StyleTarget(const PropertyTable& propertyTable)
+    : handle(),
+      propertyTable(&propertyTable)
+    {
+    }
+
+    /**
+     * Finds the index and the type of the property with the given name.
+     * @return true if the property is found
+     */
+    bool FindProperty(const std::string& key, Property::Index& index, Property::Type& type) const;
+
+    Dali::Handle         handle;
+    const PropertyTable* propertyTable;
+    mutable bool         complete{true}; ///< Whether every property was resolved with its type
+  };
+
   void RecordStyle(StylePtr           style,
                    const TreeNode&    node,
-                   Dali::Handle&      handle,
+                   const StyleTarget& target,
                    const Replacement& replacements);
 
   void RecordTransitions(const TreeNode::KeyNodePair& keyValue,
@@ -322,6 +382,13 @@ private:
                            Property::Index&   index,
                            Property::Value&   value);
 
+  bool MapToTargetProperty(const StyleTarget& target,
+                           const std::string& key,
+                           const TreeNode&    node,
+                           const Replacement& constant,
+                           Property::Index&   index,
+                           Property::Value&   value);
+
   /**
    * Find the key in the mapping table, if it's present, then generate
    * a property value for it (of the given type if available),
@@ -373,16 +440,17 @@ private:
                          Property::Value& value);
 
 private:
-  Toolkit::JsonParser                 mParser;
-  PathLut                             mPathLut;
-  PathConstrainerLut                  mPathConstrainerLut;
-  LinearConstrainerLut                mLinearConstrainerLut;
-  SlotDelegate<Builder>               mSlotDelegate;
-  Property::Map                       mReplacementMap;
-  Property::Map                       mConfigurationMap;
-  MappingsLut                         mCompleteMappings;
-  Dictionary<StylePtr>                mStyles; // State based styles
-  Toolkit::Builder::BuilderSignalType mQuitSignal;
+  Toolkit::JsonParser                            mParser;
+  PathLut                                        mPathLut;
+  PathConstrainerLut                             mPathConstrainerLut;
+  LinearConstrainerLut                           mLinearConstrainerLut;
+  SlotDelegate<Builder>                          mSlotDelegate;
+  Property::Map                                  mReplacementMap;
+  Property::Map                                  mConfigurationMap;
+  MappingsLut                                    mCompleteMappings;
+  Dictionary<StylePtr>                           mStyles; // State based styles
+  std::unordered_map<std::string, PropertyTable> mPropertyTables; ///< The property tables of the types, by type name
+  Toolkit::Builder::BuilderSignalType            mQuitSignal;
 };
 
 } // namespace Internal
@@ -61,7 +61,9 @@ CanvasView::CanvasView(const Vector2& viewBox)
   mSize(viewBox),
   mIsSynchronous(true),
   mManualRasterization(false),
-  mProcessorRegistered(false)
+  mProcessorRegistered(false),
+  mVisible(true),
+  mRasterizationPending(false)
 {
 }
 
@@ -99,11 +101,41 @@ void CanvasView::OnInitialize()
   Dali::Toolkit::Control handle(GetOwner());
 
   Self().SetProperty(DevelControl::Property::ACCESSIBILITY_ROLE, Dali::Accessibility::Role::IMAGE);
+  Self().InheritedVisibilityChangedSignal().Connect(this, &CanvasView::OnInheritedVisibilityChanged);
 
   // Request rasterization once at very first time.
   RequestRasterization();
 }
 
+void CanvasView::OnSceneConnection(int depth)
+{
+  Control::OnSceneConnection(depth);
+
+  if(mRasterizationPending)
+  {
+    // Rasterize the changes made while the canvas was off the scene.
+    mRasterizationPending = false;
+    RequestRasterization();
+  }
+}
+
+void CanvasView::OnInheritedVisibilityChanged(Actor actor, bool visible)
+{
+  mVisible = visible;
+
+  if(mVisible && mRasterizationPending)
+  {
+    // Rasterize the changes made while the canvas was hidden.
+    mRasterizationPending = false;
+    RequestRasterization();
+  }
+}
+
+bool CanvasView::IsShown()
+{
+  return mVisible && Self().GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE);
+}
+
 void CanvasView::OnRelayout(const Vector2& size, RelayoutContainer& container)
 {
   if(!mCanvasRenderer ||
@@ -205,7 +237,15 @@ void CanvasView::Process(bool postProcessor)
 
   if(mCanvasRenderer && mCanvasRenderer.IsCanvasChanged() && mSize.width > 0 && mSize.height > 0)
   {
-    AddRasterizationTask();
+    if(IsShown())
+    {
+      AddRasterizationTask();
+    }
+    else
+    {
+      // Don't rasterize the whole canvas for nobody. The changes are kept until it's shown.
+      mRasterizationPending = true;
+    }
   }
 
   // If we are not doing manual rasterization, register processor once again.
@@ -269,7 +309,7 @@ void CanvasView::ApplyRasterizedImage(CanvasRendererRasterizingTaskPtr task)
   }
 
   //If there are accumulated changes to CanvasRenderer during Rasterize, Rasterize once again.
-  if(!mIsSynchronous && !mManualRasterization && mCanvasRenderer && mCanvasRenderer.IsCanvasChanged())
+  if(!mIsSynchronous && !mManualRasterization && mCanvasRenderer && mCanvasRenderer.IsCanvasChanged() && IsShown())
   {
     AddRasterizationTask();
   }
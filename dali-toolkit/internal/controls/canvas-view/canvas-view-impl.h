@@ -111,6 +111,26 @@ private: // From Control
    */
   void OnInitialize() override;
 
+  /**
+   * @copydoc Toolkit::Control::OnSceneConnection()
+   */
+  void OnSceneConnection(int depth) override;
+
+  /**
+   * @brief Called when the visibility of the canvas view or its parents is changed.
+   *
+   * @param[in] actor The canvas view.
+   * @param[in] visible Whether the canvas view is visible.
+   */
+  void OnInheritedVisibilityChanged(Actor actor, bool visible);
+
+  /**
+   * @brief Whether the canvas is shown, so that it's worth rasterizing.
+   *
+   * @return Returns true if the canvas view is on the scene and visible.
+   */
+  bool IsShown();
+
   /**
    * @brief This is the viewbox of the Canvas.
    * @param[in] viewBox The size of viewbox.
@@ -155,6 +175,9 @@ private: // From Control
   /**
    * @bried Rasterize the canvas, and add it to the view.
    *
+   * The whole canvas is rasterized, however small the change is. CanvasRenderer has no way to rasterize
+   * or upload only the damaged area.
+   *
    * @param[in] size The target size of the canvas view rasterization.
    */
   void AddRasterizationTask();
@@ -194,6 +217,8 @@ private:
   bool                             mIsSynchronous : 1;
   bool                             mManualRasterization : 1;
   bool                             mProcessorRegistered : 1;
+  bool                             mVisible : 1;
+  bool                             mRasterizationPending : 1; ///< The canvas changed while it was hidden.
 };
 
 } // namespace Internal
@@ -170,7 +170,11 @@ FlexContainer::~FlexContainer()
 
   for(unsigned int i = 0; i < mChildrenNodes.size(); i++)
   {
-    YGNodeFree(mChildrenNodes[i].node);
+    // The root nodes of the nested containers are freed by them.
+    if(!mChildrenNodes[i].nested)
+    {
+      YGNodeFree(mChildrenNodes[i].node);
+    }
   }
 
   mChildrenNodes.clear();
@@ -466,14 +470,29 @@ Property::Value FlexContainer::GetProperty(BaseObject* object, Property::Index i
 
 void FlexContainer::OnChildAdd(Actor& child)
 {
-  // Create a new node for the child.
   FlexItemNode childNode;
-  childNode.actor = child;
-  childNode.node  = YGNodeNew();
+  childNode.actor      = child;
+  childNode.styleDirty = true;
+
+  Toolkit::FlexContainer childContainer = Toolkit::FlexContainer::DownCast(child);
+  if(childContainer)
+  {
+    // Attach the tree of the nested container, so that the whole subtree is laid out by a single calculation.
+    childNode.node   = GetImpl(childContainer).mRootNode.node;
+    childNode.nested = true;
+  }
+  else
+  {
+    // Create a new node for the child.
+    childNode.node   = YGNodeNew();
+    childNode.nested = false;
+  }
 
   mChildrenNodes.push_back(childNode);
   YGNodeInsertChild(mRootNode.node, childNode.node, mChildrenNodes.size() - 1);
 
+  child.PropertySetSignal().Connect(this, &FlexContainer::OnChildPropertySet);
+
   Control::OnChildAdd(child);
 }
 
@@ -483,8 +502,13 @@ void FlexContainer::OnChildRemove(Actor& child)
   {
     if(mChildrenNodes[i].actor.GetHandle() == child)
     {
+      child.PropertySetSignal().Disconnect(this, &FlexContainer::OnChildPropertySet);
+
       YGNodeRemoveChild(mRootNode.node, mChildrenNodes[i].node);
-      YGNodeFree(mChildrenNodes[i].node);
+      if(!mChildrenNodes[i].nested)
+      {
+        YGNodeFree(mChildrenNodes[i].node);
+      }
 
       mChildrenNodes.erase(mChildrenNodes.begin() + i);
 
@@ -598,14 +622,40 @@ void FlexContainer::OnLayoutDirectionChanged(Dali::Actor actor, Dali::LayoutDire
   }
 }
 
-void FlexContainer::ComputeLayout()
+void FlexContainer::OnChildPropertySet(Handle& handle, Property::Index index, const Property::Value& value)
 {
-  if(mRootNode.node)
+  if(index == Toolkit::FlexContainer::ChildProperty::FLEX ||
+     index == Toolkit::FlexContainer::ChildProperty::ALIGN_SELF ||
+     index == Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN ||
+     index == Actor::Property::MINIMUM_SIZE ||
+     index == Actor::Property::MAXIMUM_SIZE)
   {
     for(unsigned int i = 0; i < mChildrenNodes.size(); i++)
     {
-      YGNodeRef childNode  = mChildrenNodes[i].node;
-      Actor     childActor = mChildrenNodes[i].actor.GetHandle();
+      if(mChildrenNodes[i].actor.GetHandle() == handle)
+      {
+        mChildrenNodes[i].styleDirty = true;
+        RelayoutRequest();
+        break;
+      }
+    }
+  }
+}
+
+void FlexContainer::UpdateChildrenStyle()
+{
+  for(unsigned int i = 0; i < mChildrenNodes.size(); i++)
+  {
+    YGNodeRef childNode  = mChildrenNodes[i].node;
+    Actor     childActor = mChildrenNodes[i].actor.GetHandle();
+    if(!childActor)
+    {
+      continue;
+    }
+
+    if(mChildrenNodes[i].styleDirty)
+    {
+      mChildrenNodes[i].styleDirty = false;
 
       // Intialize the style of the child.
       YGNodeStyleSetMinWidth(childNode, childActor.GetProperty<Vector2>(Actor::Property::MINIMUM_SIZE).x);
@@ -651,6 +701,20 @@ void FlexContainer::ComputeLayout()
       }
     }
 
+    if(mChildrenNodes[i].nested)
+    {
+      Toolkit::FlexContainer childContainer = Toolkit::FlexContainer::DownCast(childActor);
+      GetImpl(childContainer).UpdateChildrenStyle();
+    }
+  }
+}
+
+void FlexContainer::ComputeLayout()
+{
+  if(mRootNode.node)
+  {
+    UpdateChildrenStyle();
+
     // Calculate the layout
     YGDirection nodeLayoutDirection = YGDirectionInherit;
     switch(mContentDirection)
@@ -674,6 +738,15 @@ void FlexContainer::ComputeLayout()
       }
     }
 
+    // A nested container takes its direction from its own style, as it's laid out by the outermost container.
+    YGNodeStyleSetDirection(mRootNode.node, nodeLayoutDirection);
+
+    if(YGNodeGetOwner(mRootNode.node) && !YGNodeIsDirty(mRootNode.node))
+    {
+      // The layout of a nested container is up to date since the outermost container calculated it.
+      return;
+    }
+
 #if defined(FLEX_CONTAINER_DEBUG)
     YGNodePrint(mRootNode.node, (YGPrintOptions)(YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren));
 #endif
@@ -820,8 +893,10 @@ void FlexContainer::OnInitialize()
   Dali::Actor self = Self();
   self.LayoutDirectionChangedSignal().Connect(this, &FlexContainer::OnLayoutDirectionChanged);
 
-  mRootNode.actor = self;
-  mRootNode.node  = YGNodeNew();
+  mRootNode.actor      = self;
+  mRootNode.node       = YGNodeNew();
+  mRootNode.nested     = false;
+  mRootNode.styleDirty = false;
   YGNodeSetContext(mRootNode.node, &mChildrenNodes);
 
   // Set default style
@@ -44,8 +44,10 @@ public:
    */
   struct FlexItemNode
   {
-    WeakHandle<Dali::Actor> actor; ///< Actor handle of the flex item
-    YGNodeRef               node;  ///< The style properties and layout information
+    WeakHandle<Dali::Actor> actor;      ///< Actor handle of the flex item
+    YGNodeRef               node;       ///< The style properties and layout information
+    bool                    nested;     ///< Whether the node is the root node of a nested flex container, which owns it
+    bool                    styleDirty; ///< Whether the child properties of the flex item should be pushed to the node
   };
 
   typedef std::vector<FlexItemNode> FlexItemNodeContainer;
@@ -204,6 +206,19 @@ private: // From Control
   void OnLayoutDirectionChanged(Dali::Actor actor, Dali::LayoutDirection::Type type);
 
 private: // Implementation
+  /**
+   * Called when a property of a child is set.
+   * @param[in] handle The child
+   * @param[in] index The property index
+   * @param[in] value The new property value
+   */
+  void OnChildPropertySet(Handle& handle, Property::Index index, const Property::Value& value);
+
+  /**
+   * Push the changed child properties to the nodes of the children and of the nested containers
+   */
+  void UpdateChildrenStyle();
+
   /**
    * Calculate the layout properties of all the children
    */
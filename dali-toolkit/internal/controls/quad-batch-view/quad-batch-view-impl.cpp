@@ -0,0 +1,752 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/quad-batch-view/quad-batch-view-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/actors/actor-devel.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/public-api/common/constants.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/object/type-registry-helper.h>
+#include <dali/public-api/object/type-registry.h>
+#include <algorithm>
+#include <limits>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/visuals/color-visual-properties-devel.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/graphics/builtin-shader-extern-gen.h>
+#include <dali-toolkit/public-api/visuals/color-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+BaseHandle Create()
+{
+  return Toolkit::QuadBatchView::New();
+}
+
+// Setup properties, signals and actions using the type-registry.
+DALI_TYPE_REGISTRATION_BEGIN(Toolkit::QuadBatchView, Toolkit::Control, Create);
+DALI_TYPE_REGISTRATION_END()
+
+constexpr uint32_t VERTICES_PER_QUAD  = 4u;
+constexpr uint32_t INDICES_PER_QUAD   = 6u;
+constexpr uint32_t MAXIMUM_QUAD_COUNT = 65536u / VERTICES_PER_QUAD; ///< The vertices are indexed by 16 bits.
+
+bool IsZero(const Property::Map& map, Property::Index index)
+{
+  Property::Value* value = map.Find(index);
+  return !value || Dali::EqualsZero(value->Get<float>());
+}
+
+/**
+ * @brief Retrieves the color of the background of an actor if the view can draw it.
+ *
+ * @param[in] actor The actor
+ * @param[out] color The color of the background
+ * @return True if the background is a plain color visual filling the control
+ */
+bool GetBatchableBackgroundColor(Actor& actor, Vector4& color)
+{
+  Toolkit::Control control = Toolkit::Control::DownCast(actor);
+  if(!control)
+  {
+    return false;
+  }
+
+  Toolkit::Visual::Base visual = DevelControl::GetVisual(Toolkit::Internal::GetImplementation(control), Toolkit::Control::Property::BACKGROUND);
+  if(!visual)
+  {
+    return false;
+  }
+
+  Property::Map map;
+  visual.CreatePropertyMap(map);
+
+  Property::Value* typeValue = map.Find(Toolkit::Visual::Property::TYPE);
+  if(!typeValue || typeValue->Get<int>() != Toolkit::Visual::COLOR || map.Find(Toolkit::Visual::Property::SHADER))
+  {
+    return false;
+  }
+
+  if(!IsZero(map, Toolkit::DevelColorVisual::Property::BLUR_RADIUS) || !IsZero(map, Toolkit::DevelVisual::Property::BORDERLINE_WIDTH))
+  {
+    return false;
+  }
+
+  Property::Value* cornerRadiusValue = map.Find(Toolkit::DevelVisual::Property::CORNER_RADIUS);
+  if(cornerRadiusValue && cornerRadiusValue->Get<Vector4>() != Vector4::ZERO)
+  {
+    return false;
+  }
+
+  // The visual should fill the control.
+  Property::Value* transformValue = map.Find(Toolkit::Visual::Property::TRANSFORM);
+  Property::Map*   transform      = transformValue ? transformValue->GetMap() : nullptr;
+  if(transform)
+  {
+    Property::Value* offset     = transform->Find(Toolkit::Visual::Transform::Property::OFFSET);
+    Property::Value* size       = transform->Find(Toolkit::Visual::Transform::Property::SIZE);
+    Property::Value* sizePolicy = transform->Find(Toolkit::Visual::Transform::Property::SIZE_POLICY);
+    Property::Value* extraSize  = transform->Find(Toolkit::DevelVisual::Transform::Property::EXTRA_SIZE);
+    Property::Value* origin     = transform->Find(Toolkit::Visual::Transform::Property::ORIGIN);
+    Property::Value* anchor     = transform->Find(Toolkit::Visual::Transform::Property::ANCHOR_POINT);
+    if((offset && offset->Get<Vector2>() != Vector2::ZERO) ||
+       (size && size->Get<Vector2>() != Vector2::ONE) ||
+       (sizePolicy && sizePolicy->Get<Vector2>() != Vector2::ZERO) ||
+       (extraSize && extraSize->Get<Vector2>() != Vector2::ZERO) ||
+       (origin && anchor && origin->Get<int>() != anchor->Get<int>()))
+    {
+      return false;
+    }
+  }
+
+  Property::Value* mixColorValue = map.Find(Toolkit::Visual::Property::MIX_COLOR);
+  color                          = mixColorValue ? mixColorValue->Get<Vector4>() : Color::WHITE;
+  return true;
+}
+
+/**
+ * @brief Checks whether a property set on a descendant can change its quad or the quads it overlaps.
+ *
+ * @param[in] index The index of the property
+ * @return True if the quads should be rebuilt
+ */
+bool IsQuadProperty(Property::Index index)
+{
+  switch(index)
+  {
+    case Actor::Property::PARENT_ORIGIN:
+    case Actor::Property::PARENT_ORIGIN_X:
+    case Actor::Property::PARENT_ORIGIN_Y:
+    case Actor::Property::ANCHOR_POINT:
+    case Actor::Property::ANCHOR_POINT_X:
+    case Actor::Property::ANCHOR_POINT_Y:
+    case Actor::Property::SIZE:
+    case Actor::Property::SIZE_WIDTH:
+    case Actor::Property::SIZE_HEIGHT:
+    case Actor::Property::POSITION:
+    case Actor::Property::POSITION_X:
+    case Actor::Property::POSITION_Y:
+    case Actor::Property::ORIENTATION:
+    case Actor::Property::SCALE:
+    case Actor::Property::SCALE_X:
+    case Actor::Property::SCALE_Y:
+    case Actor::Property::VISIBLE:
+    case Actor::Property::COLOR:
+    case Actor::Property::COLOR_RED:
+    case Actor::Property::COLOR_GREEN:
+    case Actor::Property::COLOR_BLUE:
+    case Actor::Property::COLOR_ALPHA:
+    case Actor::Property::OPACITY:
+    case Actor::Property::COLOR_MODE:
+    case Actor::Property::POSITION_USES_ANCHOR_POINT:
+    case Toolkit::Control::Property::BACKGROUND:
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+QuadBatchView::QuadBatchView()
+: Control(ControlBehaviour(CONTROL_BEHAVIOUR_DEFAULT)),
+  mSlots(),
+  mSlotIndices(),
+  mDepthOrder(),
+  mVertices(),
+  mIndices(),
+  mVertexBuffer(),
+  mGeometry(),
+  mShader(),
+  mRenderer(),
+  mBatchedCount(0u),
+  mUntrackedCount(0u),
+  mUpdatedQuadCount(0u),
+  mAllDirty(false),
+  mSlotsChanged(false),
+  mVerticesChanged(false),
+  mProcessorRegistered(false)
+{
+}
+
+QuadBatchView::~QuadBatchView()
+{
+  if(Adaptor::IsAvailable() && mProcessorRegistered)
+  {
+    Adaptor::Get().UnregisterProcessorOnce(*this, true);
+  }
+
+  // Give the backgrounds back to the descendants which outlive the view.
+  for(auto& slot : mSlots)
+  {
+    Actor actor = slot.mActor.GetHandle();
+    if(actor)
+    {
+      SetBatched(slot, actor, false);
+    }
+  }
+}
+
+Toolkit::QuadBatchView QuadBatchView::New()
+{
+  QuadBatchView* impl = new QuadBatchView();
+
+  Toolkit::QuadBatchView handle = Toolkit::QuadBatchView(*impl);
+
+  // Second-phase init of the implementation
+  // This can only be done after the CustomActor connection has been made...
+  impl->Initialize();
+
+  return handle;
+}
+
+Property::Map QuadBatchView::GetStatistics() const
+{
+  Property::Map map;
+  map.Insert("batchedVisuals", static_cast<int32_t>(mBatchedCount));
+  map.Insert("drawCallsSaved", static_cast<int32_t>(mBatchedCount > 0u ? mBatchedCount - 1u : 0u));
+  map.Insert("updatedQuads", static_cast<int32_t>(mUpdatedQuadCount));
+  return map;
+}
+
+void QuadBatchView::OnChildAdd(Actor& child)
+{
+  AddActor(child, 1u);
+  RequestUpdate();
+
+  Control::OnChildAdd(child);
+}
+
+void QuadBatchView::OnChildRemove(Actor& child)
+{
+  RemoveActor(child);
+  RequestUpdate();
+
+  Control::OnChildRemove(child);
+}
+
+void QuadBatchView::OnSizeSet(const Vector3& targetSize)
+{
+  // The quads are relative to the center of the view, and the children may be relative to its size.
+  mAllDirty = true;
+  RequestUpdate();
+
+  Control::OnSizeSet(targetSize);
+}
+
+void QuadBatchView::Process(bool postProcessor)
+{
+  mProcessorRegistered = false;
+
+  bool changed = mSlotsChanged;
+  if(mSlotsChanged)
+  {
+    mSlotsChanged = false;
+    UpdateIndices();
+  }
+
+  // The geometry of a descendant depends on its parent, so the parents are rebuilt first.
+  const Vector2 viewSize(Self().GetProperty<Vector3>(Actor::Property::SIZE));
+  for(auto slotIndex : mDepthOrder)
+  {
+    Slot& slot = mSlots[slotIndex];
+    if(mAllDirty || slot.mDirty)
+    {
+      UpdateGeometry(slot, viewSize);
+      changed = true;
+    }
+  }
+  mAllDirty = false;
+
+  if(changed)
+  {
+    UpdateBatchedStates();
+  }
+
+  if(mVerticesChanged)
+  {
+    mVerticesChanged = false;
+    UploadVertices();
+  }
+}
+
+void QuadBatchView::OnDescendantAdded(Actor child)
+{
+  Actor parent = child.GetParent();
+  Slot* slot   = parent ? FindSlot(parent.GetProperty<int>(Actor::Property::ID)) : nullptr;
+  if(slot)
+  {
+    AddActor(child, slot->mDepth + 1u);
+    RequestUpdate();
+  }
+}
+
+void QuadBatchView::OnDescendantRemoved(Actor child)
+{
+  RemoveActor(child);
+  RequestUpdate();
+}
+
+void QuadBatchView::OnDescendantPropertySet(Handle& handle, Property::Index index, const Property::Value& value)
+{
+  // Don't rebuild the quads for the properties which can't change them, e.g. the text of a label.
+  if(IsQuadProperty(index))
+  {
+    MarkDirty(Actor::DownCast(handle));
+  }
+}
+
+void QuadBatchView::OnDescendantRelayout(Actor actor)
+{
+  MarkDirty(actor);
+}
+
+void QuadBatchView::AddActor(Actor actor, uint32_t depth)
+{
+  if(mSlots.size() >= MAXIMUM_QUAD_COUNT)
+  {
+    // The bounds of the actor are unknown, so no background is batched until it's removed.
+    ++mUntrackedCount;
+    mSlotsChanged = true;
+    return;
+  }
+
+  const uint32_t slotIndex = static_cast<uint32_t>(mSlots.size());
+  Actor          parent    = actor.GetParent();
+
+  Slot slot{};
+  slot.mActor    = WeakHandle<Actor>(actor);
+  slot.mParentId = parent ? static_cast<uint32_t>(parent.GetProperty<int>(Actor::Property::ID)) : 0u;
+  slot.mDepth    = depth;
+  slot.mDirty    = true;
+  mSlots.push_back(slot);
+  mSlotIndices[actor.GetProperty<int>(Actor::Property::ID)] = slotIndex;
+
+  mVertices.Resize(mVertices.Count() + VERTICES_PER_QUAD, QuadVertex());
+  mSlotsChanged = true;
+
+  actor.PropertySetSignal().Connect(this, &QuadBatchView::OnDescendantPropertySet);
+  actor.OnRelayoutSignal().Connect(this, &QuadBatchView::OnDescendantRelayout);
+  DevelActor::ChildAddedSignal(actor).Connect(this, &QuadBatchView::OnDescendantAdded);
+  DevelActor::ChildRemovedSignal(actor).Connect(this, &QuadBatchView::OnDescendantRemoved);
+
+  for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+  {
+    AddActor(actor.GetChildAt(i), depth + 1u);
+  }
+}
+
+void QuadBatchView::RemoveActor(Actor actor)
+{
+  for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+  {
+    RemoveActor(actor.GetChildAt(i));
+  }
+
+  auto iter = mSlotIndices.find(actor.GetProperty<int>(Actor::Property::ID));
+  if(iter == mSlotIndices.end())
+  {
+    if(mUntrackedCount > 0u)
+    {
+      --mUntrackedCount;
+      mSlotsChanged = true;
+    }
+    return;
+  }
+
+  const uint32_t slotIndex = iter->second;
+  mSlotIndices.erase(iter);
+
+  actor.PropertySetSignal().Disconnect(this, &QuadBatchView::OnDescendantPropertySet);
+  actor.OnRelayoutSignal().Disconnect(this, &QuadBatchView::OnDescendantRelayout);
+  DevelActor::ChildAddedSignal(actor).Disconnect(this, &QuadBatchView::OnDescendantAdded);
+  DevelActor::ChildRemovedSignal(actor).Disconnect(this, &QuadBatchView::OnDescendantRemoved);
+
+  SetBatched(mSlots[slotIndex], actor, false);
+
+  // Move the last slot into the removed one, so that the other slots are kept.
+  const uint32_t lastIndex = static_cast<uint32_t>(mSlots.size()) - 1u;
+  if(slotIndex != lastIndex)
+  {
+    mSlots[slotIndex] = mSlots[lastIndex];
+    for(uint32_t i = 0u; i < VERTICES_PER_QUAD; ++i)
+    {
+      mVertices[slotIndex * VERTICES_PER_QUAD + i] = mVertices[lastIndex * VERTICES_PER_QUAD + i];
+    }
+
+    Actor movedActor = mSlots[slotIndex].mActor.GetHandle();
+    if(movedActor)
+    {
+      mSlotIndices[movedActor.GetProperty<int>(Actor::Property::ID)] = slotIndex;
+    }
+  }
+
+  mSlots.pop_back();
+  mVertices.Resize(lastIndex * VERTICES_PER_QUAD);
+
+  mSlotsChanged    = true;
+  mVerticesChanged = true;
+}
+
+QuadBatchView::Slot* QuadBatchView::FindSlot(uint32_t actorId)
+{
+  auto iter = mSlotIndices.find(actorId);
+  return iter != mSlotIndices.end() ? &mSlots[iter->second] : nullptr;
+}
+
+void QuadBatchView::MarkDirty(Actor actor)
+{
+  if(actor)
+  {
+    Slot* slot = FindSlot(actor.GetProperty<int>(Actor::Property::ID));
+    if(slot)
+    {
+      // The geometry of the descendants depends on the actor.
+      slot->mDirty = true;
+      for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+      {
+        MarkDirty(actor.GetChildAt(i));
+      }
+      RequestUpdate();
+    }
+  }
+}
+
+void QuadBatchView::RequestUpdate()
+{
+  if(!mProcessorRegistered && Adaptor::IsAvailable())
+  {
+    mProcessorRegistered = true;
+    Adaptor::Get().RegisterProcessorOnce(*this, true); // Use post processor to trigger after layoutting
+  }
+}
+
+void QuadBatchView::UpdateGeometry(Slot& slot, const Vector2& viewSize)
+{
+  slot.mDirty = false;
+
+  Actor actor = slot.mActor.GetHandle();
+  if(!actor)
+  {
+    return;
+  }
+
+  // The view is the parent of the children.
+  const Slot*   parent         = FindSlot(slot.mParentId);
+  const Vector2 parentTopLeft  = parent ? parent->mTopLeft : viewSize * -0.5f;
+  const Vector2 parentSize     = parent ? parent->mSize : viewSize;
+  const Vector4 parentColor    = parent ? parent->mColor : Color::WHITE;
+  const bool    parentKnown    = parent ? parent->mKnownBounds : true;
+  const bool    parentOwnColor = parent ? parent->mOwnColor : true;
+  const bool    parentVisible  = parent ? parent->mVisible : true;
+
+  const Vector3 size         = actor.GetProperty<Vector3>(Actor::Property::SIZE);
+  const Vector3 position     = actor.GetProperty<Vector3>(Actor::Property::POSITION);
+  const Vector3 parentOrigin = actor.GetProperty<Vector3>(Actor::Property::PARENT_ORIGIN);
+  const Vector3 anchorPoint  = actor.GetProperty<bool>(Actor::Property::POSITION_USES_ANCHOR_POINT) ? actor.GetProperty<Vector3>(Actor::Property::ANCHOR_POINT) : Vector3(AnchorPoint::TOP_LEFT);
+
+  const Vector2 topLeft(parentTopLeft.x + parentOrigin.x * parentSize.width + position.x - anchorPoint.x * size.width,
+                        parentTopLeft.y + parentOrigin.y * parentSize.height + position.y - anchorPoint.y * size.height);
+  const bool    knownBounds = parentKnown && actor.GetProperty<Quaternion>(Actor::Property::ORIENTATION) == Quaternion::IDENTITY && actor.GetProperty<Vector3>(Actor::Property::SCALE) == Vector3::ONE;
+
+  // Only the default color mode is followed, which inherits the alpha of the parent.
+  const Vector4 actorColor = actor.GetProperty<Vector4>(Actor::Property::COLOR);
+  const bool    ownColor   = parentOwnColor && actor.GetProperty<ColorMode>(Actor::Property::COLOR_MODE) == USE_OWN_MULTIPLY_PARENT_ALPHA;
+
+  Toolkit::Control control       = Toolkit::Control::DownCast(actor);
+  const bool       hasBackground = control && DevelControl::GetVisual(Toolkit::Internal::GetImplementation(control), Toolkit::Control::Property::BACKGROUND);
+
+  Vector4    backgroundColor;
+  const bool batchable = GetBatchableBackgroundColor(actor, backgroundColor);
+
+  const Vector4 color(actorColor.r, actorColor.g, actorColor.b, actorColor.a * parentColor.a);
+  const Vector4 quadColor = backgroundColor * color;
+  const bool    visible   = parentVisible && actor.GetProperty<bool>(Actor::Property::VISIBLE);
+
+  if(topLeft != slot.mTopLeft || Vector2(size) != slot.mSize || quadColor != slot.mQuadColor)
+  {
+    slot.mQuadChanged = true;
+  }
+
+  slot.mTopLeft     = topLeft;
+  slot.mSize        = Vector2(size);
+  slot.mColor       = color;
+  slot.mQuadColor   = quadColor;
+  slot.mKnownBounds = knownBounds;
+  slot.mOwnColor    = ownColor;
+  slot.mVisible     = visible;
+  slot.mBatchable   = visible && batchable && knownBounds && ownColor;
+
+  // The renderer of the background is there unless the view draws it.
+  const uint32_t rendererCount   = actor.GetRendererCount();
+  const uint32_t backgroundCount = (hasBackground && !slot.mBatched) ? 1u : 0u;
+  slot.mDrawsOther               = visible && (rendererCount > backgroundCount || (hasBackground && !slot.mBatchable));
+}
+
+void QuadBatchView::UpdateBatchedStates()
+{
+  FindOverlaps();
+
+  // A background is drawn below the descendants, so the parents should draw nothing above it but batched backgrounds.
+  for(auto slotIndex : mDepthOrder)
+  {
+    Slot& slot  = mSlots[slotIndex];
+    Actor actor = slot.mActor.GetHandle();
+    if(!actor)
+    {
+      continue;
+    }
+
+    const Slot* parent  = FindSlot(slot.mParentId);
+    const bool  clear   = parent ? parent->mClearBelow : true;
+    const bool  batched = mUntrackedCount == 0u && clear && slot.mBatchable && !slot.mOverlapped;
+    slot.mClearBelow    = clear && !slot.mDrawsOther && (batched || !slot.mBatchable);
+
+    // The background may have been replaced while it's batched, so it's disabled again.
+    const bool wasBatched = slot.mBatched;
+    SetBatched(slot, actor, batched);
+    if(wasBatched != batched || (batched && slot.mQuadChanged))
+    {
+      WriteQuad(slotIndex);
+    }
+    slot.mQuadChanged = false;
+  }
+}
+
+void QuadBatchView::FindOverlaps()
+{
+  struct Bounds
+  {
+    float    mLeft;
+    float    mTop;
+    float    mRight;
+    float    mBottom;
+    uint32_t mSlotIndex;
+  };
+
+  // The bounds of a rotated or scaled descendant are not known, so it may overlap anything.
+  constexpr float UNKNOWN = std::numeric_limits<float>::max();
+
+  std::vector<Bounds> bounds;
+  for(uint32_t slotIndex = 0u; slotIndex < mSlots.size(); ++slotIndex)
+  {
+    Slot& slot       = mSlots[slotIndex];
+    slot.mOverlapped = false;
+    if(slot.mVisible && (slot.mBatchable || slot.mDrawsOther))
+    {
+      if(slot.mKnownBounds)
+      {
+        bounds.push_back({slot.mTopLeft.x, slot.mTopLeft.y, slot.mTopLeft.x + slot.mSize.width, slot.mTopLeft.y + slot.mSize.height, slotIndex});
+      }
+      else
+      {
+        bounds.push_back({-UNKNOWN, -UNKNOWN, UNKNOWN, UNKNOWN, slotIndex});
+      }
+    }
+  }
+
+  // Sweep from the left, so that only the bounds overlapping horizontally are compared.
+  std::sort(bounds.begin(), bounds.end(), [](const Bounds& lhs, const Bounds& rhs) { return lhs.mLeft < rhs.mLeft; });
+
+  std::vector<const Bounds*> active;
+  for(const auto& current : bounds)
+  {
+    active.erase(std::remove_if(active.begin(), active.end(), [&current](const Bounds* other) { return other->mRight <= current.mLeft; }), active.end());
+
+    for(const Bounds* other : active)
+    {
+      if(current.mTop < other->mBottom && other->mTop < current.mBottom)
+      {
+        Slot& currentSlot = mSlots[current.mSlotIndex];
+        Slot& otherSlot   = mSlots[other->mSlotIndex];
+
+        // A descendant is drawn above its parents anyway.
+        if(!IsAncestor(currentSlot, otherSlot) && !IsAncestor(otherSlot, currentSlot))
+        {
+          currentSlot.mOverlapped = true;
+          otherSlot.mOverlapped   = true;
+        }
+      }
+    }
+    active.push_back(&current);
+  }
+}
+
+bool QuadBatchView::IsAncestor(const Slot& ancestor, const Slot& descendant)
+{
+  Actor ancestorActor = ancestor.mActor.GetHandle();
+  if(!ancestorActor || ancestor.mDepth >= descendant.mDepth)
+  {
+    return false;
+  }
+
+  const uint32_t ancestorId = static_cast<uint32_t>(ancestorActor.GetProperty<int>(Actor::Property::ID));
+  const Slot*    slot       = &descendant;
+  while(slot && slot->mDepth > ancestor.mDepth)
+  {
+    if(slot->mParentId == ancestorId)
+    {
+      return true;
+    }
+    slot = FindSlot(slot->mParentId);
+  }
+  return false;
+}
+
+void QuadBatchView::SetBatched(Slot& slot, Actor& actor, bool batched)
+{
+  Toolkit::Control control = Toolkit::Control::DownCast(actor);
+  if(!control)
+  {
+    return;
+  }
+
+  Internal::Control& controlImpl = Toolkit::Internal::GetImplementation(control);
+  if(batched)
+  {
+    // The background may have been replaced since it was batched.
+    if(DevelControl::IsVisualEnabled(controlImpl, Toolkit::Control::Property::BACKGROUND))
+    {
+      DevelControl::EnableVisual(controlImpl, Toolkit::Control::Property::BACKGROUND, false);
+    }
+  }
+  else if(slot.mBatched && DevelControl::GetVisual(controlImpl, Toolkit::Control::Property::BACKGROUND))
+  {
+    DevelControl::EnableVisual(controlImpl, Toolkit::Control::Property::BACKGROUND, true);
+  }
+
+  if(slot.mBatched != batched)
+  {
+    slot.mBatched = batched;
+    batched ? ++mBatchedCount : --mBatchedCount;
+  }
+}
+
+void QuadBatchView::WriteQuad(uint32_t slotIndex)
+{
+  const Slot& slot     = mSlots[slotIndex];
+  QuadVertex* vertices = mVertices.Begin() + slotIndex * VERTICES_PER_QUAD;
+  if(slot.mBatched)
+  {
+    const float left   = slot.mTopLeft.x;
+    const float top    = slot.mTopLeft.y;
+    const float right  = left + slot.mSize.width;
+    const float bottom = top + slot.mSize.height;
+
+    vertices[0].mPosition = Vector2(left, top);     // Top left
+    vertices[1].mPosition = Vector2(right, top);    // Top right
+    vertices[2].mPosition = Vector2(left, bottom);  // Bottom left
+    vertices[3].mPosition = Vector2(right, bottom); // Bottom right
+    for(uint32_t i = 0u; i < VERTICES_PER_QUAD; ++i)
+    {
+      vertices[i].mColor = slot.mQuadColor;
+    }
+  }
+  else
+  {
+    for(uint32_t i = 0u; i < VERTICES_PER_QUAD; ++i)
+    {
+      vertices[i] = QuadVertex();
+    }
+  }
+
+  ++mUpdatedQuadCount;
+  mVerticesChanged = true;
+}
+
+void QuadBatchView::UpdateIndices()
+{
+  // The batched background of a parent overlaps the ones of its children, so it should be drawn first.
+  mDepthOrder.resize(mSlots.size());
+  for(uint32_t slotIndex = 0u; slotIndex < mDepthOrder.size(); ++slotIndex)
+  {
+    mDepthOrder[slotIndex] = slotIndex;
+  }
+  std::stable_sort(mDepthOrder.begin(), mDepthOrder.end(), [this](uint32_t lhs, uint32_t rhs) { return mSlots[lhs].mDepth < mSlots[rhs].mDepth; });
+
+  mIndices.Clear();
+  mIndices.Reserve(mDepthOrder.size() * INDICES_PER_QUAD);
+  for(auto slotIndex : mDepthOrder)
+  {
+    // Six indices in counter clockwise winding
+    const uint16_t firstVertex = static_cast<uint16_t>(slotIndex * VERTICES_PER_QUAD);
+    mIndices.PushBack(firstVertex + 1u);
+    mIndices.PushBack(firstVertex + 0u);
+    mIndices.PushBack(firstVertex + 2u);
+    mIndices.PushBack(firstVertex + 2u);
+    mIndices.PushBack(firstVertex + 3u);
+    mIndices.PushBack(firstVertex + 1u);
+  }
+  mVerticesChanged = true;
+}
+
+void QuadBatchView::UploadVertices()
+{
+  if(mBatchedCount == 0u)
+  {
+    if(mRenderer)
+    {
+      Self().RemoveRenderer(mRenderer);
+      mRenderer.Reset();
+    }
+    return;
+  }
+
+  if(!mRenderer)
+  {
+    Property::Map quadVertexFormat;
+    quadVertexFormat["aPosition"] = Property::VECTOR2;
+    quadVertexFormat["aColor"]    = Property::VECTOR4;
+
+    mVertexBuffer = VertexBuffer::New(quadVertexFormat);
+    mGeometry     = Geometry::New();
+    mGeometry.AddVertexBuffer(mVertexBuffer);
+
+    if(!mShader)
+    {
+      mShader = Shader::New(SHADER_QUAD_BATCH_VIEW_VERT, SHADER_QUAD_BATCH_VIEW_FRAG, Shader::Hint::NONE, "QUAD_BATCH_VIEW");
+    }
+
+    mRenderer = Renderer::New(mGeometry, mShader);
+    mRenderer.SetProperty(Dali::Renderer::Property::BLEND_MODE, BlendMode::ON);
+    mRenderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, DepthIndex::CONTENT);
+    Self().AddRenderer(mRenderer);
+  }
+
+  mVertexBuffer.SetData(mVertices.Begin(), mVertices.Count());
+  mGeometry.SetIndexBuffer(mIndices.Begin(), mIndices.Count());
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,280 @@
+#ifndef DALI_TOOLKIT_INTERNAL_QUAD_BATCH_VIEW_H
+#define DALI_TOOLKIT_INTERNAL_QUAD_BATCH_VIEW_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/processor-interface.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/rendering/geometry.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/shader.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/quad-batch-view/quad-batch-view.h>
+#include <dali-toolkit/public-api/controls/control-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @copydoc Toolkit::QuadBatchView
+ *
+ * Every descendant has a slot of four vertices in the vertex buffer. The slot of a descendant which
+ * is not batched has a degenerate quad, so that the other slots don't move. When a descendant
+ * is removed, the last slot is moved into its slot.
+ *
+ * The batched quads are drawn before all the descendants. A background is batched only if nothing
+ * else is drawn between it and the view, i.e. it overlaps no other descendant which draws, except
+ * its own descendants, and its parents draw nothing but batched backgrounds. The quads are indexed
+ * in the order of the depth, so that the batched background of a parent is drawn below its children.
+ */
+class QuadBatchView : public Control, public Integration::Processor
+{
+public:
+  /**
+   * Construct a new QuadBatchView.
+   */
+  QuadBatchView();
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~QuadBatchView();
+
+  /**
+   * Create a new QuadBatchView.
+   * @return A handle to the newly allocated QuadBatchView.
+   */
+  static Toolkit::QuadBatchView New();
+
+  /**
+   * @copydoc Toolkit::QuadBatchView::GetStatistics
+   */
+  Property::Map GetStatistics() const;
+
+private: // From Control
+  /**
+   * @copydoc Control::OnChildAdd()
+   */
+  void OnChildAdd(Actor& child) override;
+
+  /**
+   * @copydoc Control::OnChildRemove()
+   */
+  void OnChildRemove(Actor& child) override;
+
+  /**
+   * @copydoc Control::OnSizeSet()
+   */
+  void OnSizeSet(const Vector3& targetSize) override;
+
+protected:
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process(bool postProcessor) override;
+
+  /**
+   * @copydoc Dali::Integration::Processor::GetProcessorName()
+   */
+  std::string_view GetProcessorName() const override
+  {
+    return "QuadBatchView";
+  }
+
+private:
+  struct QuadVertex
+  {
+    Vector2 mPosition; ///< Vertex position
+    Vector4 mColor;    ///< Vertex color
+  };
+
+  struct Slot
+  {
+    WeakHandle<Actor> mActor;       ///< The descendant drawn in this slot
+    uint32_t          mParentId;    ///< The actor id of the parent
+    uint32_t          mDepth;       ///< The depth below the view, 1 for the children
+    Vector2           mTopLeft;     ///< The top left corner relative to the center of the view
+    Vector2           mSize;        ///< The size of the descendant
+    Vector4           mColor;       ///< The color of the descendant with the alpha inherited from its parents
+    Vector4           mQuadColor;   ///< The color of the background multiplied by the color of the descendant
+    bool              mDirty;       ///< Whether the geometry should be rebuilt
+    bool              mKnownBounds; ///< Whether neither the descendant nor a parent is rotated or scaled
+    bool              mOwnColor;    ///< Whether the color of the descendant and its parents only inherit the alpha of the view
+    bool              mVisible;     ///< Whether the descendant and its parents are visible
+    bool              mBatchable;   ///< Whether the background can be drawn by the view
+    bool              mDrawsOther;  ///< Whether the descendant draws anything but a batchable background
+    bool              mOverlapped;  ///< Whether the descendant overlaps another one which draws
+    bool              mBatched;     ///< Whether the background of the descendant is drawn by the view
+    bool              mClearBelow;  ///< Whether nothing but batched backgrounds is drawn between the view and the descendant's children
+    bool              mQuadChanged; ///< Whether the vertices should be rewritten
+  };
+
+  /**
+   * @brief Called when a child is added to a descendant.
+   */
+  void OnDescendantAdded(Actor child);
+
+  /**
+   * @brief Called when a child is removed from a descendant.
+   */
+  void OnDescendantRemoved(Actor child);
+
+  /**
+   * @brief Called when a property of a descendant is set.
+   */
+  void OnDescendantPropertySet(Handle& handle, Property::Index index, const Property::Value& value);
+
+  /**
+   * @brief Called when a descendant is relaid out.
+   */
+  void OnDescendantRelayout(Actor actor);
+
+  /**
+   * @brief Adds the slots of an actor and its descendants.
+   * @param[in] actor The actor
+   * @param[in] depth The depth of the actor below the view
+   */
+  void AddActor(Actor actor, uint32_t depth);
+
+  /**
+   * @brief Removes the slots of an actor and its descendants.
+   * @param[in] actor The actor
+   */
+  void RemoveActor(Actor actor);
+
+  /**
+   * @brief Finds the slot of an actor.
+   * @param[in] actorId The id of the actor
+   * @return The slot, or nullptr if the actor has no slot
+   */
+  Slot* FindSlot(uint32_t actorId);
+
+  /**
+   * @brief Marks the slots of an actor and its descendants to be rebuilt.
+   * @param[in] actor The actor
+   */
+  void MarkDirty(Actor actor);
+
+  /**
+   * @brief Requests to rebuild the dirty quads after the relayout.
+   */
+  void RequestUpdate();
+
+  /**
+   * @brief Rebuilds the geometry and the color of a slot from its parent.
+   * @param[in] slot The slot
+   * @param[in] viewSize The size of the view
+   */
+  void UpdateGeometry(Slot& slot, const Vector2& viewSize);
+
+  /**
+   * @brief Decides which backgrounds are batched, and rewrites the changed quads.
+   */
+  void UpdateBatchedStates();
+
+  /**
+   * @brief Marks the descendants whose bounds overlap the bounds of another descendant which draws.
+   */
+  void FindOverlaps();
+
+  /**
+   * @brief Checks whether a slot is an ancestor of another one.
+   * @param[in] ancestor The slot which may be the ancestor
+   * @param[in] descendant The slot which may be the descendant
+   * @return True if the actor of ancestor is a parent of the actor of descendant, directly or not
+   */
+  bool IsAncestor(const Slot& ancestor, const Slot& descendant);
+
+  /**
+   * @brief Sets whether the background of a descendant is drawn by the view.
+   * @param[in] slot The slot of the descendant
+   * @param[in] actor The descendant
+   * @param[in] batched True if the view draws the background
+   */
+  void SetBatched(Slot& slot, Actor& actor, bool batched);
+
+  /**
+   * @brief Rewrites the vertices of a slot.
+   * @param[in] slotIndex The index of the slot
+   */
+  void WriteQuad(uint32_t slotIndex);
+
+  /**
+   * @brief Rebuilds the order of the slots and the indices of the quads in the order of the depth.
+   */
+  void UpdateIndices();
+
+  /**
+   * @brief Uploads the vertices and creates the renderer when it's needed.
+   */
+  void UploadVertices();
+
+private:
+  QuadBatchView(const QuadBatchView&) = delete;
+  QuadBatchView& operator=(const QuadBatchView&) = delete;
+
+private:
+  std::vector<Slot>                      mSlots;
+  std::unordered_map<uint32_t, uint32_t> mSlotIndices; ///< The slot indices by the actor id of the descendants
+  std::vector<uint32_t>                  mDepthOrder;  ///< The slot indices in the order of the depth
+  Vector<QuadVertex>                     mVertices;
+  Vector<uint16_t>                       mIndices;
+  VertexBuffer                           mVertexBuffer;
+  Geometry                               mGeometry;
+  Shader                                 mShader;
+  Renderer                               mRenderer;
+  uint32_t                               mBatchedCount;     ///< The number of the backgrounds drawn by the view
+  uint32_t                               mUntrackedCount;   ///< The number of the descendants over the maximum number of the quads
+  uint32_t                               mUpdatedQuadCount; ///< The number of the quads rebuilt so far
+  bool                                   mAllDirty : 1;
+  bool                                   mSlotsChanged : 1; ///< Whether a slot was added or removed
+  bool                                   mVerticesChanged : 1;
+  bool                                   mProcessorRegistered : 1;
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Toolkit::Internal::QuadBatchView& GetImpl(Toolkit::QuadBatchView& obj)
+{
+  DALI_ASSERT_ALWAYS(obj);
+  Dali::RefObject& handle = obj.GetImplementation();
+  return static_cast<Toolkit::Internal::QuadBatchView&>(handle);
+}
+
+inline const Toolkit::Internal::QuadBatchView& GetImpl(const Toolkit::QuadBatchView& obj)
+{
+  DALI_ASSERT_ALWAYS(obj);
+  const Dali::RefObject& handle = obj.GetImplementation();
+  return static_cast<const Toolkit::Internal::QuadBatchView&>(handle);
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_QUAD_BATCH_VIEW_H
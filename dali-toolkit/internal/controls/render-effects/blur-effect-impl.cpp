@@ -35,9 +35,16 @@
 namespace
 {
 // Default values
-static constexpr float    BLUR_EFFECT_DOWNSCALE_FACTOR = 0.4f;
-static constexpr uint32_t BLUR_EFFECT_PIXEL_RADIUS     = 5u;
-static constexpr int32_t  BLUR_EFFECT_ORDER_INDEX      = 101;
+static constexpr float    BLUR_EFFECT_DOWNSCALE_FACTOR  = 0.4f;
+static constexpr uint32_t BLUR_EFFECT_PIXEL_RADIUS      = 5u;
+static constexpr int32_t  BLUR_EFFECT_ORDER_INDEX       = 101;
+static constexpr int32_t  BLUR_EFFECT_ORDER_INDEX_COUNT = 3; // The source task, then the tasks reading it, then the tasks writing the output
+
+// The dual filter doubles its reach with each level of its chain, until the level is a pixel
+static constexpr uint32_t DUAL_FILTER_MAX_LEVELS = 14u;
+
+// The kernels sample a texel or two away from the center. Further, they miss texels and alias.
+static constexpr float DUAL_FILTER_MAX_OFFSET = 2.0f;
 } // namespace
 
 namespace Dali
@@ -48,25 +55,43 @@ namespace Internal
 {
 BlurEffectImpl::BlurEffectImpl(bool isBackground)
 : RenderEffectImpl(),
+  mSequenceSlot(0u),
+  mOrderIndex(BLUR_EFFECT_ORDER_INDEX),
   mInternalRoot(Actor::New()),
   mDownscaleFactor(BLUR_EFFECT_DOWNSCALE_FACTOR),
   mPixelRadius(BLUR_EFFECT_PIXEL_RADIUS),
   mBellCurveWidth(0.001f),
+  mDualFilterLevels(0u),
+  mDualFilterOffset(0.0f),
+  mAlgorithm(DevelBackgroundBlurEffect::BlurAlgorithm::GAUSSIAN),
   mIsActivated(false),
   mIsBackground(isBackground)
 {
 }
 
-BlurEffectImpl::BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground)
+BlurEffectImpl::BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground, DevelBackgroundBlurEffect::BlurAlgorithm algorithm)
 : RenderEffectImpl(),
+  mSequenceSlot(0u),
+  mOrderIndex(BLUR_EFFECT_ORDER_INDEX),
   mInternalRoot(Actor::New()),
   mDownscaleFactor(downscaleFactor),
   mPixelRadius((blurRadius >> 2) + 1),
   mBellCurveWidth(0.001f),
+  mDualFilterLevels(1u),
+  mDualFilterOffset(0.0f),
+  mAlgorithm(algorithm),
   mIsActivated(false),
   mIsBackground(isBackground)
 {
   DALI_ASSERT_ALWAYS(downscaleFactor <= 1.0 && 0.0 < downscaleFactor);
+
+  // Take the fewest levels that reach the radius with an offset of a texel at most. The offset covers the
+  // rest of it, so that the radius only changes uniforms, not the shader.
+  while(mDualFilterLevels < DUAL_FILTER_MAX_LEVELS && (2u << mDualFilterLevels) < blurRadius)
+  {
+    ++mDualFilterLevels;
+  }
+  mDualFilterOffset = static_cast<float>(blurRadius) / static_cast<float>(2u << mDualFilterLevels);
 }
 
 BlurEffectImpl::~BlurEffectImpl()
@@ -82,7 +107,12 @@ BlurEffectImplPtr BlurEffectImpl::New(bool isBackground)
 
 BlurEffectImplPtr BlurEffectImpl::New(float downscaleFactor, uint32_t blurRadius, bool isBackground)
 {
-  BlurEffectImplPtr handle = new BlurEffectImpl(downscaleFactor, blurRadius, isBackground);
+  return New(downscaleFactor, blurRadius, isBackground, DevelBackgroundBlurEffect::BlurAlgorithm::GAUSSIAN);
+}
+
+BlurEffectImplPtr BlurEffectImpl::New(float downscaleFactor, uint32_t blurRadius, bool isBackground, DevelBackgroundBlurEffect::BlurAlgorithm algorithm)
+{
+  BlurEffectImplPtr handle = new BlurEffectImpl(downscaleFactor, blurRadius, isBackground, algorithm);
   handle->Initialize();
   return handle;
 }
@@ -105,6 +135,23 @@ void BlurEffectImpl::Initialize()
   mRenderDownsampledCamera.SetFieldOfView(Math::PI / 4.0f);
   mInternalRoot.Add(mRenderDownsampledCamera);
 
+  mInternalRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+
+  if(mAlgorithm == DevelBackgroundBlurEffect::BlurAlgorithm::DUAL_FILTER)
+  {
+    // Create an actor for each downsampling pass, then for each upsampling pass.
+    // All of them share two programs, whatever the radius.
+    for(uint32_t i = 0u; i < mDualFilterLevels * 2u; ++i)
+    {
+      Actor actor = Actor::New();
+      actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+      actor.AddRenderer(CreateRenderer(BASIC_VERTEX_SOURCE, i < mDualFilterLevels ? SHADER_BLUR_EFFECT_DOWNSAMPLE_FRAG : SHADER_BLUR_EFFECT_UPSAMPLE_FRAG));
+      mInternalRoot.Add(actor);
+      mDualFilterActors.push_back(actor);
+    }
+    return;
+  }
+
   //////////////////////////////////////////////////////
   // Create shaders
 
@@ -125,7 +172,6 @@ void BlurEffectImpl::Initialize()
 
   //////////////////////////////////////////////////////
   // Create actors
-  mInternalRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
 
   // Create an actor for performing a horizontal blur on the texture
   mHorizontalBlurActor = Actor::New();
@@ -195,25 +241,21 @@ void BlurEffectImpl::Activate()
   RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
 
   // Prepare resource
-  // original texture output
-  mInputBackgroundFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
-  Texture inputBackgroundTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
-  mInputBackgroundFrameBuffer.AttachColorTexture(inputBackgroundTexture);
-
-  // half-blurred output
-  mTemporaryFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
-  Texture temporaryTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
-  mTemporaryFrameBuffer.AttachColorTexture(temporaryTexture);
+  // original texture output is only read by our own render tasks, so it is shared through the pool.
+  // Our tasks get order indices of their own, so they never interleave with the tasks of the other effects.
+  mRenderTargetPool = RenderTargetPool::Get();
+  if(mRenderTargetPool)
+  {
+    mSequenceSlot = mRenderTargetPool.ReserveSequenceSlot();
+    mOrderIndex   = BLUR_EFFECT_ORDER_INDEX + static_cast<int32_t>(mSequenceSlot) * BLUR_EFFECT_ORDER_INDEX_COUNT;
+  }
+  mInputBackgroundFrameBuffer = AcquireTransientFrameBuffer(downsampledWidth, downsampledHeight, 0u);
 
-  // blurred output
+  // blurred output is read while rendering the owner control, so it stays our own
   mSourceFrameBuffer    = FrameBuffer::New(downsampledWidth, downsampledHeight, FrameBuffer::Attachment::NONE);
   Texture sourceTexture = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, downsampledWidth, downsampledHeight);
   mSourceFrameBuffer.AttachColorTexture(sourceTexture);
 
-  // Add BlurActors
-  mHorizontalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight)); // mTemporaryFrameBuffer
-  mVerticalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight));   // mSourceFrameBuffer
-
   // Add CameraActors
   float cameraPosConstraintScale = 0.5f / tanf(Math::PI / 4.0f * 0.5f);
 
@@ -223,8 +265,6 @@ void BlurEffectImpl::Activate()
   mRenderDownsampledCamera.SetAspectRatio(float(downsampledWidth) / float(downsampledHeight));
   mRenderDownsampledCamera.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, cameraPosConstraintScale * size.height * mDownscaleFactor));
 
-  SetShaderConstants(downsampledWidth, downsampledHeight);
-
   // Prepare input texture
   mSourceRenderTask = taskList.CreateTask();
   if(mIsBackground)
@@ -236,30 +276,26 @@ void BlurEffectImpl::Activate()
   {
     mSourceRenderTask.SetSourceActor(ownerControl);
   }
-  mSourceRenderTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX);
+  mSourceRenderTask.SetOrderIndex(mOrderIndex);
   mSourceRenderTask.SetCameraActor(mRenderFullSizeCamera);
   mSourceRenderTask.SetFrameBuffer(mInputBackgroundFrameBuffer);
   mSourceRenderTask.SetInputEnabled(false);
   mSourceRenderTask.SetExclusive(false);
 
   // Blur tasks
-  SetRendererTexture(mHorizontalBlurActor.GetRendererAt(0), mInputBackgroundFrameBuffer);
-  mHorizontalBlurTask = taskList.CreateTask();
-  mHorizontalBlurTask.SetSourceActor(mHorizontalBlurActor);
-  mHorizontalBlurTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 1);
-  mHorizontalBlurTask.SetExclusive(true);
-  mHorizontalBlurTask.SetInputEnabled(false);
-  mHorizontalBlurTask.SetCameraActor(mRenderDownsampledCamera);
-  mHorizontalBlurTask.SetFrameBuffer(mTemporaryFrameBuffer);
+  if(mAlgorithm == DevelBackgroundBlurEffect::BlurAlgorithm::DUAL_FILTER)
+  {
+    CreateDualFilterTasks(taskList, downsampledWidth, downsampledHeight);
+  }
+  else
+  {
+    CreateGaussianBlurTasks(taskList, downsampledWidth, downsampledHeight);
+  }
 
-  SetRendererTexture(mVerticalBlurActor.GetRendererAt(0), mTemporaryFrameBuffer);
-  mVerticalBlurTask = taskList.CreateTask();
-  mVerticalBlurTask.SetSourceActor(mVerticalBlurActor);
-  mVerticalBlurTask.SetOrderIndex(BLUR_EFFECT_ORDER_INDEX + 2);
-  mVerticalBlurTask.SetExclusive(true);
-  mVerticalBlurTask.SetInputEnabled(false);
-  mVerticalBlurTask.SetCameraActor(mRenderDownsampledCamera);
-  mVerticalBlurTask.SetFrameBuffer(mSourceFrameBuffer);
+  if(mIsBackground)
+  {
+    SynchronizeBackgroundCornerRadius();
+  }
 
   // Inject output to control
   Renderer renderer = GetTargetRenderer();
@@ -283,16 +319,136 @@ void BlurEffectImpl::Deactivate()
 
   mInternalRoot.Unparent();
 
+  if(mRenderTargetPool)
+  {
+    mRenderTargetPool.Release(mInputBackgroundFrameBuffer);
+    mRenderTargetPool.Release(mTemporaryFrameBuffer);
+    for(auto& frameBuffer : mDualFilterFrameBuffers)
+    {
+      mRenderTargetPool.Release(frameBuffer);
+    }
+    mRenderTargetPool.FreeSequenceSlot(mSequenceSlot);
+    mRenderTargetPool.Reset();
+  }
   mInputBackgroundFrameBuffer.Reset();
   mTemporaryFrameBuffer.Reset();
+  mDualFilterFrameBuffers.clear();
   mSourceFrameBuffer.Reset();
 
   RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
-  taskList.RemoveTask(mHorizontalBlurTask);
-  taskList.RemoveTask(mVerticalBlurTask);
+  if(mAlgorithm == DevelBackgroundBlurEffect::BlurAlgorithm::DUAL_FILTER)
+  {
+    for(auto& task : mDualFilterTasks)
+    {
+      taskList.RemoveTask(task);
+    }
+    mDualFilterTasks.clear();
+  }
+  else
+  {
+    taskList.RemoveTask(mHorizontalBlurTask);
+    taskList.RemoveTask(mVerticalBlurTask);
+  }
   taskList.RemoveTask(mSourceRenderTask);
 }
 
+FrameBuffer BlurEffectImpl::AcquireTransientFrameBuffer(uint32_t width, uint32_t height, uint32_t use)
+{
+  if(mRenderTargetPool)
+  {
+    return mRenderTargetPool.Acquire(width, height, Dali::Pixel::RGBA8888, use);
+  }
+
+  FrameBuffer frameBuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+  Texture     texture     = Texture::New(TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, width, height);
+  frameBuffer.AttachColorTexture(texture);
+  return frameBuffer;
+}
+
+void BlurEffectImpl::CreateGaussianBlurTasks(RenderTaskList& taskList, uint32_t downsampledWidth, uint32_t downsampledHeight)
+{
+  // half-blurred output
+  mTemporaryFrameBuffer = AcquireTransientFrameBuffer(downsampledWidth, downsampledHeight, 1u);
+
+  mHorizontalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight)); // mTemporaryFrameBuffer
+  mVerticalBlurActor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight));   // mSourceFrameBuffer
+
+  SetShaderConstants(downsampledWidth, downsampledHeight);
+
+  SetRendererTexture(mHorizontalBlurActor.GetRendererAt(0), mInputBackgroundFrameBuffer);
+  mHorizontalBlurTask = taskList.CreateTask();
+  mHorizontalBlurTask.SetSourceActor(mHorizontalBlurActor);
+  mHorizontalBlurTask.SetOrderIndex(mOrderIndex + 1);
+  mHorizontalBlurTask.SetExclusive(true);
+  mHorizontalBlurTask.SetInputEnabled(false);
+  mHorizontalBlurTask.SetCameraActor(mRenderDownsampledCamera);
+  mHorizontalBlurTask.SetFrameBuffer(mTemporaryFrameBuffer);
+
+  SetRendererTexture(mVerticalBlurActor.GetRendererAt(0), mTemporaryFrameBuffer);
+  mVerticalBlurTask = taskList.CreateTask();
+  mVerticalBlurTask.SetSourceActor(mVerticalBlurActor);
+  mVerticalBlurTask.SetOrderIndex(mOrderIndex + 2);
+  mVerticalBlurTask.SetExclusive(true);
+  mVerticalBlurTask.SetInputEnabled(false);
+  mVerticalBlurTask.SetCameraActor(mRenderDownsampledCamera);
+  mVerticalBlurTask.SetFrameBuffer(mSourceFrameBuffer);
+}
+
+void BlurEffectImpl::CreateDualFilterTasks(RenderTaskList& taskList, uint32_t downsampledWidth, uint32_t downsampledHeight)
+{
+  // Every pass actor fills the view of the downsampled camera, so it covers whatever render target it is drawn to.
+  for(auto& actor : mDualFilterActors)
+  {
+    actor.SetProperty(Actor::Property::SIZE, Vector2(downsampledWidth, downsampledHeight));
+  }
+
+  // A level can't be smaller than a pixel. Each level dropped doubles the offset, up to the most the kernels are made for;
+  // past that, the blur covers the whole input anyway.
+  const uint32_t minimumSize = std::min(downsampledWidth, downsampledHeight);
+  uint32_t       levels      = 1u;
+  while(levels < mDualFilterLevels && (minimumSize >> (levels + 1u)) > 0u)
+  {
+    ++levels;
+  }
+  const float offset = std::min(mDualFilterOffset * static_cast<float>(1u << (mDualFilterLevels - levels)), DUAL_FILTER_MAX_OFFSET);
+
+  // Downsample through the chain
+  FrameBuffer input = mInputBackgroundFrameBuffer;
+  for(uint32_t level = 1u; level <= levels; ++level)
+  {
+    FrameBuffer output = AcquireTransientFrameBuffer(std::max(downsampledWidth >> level, 1u), std::max(downsampledHeight >> level, 1u), level);
+    mDualFilterFrameBuffers.push_back(output);
+
+    CreateDualFilterTask(taskList, mDualFilterActors[level - 1u], input, output, mOrderIndex + 1, offset);
+    input = output;
+  }
+
+  // Upsample back into the output. The downsampled images are not needed anymore, so their targets are reused.
+  for(uint32_t level = levels; level > 0u; --level)
+  {
+    FrameBuffer output = (level > 1u) ? mDualFilterFrameBuffers[level - 2u] : mSourceFrameBuffer;
+
+    CreateDualFilterTask(taskList, mDualFilterActors[mDualFilterLevels * 2u - level], input, output, mOrderIndex + 2, offset);
+    input = output;
+  }
+}
+
+void BlurEffectImpl::CreateDualFilterTask(RenderTaskList& taskList, Actor actor, FrameBuffer input, FrameBuffer output, int32_t orderIndex, float offset)
+{
+  Texture inputTexture = input.GetColorTexture();
+  actor.RegisterProperty("uHalfPixel", Vector2(0.5f * offset / inputTexture.GetWidth(), 0.5f * offset / inputTexture.GetHeight()));
+  SetRendererTexture(actor.GetRendererAt(0), input);
+
+  RenderTask task = taskList.CreateTask();
+  task.SetSourceActor(actor);
+  task.SetOrderIndex(orderIndex);
+  task.SetExclusive(true);
+  task.SetInputEnabled(false);
+  task.SetCameraActor(mRenderDownsampledCamera);
+  task.SetFrameBuffer(output);
+  mDualFilterTasks.push_back(task);
+}
+
 void BlurEffectImpl::SetShaderConstants(float downsampledWidth, float downsampledHeight)
 {
   std::vector<float> uvOffsets(mPixelRadius);
@@ -332,11 +488,6 @@ void BlurEffectImpl::SetShaderConstants(float downsampledWidth, float downsample
     mVerticalBlurActor.RegisterProperty(GetSampleOffsetsPropertyName(i), Vector2(0.0f, uvOffsets[i] / downsampledHeight));
     mVerticalBlurActor.RegisterProperty(GetSampleWeightsPropertyName(i), weights[i]);
   }
-
-  if(mIsBackground)
-  {
-    SynchronizeBackgroundCornerRadius();
-  }
 }
 
 std::string BlurEffectImpl::GetSampleOffsetsPropertyName(unsigned int index) const
@@ -18,8 +18,13 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/render-effects/background-blur-effect-devel.h>
 #include <dali-toolkit/internal/controls/render-effects/render-effect-impl.h>
+#include <dali-toolkit/internal/controls/render-effects/render-target-pool.h>
 #include <dali-toolkit/public-api/controls/render-effects/background-blur-effect.h>
 
 namespace Dali
@@ -60,6 +65,17 @@ public:
    */
   static BlurEffectImplPtr New(float downscaleFactor, uint32_t blurRadius, bool isBackground);
 
+  /**
+   * @brief Creates an initialized BlurEffect implementation with the given algorithm.
+   *
+   * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
+   * @param[in] blurRadius The radius of the blur.
+   * @param[in] isBackground True when blurring background, False otherwise
+   * @param[in] algorithm The algorithm used to blur
+   * @return A handle to a newly allocated Dali resource
+   */
+  static BlurEffectImplPtr New(float downscaleFactor, uint32_t blurRadius, bool isBackground, DevelBackgroundBlurEffect::BlurAlgorithm algorithm);
+
   /**
    * @brief Activates blur effect
    */
@@ -82,8 +98,9 @@ protected:
    * @param[in] downscaleFactor This value should reside in the range [0.0, 1.0].
    * @param[in] blurRadius The radius of Gaussian kernel.
    * @param[in] isBackground True when blurring background, False otherwise
+   * @param[in] algorithm The algorithm used to blur
    */
-  BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground);
+  BlurEffectImpl(float downscaleFactor, uint32_t blurRadius, bool isBackground, DevelBackgroundBlurEffect::BlurAlgorithm algorithm);
 
   /**
    * @brief Destructor
@@ -105,6 +122,43 @@ private:
    */
   Vector2 GetTargetSizeForValidTexture();
 
+  /**
+   * @brief Acquires a render target that is only used by our own render tasks, from the pool if there is one.
+   * @param[in] width The width of the render target
+   * @param[in] height The height of the render target
+   * @param[in] use Tells apart the render targets we use at the same time
+   * @return The render target
+   */
+  FrameBuffer AcquireTransientFrameBuffer(uint32_t width, uint32_t height, uint32_t use);
+
+  /**
+   * @brief Creates the horizontal and vertical blur tasks, blurring mInputBackgroundFrameBuffer into mSourceFrameBuffer.
+   * @param[in] taskList The render task list of the stage
+   * @param[in] downsampledWidth Downsized width of input texture.
+   * @param[in] downsampledHeight Downsized height of input texture.
+   */
+  void CreateGaussianBlurTasks(RenderTaskList& taskList, uint32_t downsampledWidth, uint32_t downsampledHeight);
+
+  /**
+   * @brief Creates the down- and upsampling tasks, blurring mInputBackgroundFrameBuffer into mSourceFrameBuffer.
+   * The levels the input is too small for are dropped, and the sample offset grows to make up for them.
+   * @param[in] taskList The render task list of the stage
+   * @param[in] downsampledWidth Downsized width of input texture.
+   * @param[in] downsampledHeight Downsized height of input texture.
+   */
+  void CreateDualFilterTasks(RenderTaskList& taskList, uint32_t downsampledWidth, uint32_t downsampledHeight);
+
+  /**
+   * @brief Creates a task rendering one pass of the dual filter.
+   * @param[in] taskList The render task list of the stage
+   * @param[in] actor The actor of the pass
+   * @param[in] input The render target to read
+   * @param[in] output The render target to write
+   * @param[in] orderIndex The order index of the task
+   * @param[in] offset The sample offset, in texels of the input
+   */
+  void CreateDualFilterTask(RenderTaskList& taskList, Actor actor, FrameBuffer input, FrameBuffer output, int32_t orderIndex, float offset);
+
   /**
    * @brief Calculates gaussian weight
    * @param[in] localOffset Input to the function
@@ -151,7 +205,10 @@ private:
   CameraActor mRenderDownsampledCamera;
 
   // Resource
-  FrameBuffer mInputBackgroundFrameBuffer; // Input. Background. What to blur.
+  RenderTargetPool mRenderTargetPool;           // Shares mInputBackgroundFrameBuffer and mTemporaryFrameBuffer with the other effects.
+  FrameBuffer      mInputBackgroundFrameBuffer; // Input. Background. What to blur.
+  uint32_t         mSequenceSlot;               // Our slot in the pool, which gives our render tasks their order indices.
+  int32_t          mOrderIndex;                 // The order index of our first render task.
 
   Actor       mInternalRoot;
   Actor       mHorizontalBlurActor;
@@ -160,6 +217,10 @@ private:
   Actor       mVerticalBlurActor;
   RenderTask  mVerticalBlurTask;
 
+  std::vector<Actor>       mDualFilterActors;       // Downsampling passes, then upsampling passes.
+  std::vector<RenderTask>  mDualFilterTasks;
+  std::vector<FrameBuffer> mDualFilterFrameBuffers; // Chain of half-sized targets, below mInputBackgroundFrameBuffer.
+
   FrameBuffer mSourceFrameBuffer; // Output. Blurred background texture for mOwnerControl and mRenderer.
   RenderTask  mSourceRenderTask;
 
@@ -167,6 +228,10 @@ private:
   float    mDownscaleFactor;
   uint32_t mPixelRadius;
   float    mBellCurveWidth;
+  uint32_t mDualFilterLevels; // The levels which reach the radius, if the input is large enough for them.
+  float    mDualFilterOffset; // The sample offset with all the levels.
+
+  DevelBackgroundBlurEffect::BlurAlgorithm mAlgorithm;
 
   bool mIsActivated : 1;
   bool mIsBackground : 1;
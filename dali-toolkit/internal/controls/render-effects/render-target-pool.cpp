@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/render-effects/render-target-pool.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/singleton-service.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/rendering/texture.h>
+#include <algorithm>
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+constexpr uint32_t MAXIMUM_RELEASED_TARGET_COUNT = 2u;  ///< The number of released targets kept for reuse
+constexpr uint32_t SIZE_BUCKET                   = 16u; ///< Sizes are rounded up to a multiple of this many pixels
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_RENDER_TARGET_POOL");
+#endif
+
+uint32_t GetBucketSize(uint32_t size)
+{
+  return std::max((size + SIZE_BUCKET - 1u) / SIZE_BUCKET, 1u) * SIZE_BUCKET;
+}
+} // namespace
+
+class RenderTargetPool::Impl : public Dali::BaseObject
+{
+public:
+  /**
+   * @brief Constructor
+   */
+  Impl() = default;
+
+  uint32_t ReserveSequenceSlot()
+  {
+    auto iter = std::find(mSequenceSlots.begin(), mSequenceSlots.end(), false);
+    if(iter == mSequenceSlots.end())
+    {
+      iter = mSequenceSlots.insert(iter, false);
+    }
+    *iter = true;
+    return static_cast<uint32_t>(std::distance(mSequenceSlots.begin(), iter));
+  }
+
+  void FreeSequenceSlot(uint32_t slot)
+  {
+    if(slot < mSequenceSlots.size())
+    {
+      mSequenceSlots[slot] = false;
+    }
+  }
+
+  FrameBuffer Acquire(uint32_t width, uint32_t height, Pixel::Format format, uint32_t use)
+  {
+    width  = GetBucketSize(width);
+    height = GetBucketSize(height);
+
+    auto matches = [&](const Entry& entry) { return entry.width == width && entry.height == height && entry.format == format && entry.use == use; };
+
+    // Another effect uses it already. Their render tasks don't interleave, so they can share it.
+    auto iter = std::find_if(mEntries.begin(), mEntries.end(), matches);
+    if(iter != mEntries.end())
+    {
+      ++iter->userCount;
+      return iter->frameBuffer;
+    }
+
+    iter = std::find_if(mReleasedEntries.begin(), mReleasedEntries.end(), matches);
+    if(iter != mReleasedEntries.end())
+    {
+      mEntries.push_back(*iter);
+      mEntries.back().userCount = 1u;
+      mReleasedEntries.erase(iter);
+
+      DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Reuse render target %ux%u, pooled bytes: %u\n", width, height, mPooledBytes);
+      return mEntries.back().frameBuffer;
+    }
+
+    FrameBuffer frameBuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+    frameBuffer.AttachColorTexture(Texture::New(TextureType::TEXTURE_2D, format, width, height));
+
+    uint32_t bytes = width * height * Pixel::GetBytesPerPixel(format);
+    mEntries.push_back({frameBuffer, width, height, format, use, bytes, 1u});
+    mPooledBytes += bytes;
+
+    DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Create render target %ux%u, pooled bytes: %u\n", width, height, mPooledBytes);
+    return frameBuffer;
+  }
+
+  void Release(FrameBuffer frameBuffer)
+  {
+    auto iter = std::find_if(mEntries.begin(), mEntries.end(), [&](const Entry& entry) { return entry.frameBuffer == frameBuffer; });
+    if(iter == mEntries.end() || --iter->userCount > 0u)
+    {
+      return;
+    }
+
+    mReleasedEntries.push_back(*iter);
+    mEntries.erase(iter);
+
+    if(mReleasedEntries.size() > MAXIMUM_RELEASED_TARGET_COUNT)
+    {
+      // Destroy the oldest released target
+      const Entry& oldest = mReleasedEntries.front();
+      mPooledBytes -= oldest.bytes;
+      DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Destroy render target %ux%u, pooled bytes: %u\n", oldest.width, oldest.height, mPooledBytes);
+      mReleasedEntries.erase(mReleasedEntries.begin());
+    }
+  }
+
+  uint32_t GetPooledBytes() const
+  {
+    return mPooledBytes;
+  }
+
+protected:
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  ~Impl() override = default;
+
+private:
+  struct Entry
+  {
+    FrameBuffer   frameBuffer;
+    uint32_t      width;
+    uint32_t      height;
+    Pixel::Format format;
+    uint32_t      use;
+    uint32_t      bytes;
+    uint32_t      userCount; ///< The number of effects using the target
+  };
+
+  std::vector<Entry> mEntries;         ///< The targets in use. Only a few, so a linear search is enough
+  std::vector<Entry> mReleasedEntries; ///< The targets kept for reuse, oldest first
+  std::vector<bool>  mSequenceSlots;   ///< Whether each sequence slot is reserved
+  uint32_t           mPooledBytes{0u};
+};
+
+RenderTargetPool::RenderTargetPool() = default;
+
+RenderTargetPool::~RenderTargetPool() = default;
+
+RenderTargetPool RenderTargetPool::Get()
+{
+  RenderTargetPool pool;
+
+  // Check whether the RenderTargetPool is already created
+  SingletonService singletonService(SingletonService::Get());
+  if(singletonService)
+  {
+    Dali::BaseHandle handle = singletonService.GetSingleton(typeid(RenderTargetPool));
+    if(handle)
+    {
+      // If so, downcast the handle of singleton to RenderTargetPool
+      pool = RenderTargetPool(dynamic_cast<RenderTargetPool::Impl*>(handle.GetObjectPtr()));
+    }
+
+    if(!pool)
+    {
+      // If not, create the RenderTargetPool and register it as a singleton
+      pool = RenderTargetPool(new RenderTargetPool::Impl());
+      singletonService.Register(typeid(pool), pool);
+    }
+  }
+
+  return pool;
+}
+
+RenderTargetPool::RenderTargetPool(RenderTargetPool::Impl* impl)
+: BaseHandle(impl)
+{
+}
+
+uint32_t RenderTargetPool::ReserveSequenceSlot()
+{
+  return static_cast<RenderTargetPool::Impl&>(GetBaseObject()).ReserveSequenceSlot();
+}
+
+void RenderTargetPool::FreeSequenceSlot(uint32_t slot)
+{
+  static_cast<RenderTargetPool::Impl&>(GetBaseObject()).FreeSequenceSlot(slot);
+}
+
+FrameBuffer RenderTargetPool::Acquire(uint32_t width, uint32_t height, Pixel::Format format, uint32_t use)
+{
+  return static_cast<RenderTargetPool::Impl&>(GetBaseObject()).Acquire(width, height, format, use);
+}
+
+void RenderTargetPool::Release(FrameBuffer frameBuffer)
+{
+  static_cast<RenderTargetPool::Impl&>(GetBaseObject()).Release(frameBuffer);
+}
+
+uint32_t RenderTargetPool::GetPooledBytes() const
+{
+  return static_cast<const RenderTargetPool::Impl&>(GetBaseObject()).GetPooledBytes();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,130 @@
+#ifndef DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
+#define DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/rendering/frame-buffer.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief A singleton sharing the transient offscreen render targets of effects.
+ *
+ * A transient render target is only written and read by the render tasks of one effect, e.g. the
+ * input and the half-blurred images of a blur. Each effect reserves a sequence slot, which gives its
+ * render tasks a range of order indices of their own, so the tasks of two effects never interleave.
+ * An effect is then done with its transient targets before the next one starts, and all of them
+ * share one target per size bucket, format and use.
+ *
+ * When no effect uses a target anymore, it is kept for the next effect acquiring it, so that effects
+ * which are toggled or recreated don't reallocate their GPU memory. Only a few released targets are
+ * kept, the oldest ones are destroyed first.
+ */
+class RenderTargetPool : public BaseHandle
+{
+public:
+  /**
+   * @brief Create a RenderTargetPool handle.
+   *
+   * Calling member functions with an uninitialised handle is not allowed.
+   */
+  RenderTargetPool();
+
+  /**
+   * @brief Destructor
+   *
+   * This is non-virtual since derived Handle types must not contain data or virtual methods.
+   */
+  ~RenderTargetPool();
+
+  /**
+   * @brief Create or retrieve RenderTargetPool singleton.
+   *
+   * @return A handle to the RenderTargetPool, or an empty handle if there is no singleton service.
+   */
+  static RenderTargetPool Get();
+
+  /**
+   * @brief Reserves a sequence slot for the render tasks of an effect.
+   *
+   * @return The lowest free slot
+   */
+  uint32_t ReserveSequenceSlot();
+
+  /**
+   * @brief Frees a sequence slot reserved by an effect.
+   *
+   * @param[in] slot The slot
+   */
+  void FreeSequenceSlot(uint32_t slot);
+
+  /**
+   * @brief Acquires a transient render target, shared with the other effects using it the same way.
+   *
+   * The size is rounded up to a bucket, so effects of similar sizes share the target too.
+   * The effects draw their images over the whole target, whatever its size.
+   *
+   * @param[in] width The width of the target
+   * @param[in] height The height of the target
+   * @param[in] format The pixel format of the color attachment
+   * @param[in] use Tells apart the targets an effect uses at the same time, e.g. its input and its half-blurred image
+   * @return The render target, with a color texture and no depth or stencil
+   */
+  FrameBuffer Acquire(uint32_t width, uint32_t height, Pixel::Format format, uint32_t use);
+
+  /**
+   * @brief Releases a render target acquired from the pool. Once no effect uses it, it is kept for reuse.
+   *
+   * @param[in] frameBuffer The render target
+   */
+  void Release(FrameBuffer frameBuffer);
+
+  /**
+   * @brief Retrieves the GPU memory of the render targets in the pool.
+   *
+   * @return The size of the pooled color attachments in bytes, whether they are in use or kept for reuse
+   */
+  uint32_t GetPooledBytes() const;
+
+public:
+  // Default copy and move operator
+  RenderTargetPool(const RenderTargetPool& rhs) = default;
+  RenderTargetPool(RenderTargetPool&& rhs)      = default;
+  RenderTargetPool& operator=(const RenderTargetPool& rhs) = default;
+  RenderTargetPool& operator=(RenderTargetPool&& rhs) = default;
+
+private:
+  class Impl;
+
+  explicit DALI_INTERNAL RenderTargetPool(RenderTargetPool::Impl* impl);
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
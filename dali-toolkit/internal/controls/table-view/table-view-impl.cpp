@@ -46,6 +46,48 @@ bool FitToChild(Actor actor, Dimension::Type dimension)
   return actor.GetResizePolicy(dimension) != ResizePolicy::FILL_TO_PARENT && actor.GetRelayoutSize(dimension) > 0.0f;
 }
 
+/**
+ * Sets a property of a child only if its value is changed.
+ * Most of the cells don't move when the table is relaid out, so this avoids updating all the children every time.
+ */
+template<typename T>
+void SetChildProperty(Actor& actor, Property::Index index, const T& value)
+{
+  if(actor.GetProperty<T>(index) != value)
+  {
+    actor.SetProperty(index, value);
+  }
+}
+
+/**
+ * @brief Whether the property affects the size the child requires from its cell
+ *
+ * @param[in] index The index of the property
+ */
+bool IsChildSizeProperty(Property::Index index)
+{
+  switch(index)
+  {
+    case Actor::Property::SIZE:
+    case Actor::Property::SIZE_WIDTH:
+    case Actor::Property::SIZE_HEIGHT:
+    case Actor::Property::WIDTH_RESIZE_POLICY:
+    case Actor::Property::HEIGHT_RESIZE_POLICY:
+    case Actor::Property::SIZE_SCALE_POLICY:
+    case Actor::Property::SIZE_MODE_FACTOR:
+    case Actor::Property::PADDING:
+    case Actor::Property::MINIMUM_SIZE:
+    case Actor::Property::MAXIMUM_SIZE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
 #if defined(DEBUG_ENABLED)
 // debugging support, very useful when new features are added or bugs are hunted down
 // currently not called from code so compiler will optimize these away, kept here for future debugging
@@ -304,21 +346,43 @@ bool TableView::FindChildPosition(const Actor& child, Toolkit::TableView::CellPo
   // Only find valid child actors
   if(child)
   {
-    // Walk through the layout data
     const unsigned int rowCount    = mCellData.GetRows();
     const unsigned int columnCount = mCellData.GetColumns();
+    const uint32_t     childId     = child.GetProperty<int>(Actor::Property::ID);
 
+    // The cached position is only a hint, the cell data may have changed since it was stored
+    auto iter = mChildPositions.find(childId);
+    if(iter != mChildPositions.end())
+    {
+      const Toolkit::TableView::CellPosition& cached = iter->second;
+      if(cached.rowIndex < rowCount && cached.columnIndex < columnCount && mCellData[cached.rowIndex][cached.columnIndex].actor == child)
+      {
+        positionOut = mCellData[cached.rowIndex][cached.columnIndex].position;
+        return true;
+      }
+    }
+
+    // Walk through the layout data and cache the position of every child
+    mChildPositions.clear();
+    bool found = false;
     for(unsigned int row = 0; row < rowCount; ++row)
     {
       for(unsigned int column = 0; column < columnCount; ++column)
       {
-        if(mCellData[row][column].actor == child)
+        const CellData& cellData = mCellData[row][column];
+        if(cellData.actor)
         {
-          positionOut = mCellData[row][column].position;
-          return true;
+          // Spanned children are stored in every cell they cover, emplace keeps the first one
+          mChildPositions.emplace(cellData.actor.GetProperty<int>(Actor::Property::ID), Toolkit::TableView::CellPosition(row, column));
+          if(!found && cellData.actor == child)
+          {
+            positionOut = cellData.position;
+            found       = true;
+          }
         }
       }
     }
+    return found;
   }
 
   return false;
@@ -703,8 +767,17 @@ float TableView::GetRelativeWidth(unsigned int columnIndex) const
 
 void TableView::OnCalculateRelayoutSize(Dimension::Type dimension)
 {
-  if((dimension & Dimension::WIDTH) && mColumnDirty)
+  if((dimension & Dimension::WIDTH) && (mColumnDirty || mColumnSizesDirty))
   {
+    if(mColumnDirty)
+    {
+      // The columns or the cells have changed, so no cached FIT size can be used
+      for(auto&& element : mColumnData)
+      {
+        element.fitDirty = true;
+      }
+    }
+
     /*
      * FIXED and FIT have size in pixel
      * Nothing to do with FIXED, as its value is assigned by user and will not get changed
@@ -724,9 +797,16 @@ void TableView::OnCalculateRelayoutSize(Dimension::Type dimension)
     mFixedTotals.width = CalculateTotalFixedSize(mColumnData);
   }
 
-  if((dimension & Dimension::HEIGHT) && mRowDirty)
+  if((dimension & Dimension::HEIGHT) && (mRowDirty || mRowSizesDirty))
   {
     // refer to the comment above
+    if(mRowDirty)
+    {
+      for(auto&& element : mRowData)
+      {
+        element.fitDirty = true;
+      }
+    }
     CalculateFitSizes(mRowData, Dimension::HEIGHT);
 
     // refer to the comment above
@@ -739,7 +819,7 @@ void TableView::OnCalculateRelayoutSize(Dimension::Type dimension)
 void TableView::OnLayoutNegotiated(float size, Dimension::Type dimension)
 {
   // Update the column sizes
-  if((dimension & Dimension::WIDTH) && mColumnDirty)
+  if((dimension & Dimension::WIDTH) && (mColumnDirty || mColumnSizesDirty))
   {
     float remainingSize = size - mFixedTotals.width;
     if(remainingSize < 0.0f)
@@ -760,11 +840,12 @@ void TableView::OnLayoutNegotiated(float size, Dimension::Type dimension)
       element.position = cumulatedWidth;
     }
 
-    mColumnDirty = false;
+    mColumnDirty      = false;
+    mColumnSizesDirty = false;
   }
 
   // Update the row sizes
-  if((dimension & Dimension::HEIGHT) && mRowDirty)
+  if((dimension & Dimension::HEIGHT) && (mRowDirty || mRowSizesDirty))
   {
     float remainingSize = size - mFixedTotals.height;
     if(remainingSize < 0.0f)
@@ -785,7 +866,8 @@ void TableView::OnLayoutNegotiated(float size, Dimension::Type dimension)
       mRowData[row].position = cumulatedHeight;
     }
 
-    mRowDirty = false;
+    mRowDirty      = false;
+    mRowSizesDirty = false;
   }
 }
 
@@ -793,7 +875,8 @@ void TableView::OnSizeSet(const Vector3& size)
 {
   // If this table view is size negotiated by another actor or control, then the
   // rows and columns must be recalculated or the new size will not take effect.
-  mRowDirty = mColumnDirty = true;
+  // The FIT sizes only depend on the children, so they are kept.
+  mRowSizesDirty = mColumnSizesDirty = true;
   RelayoutRequest();
 
   Control::OnSizeSet(size);
@@ -830,9 +913,9 @@ void TableView::OnRelayout(const Vector2& size, RelayoutContainer& container)
         // Anchor actor to top left of the cell
         if(actor.GetProperty(Actor::Property::POSITION_USES_ANCHOR_POINT).Get<bool>())
         {
-          actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+          SetChildProperty(actor, Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
         }
-        actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+        SetChildProperty(actor, Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
 
         Padding padding = actor.GetProperty<Vector4>(Actor::Property::PADDING);
 
@@ -854,28 +937,28 @@ void TableView::OnRelayout(const Vector2& size, RelayoutContainer& container)
 
         if(cellData.horizontalAlignment == HorizontalAlignment::LEFT)
         {
-          actor.SetProperty(Actor::Property::POSITION_X, left + mPadding.width + padding.left);
+          SetChildProperty(actor, Actor::Property::POSITION_X, left + mPadding.width + padding.left);
         }
         else if(cellData.horizontalAlignment == HorizontalAlignment::RIGHT)
         {
-          actor.SetProperty(Actor::Property::POSITION_X, right - mPadding.width - padding.right - actor.GetRelayoutSize(Dimension::WIDTH));
+          SetChildProperty(actor, Actor::Property::POSITION_X, right - mPadding.width - padding.right - actor.GetRelayoutSize(Dimension::WIDTH));
         }
         else //if( cellData.horizontalAlignment ==  HorizontalAlignment::CENTER )
         {
-          actor.SetProperty(Actor::Property::POSITION_X, (left + right + padding.left - padding.right - actor.GetRelayoutSize(Dimension::WIDTH)) * 0.5f);
+          SetChildProperty(actor, Actor::Property::POSITION_X, (left + right + padding.left - padding.right - actor.GetRelayoutSize(Dimension::WIDTH)) * 0.5f);
         }
 
         if(cellData.verticalAlignment == VerticalAlignment::TOP)
         {
-          actor.SetProperty(Actor::Property::POSITION_Y, top + mPadding.height + padding.top);
+          SetChildProperty(actor, Actor::Property::POSITION_Y, top + mPadding.height + padding.top);
         }
         else if(cellData.verticalAlignment == VerticalAlignment::BOTTOM)
         {
-          actor.SetProperty(Actor::Property::POSITION_Y, bottom - mPadding.height - padding.bottom - actor.GetRelayoutSize(Dimension::HEIGHT));
+          SetChildProperty(actor, Actor::Property::POSITION_Y, bottom - mPadding.height - padding.bottom - actor.GetRelayoutSize(Dimension::HEIGHT));
         }
         else //if( cellData.verticalAlignment = VerticalAlignment::CENTER )
         {
-          actor.SetProperty(Actor::Property::POSITION_Y, (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize(Dimension::HEIGHT)) * 0.5f);
+          SetChildProperty(actor, Actor::Property::POSITION_Y, (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize(Dimension::HEIGHT)) * 0.5f);
         }
       }
     }
@@ -1082,6 +1165,10 @@ void TableView::OnChildAdd(Actor& child)
     }
   }
 
+  // Cell changes made by the table itself are already dirty, so only the changes of the child are tracked
+  child.PropertySetSignal().Connect(this, &TableView::OnChildPropertySet);
+  child.OnRelayoutSignal().Connect(this, &TableView::OnChildRelayout);
+
   Control::OnChildAdd(child);
 }
 
@@ -1097,16 +1184,68 @@ void TableView::OnChildRemove(Actor& child)
     }
   }
 
+  child.PropertySetSignal().Disconnect(this, &TableView::OnChildPropertySet);
+  child.OnRelayoutSignal().Disconnect(this, &TableView::OnChildRelayout);
+
   Control::OnChildRemove(child);
 }
 
+void TableView::MarkChildDirty(const Actor& child)
+{
+  Toolkit::TableView::CellPosition position;
+  if(FindChildPosition(child, position))
+  {
+    const unsigned int rowEnd    = std::min(position.rowIndex + position.rowSpan, static_cast<unsigned int>(mRowData.Size()));
+    const unsigned int columnEnd = std::min(position.columnIndex + position.columnSpan, static_cast<unsigned int>(mColumnData.Size()));
+    for(unsigned int row = position.rowIndex; row < rowEnd; ++row)
+    {
+      mRowData[row].fitDirty = true;
+    }
+    for(unsigned int column = position.columnIndex; column < columnEnd; ++column)
+    {
+      mColumnData[column].fitDirty = true;
+    }
+
+    mRowSizesDirty = mColumnSizesDirty = true;
+    RelayoutRequest();
+  }
+}
+
+void TableView::OnChildPropertySet(Handle& handle, Property::Index index, const Property::Value& value)
+{
+  if(IsChildSizeProperty(index))
+  {
+    MarkChildDirty(Actor::DownCast(handle));
+  }
+}
+
+void TableView::OnChildRelayout(Actor child)
+{
+  Toolkit::TableView::CellPosition position;
+  if(FindChildPosition(child, position))
+  {
+    // Only the children which a FIT row or column was calculated from are of interest
+    const CellData& cellData      = mCellData[position.rowIndex][position.columnIndex];
+    const bool      fitRow        = position.rowSpan == 1 && mRowData[position.rowIndex].sizePolicy == Toolkit::TableView::FIT && child.GetResizePolicy(Dimension::HEIGHT) != ResizePolicy::FILL_TO_PARENT;
+    const bool      fitColumn     = position.columnSpan == 1 && mColumnData[position.columnIndex].sizePolicy == Toolkit::TableView::FIT && child.GetResizePolicy(Dimension::WIDTH) != ResizePolicy::FILL_TO_PARENT;
+    const bool      heightChanged = fitRow && child.GetRelayoutSize(Dimension::HEIGHT) != cellData.relayoutSize.height;
+    const bool      widthChanged  = fitColumn && child.GetRelayoutSize(Dimension::WIDTH) != cellData.relayoutSize.width;
+    if(heightChanged || widthChanged)
+    {
+      MarkChildDirty(child);
+    }
+  }
+}
+
 TableView::TableView(unsigned int initialRows, unsigned int initialColumns)
 : Control(ControlBehaviour(CONTROL_BEHAVIOUR_DEFAULT)),
   mCellData(initialRows, initialColumns),
   mPreviousFocusedActor(),
   mLayoutingChild(false),
   mRowDirty(true), // Force recalculation first time
-  mColumnDirty(true)
+  mColumnDirty(true),
+  mRowSizesDirty(true),
+  mColumnSizesDirty(true)
 {
   SetKeyboardNavigationSupport(true);
   ResizeContainers(initialRows, initialColumns);
@@ -1680,7 +1819,7 @@ void TableView::CalculateFitSizes(RowColumnArray& data, Dimension::Type dimensio
   {
     RowColumnData& dataInstance = data[i];
 
-    if(dataInstance.sizePolicy == Toolkit::TableView::FIT)
+    if(dataInstance.sizePolicy == Toolkit::TableView::FIT && dataInstance.fitDirty)
     {
       // Find the size of the biggest actor in the row or column
       float maxActorHeight = 0.0f;
@@ -1694,10 +1833,20 @@ void TableView::CalculateFitSizes(RowColumnArray& data, Dimension::Type dimensio
         DALI_ASSERT_DEBUG(row < mCellData.GetRows());
         DALI_ASSERT_DEBUG(column < mCellData.GetColumns());
 
-        const CellData& cellData = mCellData[row][column];
-        const Actor&    actor    = cellData.actor;
+        CellData&    cellData = mCellData[row][column];
+        const Actor& actor    = cellData.actor;
         if(actor)
         {
+          // Remember the size the calculation was based on, so a later change can be detected
+          if(dimension == Dimension::WIDTH)
+          {
+            cellData.relayoutSize.width = actor.GetRelayoutSize(dimension);
+          }
+          else
+          {
+            cellData.relayoutSize.height = actor.GetRelayoutSize(dimension);
+          }
+
           if(FitToChild(actor, dimension) && (dimension == Dimension::WIDTH) ? (cellData.position.columnSpan == 1) : (cellData.position.rowSpan == 1))
           {
             maxActorHeight = std::max(maxActorHeight, actor.GetRelayoutSize(dimension) + cellPadding.x + cellPadding.y);
@@ -1705,7 +1854,8 @@ void TableView::CalculateFitSizes(RowColumnArray& data, Dimension::Type dimensio
         }
       }
 
-      dataInstance.size = maxActorHeight;
+      dataInstance.size     = maxActorHeight;
+      dataInstance.fitDirty = false;
     }
   }
 }
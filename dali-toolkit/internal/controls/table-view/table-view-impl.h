@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/object/weak-handle.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
@@ -280,7 +281,8 @@ private: // Implementation
     : size(0.0f),
       fillRatio(0.0f),
       position(0.0f),
-      sizePolicy(Toolkit::TableView::FILL)
+      sizePolicy(Toolkit::TableView::FILL),
+      fitDirty(true)
     {
     }
 
@@ -294,7 +296,8 @@ private: // Implementation
     : size(newSize),
       fillRatio(newFillRatio),
       position(0.0f),
-      sizePolicy(newSizePolicy)
+      sizePolicy(newSizePolicy),
+      fitDirty(true)
     {
     }
 
@@ -302,6 +305,7 @@ private: // Implementation
     float                            fillRatio;  ///< Ratio to fill remaining space, only valid with RELATIVE or FILL policy
     float                            position;   ///< Position of the row/column, this value is updated during every Relayout round
     Toolkit::TableView::LayoutPolicy sizePolicy; ///< The size policy used to interpret the size value
+    bool                             fitDirty;   ///< Whether the size of a FIT row/column must be calculated again from its children
   };
 
   typedef Dali::Vector<RowColumnData> RowColumnArray;
@@ -314,7 +318,8 @@ public:
   {
     CellData()
     : horizontalAlignment(HorizontalAlignment::LEFT),
-      verticalAlignment(VerticalAlignment::TOP)
+      verticalAlignment(VerticalAlignment::TOP),
+      relayoutSize()
     {
     }
 
@@ -323,6 +328,7 @@ public:
     Toolkit::TableView::CellPosition position;
     HorizontalAlignment::Type        horizontalAlignment;
     VerticalAlignment::Type          verticalAlignment;
+    Vector2                          relayoutSize; ///< The relayout size of the actor when the FIT sizes were last calculated
   };
 
 private:
@@ -380,11 +386,40 @@ private:
   /**
    * @brief Calculate the sizes of FIT rows/columns
    *
+   * Only the rows/columns whose fitDirty flag is set are calculated, the others keep their cached size.
+   *
    * @param[in] data The row or column data to process
    * @param[in] dimension The dimension being calculated: row == Dimension::HEIGHT, column == Dimension::WIDTH
    */
   void CalculateFitSizes(RowColumnArray& data, Dimension::Type dimension);
 
+  /**
+   * @brief Marks the rows and columns spanned by the child, so their FIT sizes are calculated again on the next relayout
+   *
+   * @param[in] child The child whose size requirement has changed
+   */
+  void MarkChildDirty(const Actor& child);
+
+  /**
+   * @brief Called when a property of a child is set
+   *
+   * Invalidates the cached FIT sizes of the child's rows and columns if the property affects its size.
+   *
+   * @param[in] handle The child whose property was set
+   * @param[in] index The index of the property
+   * @param[in] value The new value of the property
+   */
+  void OnChildPropertySet(Handle& handle, Property::Index index, const Property::Value& value);
+
+  /**
+   * @brief Called when a child is relaid out
+   *
+   * Invalidates the cached FIT sizes of the child's rows and columns if its size changed without a property being set, e.g. its natural size.
+   *
+   * @param[in] child The child which was relaid out
+   */
+  void OnChildRelayout(Actor child);
+
   /**
    * @brief Search for a FIT cell in the array
    *
@@ -487,10 +522,14 @@ private:                       // Data
 
   Size mPadding; ///< Padding to apply to each cell
 
+  std::unordered_map<uint32_t, Toolkit::TableView::CellPosition> mChildPositions; ///< Cell positions of the children by actor id, checked against mCellData before use
+
   WeakHandle<Actor> mPreviousFocusedActor; ///< Perviously focused actor
   bool              mLayoutingChild;       ///< Can't be a bitfield due to Relayouting lock
   bool              mRowDirty : 1;         ///< Flag to indicate the row data is dirty
   bool              mColumnDirty : 1;      ///< Flag to indicate the column data is dirty
+  bool              mRowSizesDirty : 1;    ///< Flag to indicate the row sizes must be updated, only the FIT rows marked dirty are calculated again
+  bool              mColumnSizesDirty : 1; ///< Flag to indicate the column sizes must be updated, only the FIT columns marked dirty are calculated again
 };
 
 } // namespace Internal
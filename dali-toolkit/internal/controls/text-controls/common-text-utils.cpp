@@ -25,6 +25,7 @@
 #include <dali-toolkit/internal/controls/text-controls/common-text-utils.h>
 #include <dali-toolkit/internal/text/character-set-conversion.h>
 #include <dali-toolkit/internal/text/hidden-text.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 #include <dali-toolkit/internal/text/text-view.h>
 
 namespace Dali::Toolkit::Internal
@@ -68,6 +69,8 @@ void CommonTextUtils::RenderText(
   {
     if(renderer)
     {
+      Text::ProfilerScope profilerScope(Text::TextProfiler::Stage::TYPESETTING, &controller->GetProfilerStatistics());
+
       newRenderableActor = renderer->Render(controller->GetView(),
                                             textActor,
                                             Property::INVALID_INDEX, // Animatable property not supported
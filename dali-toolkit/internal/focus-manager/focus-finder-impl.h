@@ -0,0 +1,86 @@
+#ifndef DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_IMPL_H
+#define DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_IMPL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace FocusFinder
+{
+/**
+ * Rects passed to these functions are in left, right, bottom, top coordinates, as returned by GetScreenRect().
+ */
+
+/**
+ * Is candidateRect a better candidate than bestCandidateRect for the next focus given the direction?
+ * @param[in] direction The direction (up, down, left, right)
+ * @param[in] focusedRect The rect of the focused actor
+ * @param[in] candidateRect The candidate rect
+ * @param[in] bestCandidateRect The current best candidate rect
+ * @return Whether candidateRect is better.
+ */
+bool IsBetterCandidate(Toolkit::Control::KeyboardFocus::Direction direction, Rect<float>& focusedRect, Rect<float>& candidateRect, Rect<float>& bestCandidateRect);
+
+/**
+ * Whether the actor can get the keyboard focus.
+ * @param[in] actor The actor
+ * @return True if the actor is focusable, visible and not transparent.
+ */
+bool IsFocusable(Actor& actor);
+
+/**
+ * Does candidateRect overlap the beam of focusedRect in the given direction?
+ * @param[in] direction The direction (up, down, left, right)
+ * @param[in] focusedRect The rect of the focused actor
+ * @param[in] candidateRect The candidate rect
+ * @return Whether the rect is in the beam.
+ */
+bool IsInBeam(Toolkit::Control::KeyboardFocus::Direction direction, const Rect<float>& focusedRect, const Rect<float>& candidateRect);
+
+/**
+ * Calculate the distance that candidates compare, when neither of them is favoured by the beam.
+ * It is never less than 13 times the square of the distance along the direction.
+ * @param[in] direction The direction (up, down, left, right)
+ * @param[in] focusedRect The rect of the focused actor
+ * @param[in] candidateRect The candidate rect
+ * @return The distance
+ */
+uint64_t GetWeightedDistance(Toolkit::Control::KeyboardFocus::Direction direction, const Rect<float>& focusedRect, const Rect<float>& candidateRect);
+
+/**
+ * Calculate the current screen rect of an actor.
+ * @param[in] actor The actor
+ * @return The rect in left, right, bottom, top coordinates.
+ */
+Rect<float> GetScreenRect(Actor actor);
+
+} // namespace FocusFinder
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_FOCUS_FINDER_IMPL_H
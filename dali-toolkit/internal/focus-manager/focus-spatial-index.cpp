@@ -0,0 +1,792 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/focus-manager/focus-spatial-index.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/actors/actor-devel.h>
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/focus-manager/focus-finder-impl.h>
+#include <dali-toolkit/public-api/controls/scrollable/scrollable.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+constexpr float   MINIMUM_CELL_SIZE  = 16.0f; ///< Cells are never smaller than this, in pixels
+constexpr int32_t MAXIMUM_GRID_LINES = 256;   ///< Cells get larger rather than having more columns or rows than this
+
+uint32_t GetActorId(Actor actor)
+{
+  return static_cast<uint32_t>(actor.GetProperty<int32_t>(Actor::Property::ID));
+}
+
+/**
+ * Get whether setting a property moves the screen rect of the actor and of its subtree.
+ */
+bool IsGeometryProperty(Property::Index index)
+{
+  // The parent origin, anchor point, size and position properties, with their components, are in a row.
+  return (index >= Actor::Property::PARENT_ORIGIN && index <= Actor::Property::POSITION_Z) ||
+         index == Actor::Property::ORIENTATION ||
+         (index >= Actor::Property::SCALE && index <= Actor::Property::SCALE_Z);
+}
+
+/**
+ * Get whether FocusFinder visits an actor before another one, to break ties the same way.
+ * FocusFinder visits an actor before its children, and the children from the last to the first.
+ */
+bool IsVisitedBefore(Actor first, Actor second)
+{
+  std::vector<Actor> firstPath;
+  for(Actor actor = first; actor; actor = actor.GetParent())
+  {
+    firstPath.push_back(actor);
+  }
+  std::vector<Actor> secondPath;
+  for(Actor actor = second; actor; actor = actor.GetParent())
+  {
+    secondPath.push_back(actor);
+  }
+
+  // Walk down from the top until the paths split
+  auto firstIter  = firstPath.rbegin();
+  auto secondIter = secondPath.rbegin();
+  if(*firstIter != *secondIter)
+  {
+    return false;
+  }
+  while(firstIter != firstPath.rend() && secondIter != secondPath.rend() && *firstIter == *secondIter)
+  {
+    ++firstIter;
+    ++secondIter;
+  }
+
+  if(firstIter == firstPath.rend() || secondIter == secondPath.rend())
+  {
+    // One is an ancestor of the other
+    return firstIter == firstPath.rend();
+  }
+
+  Actor parent = firstIter->GetParent();
+  for(auto i = parent.GetChildCount(); i > 0u; --i)
+  {
+    Actor child = parent.GetChildAt(i - 1);
+    if(child == *firstIter || child == *secondIter)
+    {
+      return child == *firstIter;
+    }
+  }
+  return false;
+}
+} // namespace
+
+FocusSpatialIndex::FocusSpatialIndex()
+: mRootActor(),
+  mEntries(),
+  mFreeEntries(),
+  mEntryIndices(),
+  mCells(),
+  mChangedSubtrees(),
+  mMovedEntries(),
+  mOriginX(0.0f),
+  mOriginY(0.0f),
+  mCellSize(MINIMUM_CELL_SIZE),
+  mColumns(0),
+  mRows(0),
+  mVisitStamp(0u),
+  mBuilt(false),
+  mGridDirty(false),
+  mAllMoved(false)
+{
+}
+
+FocusSpatialIndex::~FocusSpatialIndex()
+{
+  Clear();
+}
+
+Actor FocusSpatialIndex::GetNearestFocusableActor(Actor rootActor, Actor focusedActor, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  Actor nearestActor;
+  if(!rootActor)
+  {
+    return nearestActor;
+  }
+
+  if(mRootActor.GetHandle() != rootActor)
+  {
+    Clear();
+  }
+
+  if(mBuilt)
+  {
+    ApplyChanges();
+  }
+
+  if(!mBuilt)
+  {
+    mRootActor = rootActor;
+    rootActor.PropertySetSignal().Connect(this, &FocusSpatialIndex::OnPropertySet);
+    AddChildren(rootActor);
+    BuildGrid();
+    mBuilt = true;
+  }
+
+  Rect<float> focusedRect;
+  if(!focusedActor)
+  {
+    // If there is no currently focused actor, it is searched based on the upper left corner of the current window.
+    Rect<float> rootRect = FocusFinder::GetScreenRect(rootActor);
+    focusedRect          = Rect<float>(rootRect.left, rootRect.left, rootRect.top, rootRect.top);
+  }
+  else
+  {
+    focusedRect = FocusFinder::GetScreenRect(focusedActor);
+  }
+
+  // Each round measures at least one moved candidate again, so there are at most as many rounds as entries.
+  int32_t bestEntry = -1;
+  for(std::size_t round = 0u; round <= mEntries.size(); ++round)
+  {
+    bestEntry = FindBestEntry(focusedActor, focusedRect, direction);
+    if(mMovedEntries.empty())
+    {
+      break;
+    }
+    ApplyMoves();
+  }
+
+  if(bestEntry >= 0)
+  {
+    nearestActor = mEntries[bestEntry].actor.GetHandle();
+  }
+  return nearestActor;
+}
+
+void FocusSpatialIndex::Clear()
+{
+  DisconnectAll();
+  mRootActor.Reset();
+  mEntries.clear();
+  mFreeEntries.clear();
+  mEntryIndices.clear();
+  mCells.clear();
+  mChangedSubtrees.clear();
+  mMovedEntries.clear();
+  mColumns   = 0;
+  mRows      = 0;
+  mBuilt     = false;
+  mGridDirty = false;
+  mAllMoved  = false;
+}
+
+void FocusSpatialIndex::AddActor(Actor actor)
+{
+  actor.PropertySetSignal().Connect(this, &FocusSpatialIndex::OnPropertySet);
+
+  // Scrolling moves the children without setting their properties
+  Toolkit::Scrollable scrollable = Toolkit::Scrollable::DownCast(actor);
+  if(scrollable)
+  {
+    scrollable.ScrollUpdatedSignal().Connect(this, &FocusSpatialIndex::OnScrollUpdated);
+  }
+
+  if(actor.GetProperty<bool>(Actor::Property::KEYBOARD_FOCUSABLE))
+  {
+    AddEntry(actor);
+  }
+  AddChildren(actor);
+}
+
+void FocusSpatialIndex::AddChildren(Actor actor)
+{
+  if(actor.GetProperty<bool>(Actor::Property::VISIBLE) && actor.GetProperty<bool>(DevelActor::Property::KEYBOARD_FOCUSABLE_CHILDREN))
+  {
+    DevelActor::ChildAddedSignal(actor).Connect(this, &FocusSpatialIndex::OnChildAdded);
+    DevelActor::ChildRemovedSignal(actor).Connect(this, &FocusSpatialIndex::OnChildRemoved);
+
+    const auto childCount = actor.GetChildCount();
+    for(auto i = childCount; i > 0u; --i)
+    {
+      Actor child = actor.GetChildAt(i - 1);
+      if(child)
+      {
+        AddActor(child);
+      }
+    }
+  }
+}
+
+void FocusSpatialIndex::RemoveActor(Actor actor)
+{
+  actor.PropertySetSignal().Disconnect(this, &FocusSpatialIndex::OnPropertySet);
+  Toolkit::Scrollable scrollable = Toolkit::Scrollable::DownCast(actor);
+  if(scrollable)
+  {
+    scrollable.ScrollUpdatedSignal().Disconnect(this, &FocusSpatialIndex::OnScrollUpdated);
+  }
+  DevelActor::ChildAddedSignal(actor).Disconnect(this, &FocusSpatialIndex::OnChildAdded);
+  DevelActor::ChildRemovedSignal(actor).Disconnect(this, &FocusSpatialIndex::OnChildRemoved);
+
+  auto iter = mEntryIndices.find(GetActorId(actor));
+  if(iter != mEntryIndices.end())
+  {
+    RemoveEntry(iter->second);
+  }
+
+  const auto childCount = actor.GetChildCount();
+  for(auto i = 0u; i < childCount; ++i)
+  {
+    Actor child = actor.GetChildAt(i);
+    if(child)
+    {
+      RemoveActor(child);
+    }
+  }
+}
+
+void FocusSpatialIndex::AddEntry(Actor actor)
+{
+  const uint32_t actorId = GetActorId(actor);
+  if(mEntryIndices.find(actorId) != mEntryIndices.end())
+  {
+    return;
+  }
+
+  uint32_t index = static_cast<uint32_t>(mEntries.size());
+  if(!mFreeEntries.empty())
+  {
+    index = mFreeEntries.back();
+    mFreeEntries.pop_back();
+  }
+  else
+  {
+    mEntries.emplace_back();
+  }
+
+  Entry& entry      = mEntries[index];
+  entry.actor       = WeakHandle<Actor>(actor);
+  entry.actorId     = actorId;
+  entry.rect        = FocusFinder::GetScreenRect(actor);
+  entry.firstColumn = -1;
+  entry.visitStamp  = 0u;
+  entry.used        = true;
+  entry.moved       = false;
+
+  actor.OnRelayoutSignal().Connect(this, &FocusSpatialIndex::OnRelayout);
+
+  mEntryIndices[actorId] = index;
+  InsertIntoCells(index);
+}
+
+void FocusSpatialIndex::RemoveEntry(uint32_t index)
+{
+  Entry& entry = mEntries[index];
+  RemoveFromCells(index);
+
+  Actor actor = entry.actor.GetHandle();
+  if(actor)
+  {
+    actor.OnRelayoutSignal().Disconnect(this, &FocusSpatialIndex::OnRelayout);
+  }
+
+  mEntryIndices.erase(entry.actorId);
+  entry.actor.Reset();
+  entry.used  = false;
+  entry.moved = false;
+  mFreeEntries.push_back(index);
+}
+
+void FocusSpatialIndex::UpdateEntry(uint32_t index)
+{
+  Entry& entry = mEntries[index];
+  entry.moved  = false;
+
+  Actor actor = entry.actor.GetHandle();
+  if(!actor)
+  {
+    return;
+  }
+
+  Rect<float> rect = FocusFinder::GetScreenRect(actor);
+  if(rect != entry.rect)
+  {
+    RemoveFromCells(index);
+    entry.rect = rect;
+    InsertIntoCells(index);
+  }
+}
+
+void FocusSpatialIndex::InsertIntoCells(uint32_t index)
+{
+  Entry& entry = mEntries[index];
+  if(mColumns == 0 || mRows == 0)
+  {
+    mGridDirty = true;
+    return;
+  }
+
+  // An entry out of the grid goes to the cells at its edge, which keeps the queries right, but the grid grows on the next query.
+  const Rect<float>& rect = entry.rect;
+  if(rect.left < mOriginX || rect.top < mOriginY || rect.right >= mOriginX + mColumns * mCellSize || rect.bottom >= mOriginY + mRows * mCellSize)
+  {
+    mGridDirty = true;
+  }
+
+  auto getLine = [this](float position, float origin, int32_t count) {
+    return std::clamp(static_cast<int32_t>(std::floor((position - origin) / mCellSize)), 0, count - 1);
+  };
+
+  entry.firstColumn = getLine(rect.left, mOriginX, mColumns);
+  entry.lastColumn  = getLine(rect.right, mOriginX, mColumns);
+  entry.firstRow    = getLine(rect.top, mOriginY, mRows);
+  entry.lastRow     = getLine(rect.bottom, mOriginY, mRows);
+  for(int32_t row = entry.firstRow; row <= entry.lastRow; ++row)
+  {
+    for(int32_t column = entry.firstColumn; column <= entry.lastColumn; ++column)
+    {
+      mCells[row * mColumns + column].push_back(index);
+    }
+  }
+}
+
+void FocusSpatialIndex::RemoveFromCells(uint32_t index)
+{
+  Entry& entry = mEntries[index];
+  if(mColumns == 0 || mRows == 0 || entry.firstColumn < 0)
+  {
+    return;
+  }
+
+  for(int32_t row = entry.firstRow; row <= entry.lastRow; ++row)
+  {
+    for(int32_t column = entry.firstColumn; column <= entry.lastColumn; ++column)
+    {
+      auto& cell = mCells[row * mColumns + column];
+      auto  iter = std::find(cell.begin(), cell.end(), index);
+      if(iter != cell.end())
+      {
+        *iter = cell.back();
+        cell.pop_back();
+      }
+    }
+  }
+  entry.firstColumn = -1;
+}
+
+void FocusSpatialIndex::ApplyChanges()
+{
+  Actor rootActor = mRootActor.GetHandle();
+  if(!mChangedSubtrees.empty())
+  {
+    std::vector<Actor>           changedActors;
+    std::unordered_set<uint32_t> changedIds;
+    for(auto& weakActor : mChangedSubtrees)
+    {
+      Actor actor = weakActor.GetHandle();
+      if(actor && changedIds.insert(GetActorId(actor)).second)
+      {
+        changedActors.push_back(actor);
+      }
+    }
+    mChangedSubtrees.clear();
+
+    for(auto& actor : changedActors)
+    {
+      if(actor == rootActor)
+      {
+        // Everything may have changed
+        Clear();
+        return;
+      }
+
+      // The subtree of a changed ancestor is visited again anyway
+      bool ancestorChanged = false;
+      for(Actor parent = actor.GetParent(); parent && !ancestorChanged; parent = parent.GetParent())
+      {
+        ancestorChanged = changedIds.find(GetActorId(parent)) != changedIds.end();
+      }
+      if(ancestorChanged)
+      {
+        continue;
+      }
+
+      RemoveActor(actor);
+      Actor parent = actor.GetParent();
+      if(parent && AreChildrenVisited(parent))
+      {
+        AddActor(actor);
+      }
+    }
+  }
+
+  if(mAllMoved)
+  {
+    mAllMoved = false;
+    for(uint32_t index = 0u; index < mEntries.size(); ++index)
+    {
+      if(mEntries[index].used)
+      {
+        UpdateEntry(index);
+      }
+    }
+  }
+
+  ApplyMoves();
+}
+
+void FocusSpatialIndex::ApplyMoves()
+{
+  for(uint32_t index : mMovedEntries)
+  {
+    if(mEntries[index].used && mEntries[index].moved)
+    {
+      UpdateEntry(index);
+    }
+  }
+  mMovedEntries.clear();
+
+  if(mGridDirty)
+  {
+    BuildGrid();
+  }
+}
+
+bool FocusSpatialIndex::AreChildrenVisited(Actor actor) const
+{
+  Actor rootActor = mRootActor.GetHandle();
+  for(; actor; actor = actor.GetParent())
+  {
+    if(!actor.GetProperty<bool>(Actor::Property::VISIBLE) || !actor.GetProperty<bool>(DevelActor::Property::KEYBOARD_FOCUSABLE_CHILDREN))
+    {
+      return false;
+    }
+    if(actor == rootActor)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FocusSpatialIndex::BuildGrid()
+{
+  mCells.clear();
+  mColumns   = 0;
+  mRows      = 0;
+  mGridDirty = false;
+
+  float    left      = 0.0f;
+  float    top       = 0.0f;
+  float    right     = 0.0f;
+  float    bottom    = 0.0f;
+  float    sizeTotal = 0.0f;
+  uint32_t count     = 0u;
+  for(auto& entry : mEntries)
+  {
+    entry.firstColumn = -1;
+    if(!entry.used)
+    {
+      continue;
+    }
+
+    left   = count ? std::min(left, entry.rect.left) : entry.rect.left;
+    top    = count ? std::min(top, entry.rect.top) : entry.rect.top;
+    right  = count ? std::max(right, entry.rect.right) : entry.rect.right;
+    bottom = count ? std::max(bottom, entry.rect.bottom) : entry.rect.bottom;
+    sizeTotal += std::max(entry.rect.right - entry.rect.left, entry.rect.bottom - entry.rect.top);
+    ++count;
+  }
+  if(count == 0u)
+  {
+    return;
+  }
+
+  // Cells about the size of an actor keep both the cells per actor and the actors per cell low
+  mCellSize = std::max({MINIMUM_CELL_SIZE, sizeTotal / count, (right - left) / MAXIMUM_GRID_LINES, (bottom - top) / MAXIMUM_GRID_LINES});
+  mOriginX  = left;
+  mOriginY  = top;
+  mColumns  = std::min(static_cast<int32_t>((right - left) / mCellSize) + 1, MAXIMUM_GRID_LINES);
+  mRows     = std::min(static_cast<int32_t>((bottom - top) / mCellSize) + 1, MAXIMUM_GRID_LINES);
+  mCells.resize(mColumns * mRows);
+
+  for(uint32_t index = 0u; index < mEntries.size(); ++index)
+  {
+    if(mEntries[index].used)
+    {
+      InsertIntoCells(index);
+    }
+  }
+
+  // An entry on the far edge may count as out of the grid, which doesn't need another build
+  mGridDirty = false;
+}
+
+int32_t FocusSpatialIndex::FindBestEntry(Actor focusedActor, Rect<float>& focusedRect, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  if(mColumns == 0 || mRows == 0)
+  {
+    return -1;
+  }
+
+  auto getColumn = [this](float x) { return std::clamp(static_cast<int32_t>(std::floor((x - mOriginX) / mCellSize)), 0, mColumns - 1); };
+  auto getRow    = [this](float y) { return std::clamp(static_cast<int32_t>(std::floor((y - mOriginY) / mCellSize)), 0, mRows - 1); };
+
+  // Walk the lines of cells away from the focused rect, starting from the line of its leading edge.
+  int32_t start = 0;
+  int32_t step  = 1;
+  switch(direction)
+  {
+    case Toolkit::Control::KeyboardFocus::LEFT:
+    {
+      start = getColumn(focusedRect.left);
+      step  = -1;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::RIGHT:
+    {
+      start = getColumn(focusedRect.right);
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::UP:
+    {
+      start = getRow(focusedRect.top);
+      step  = -1;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::DOWN:
+    {
+      start = getRow(focusedRect.bottom);
+      break;
+    }
+    default:
+    {
+      return -1;
+    }
+  }
+
+  // Any entry first met in a line is at least this far away along the direction
+  auto getLowerBound = [&](int32_t line) -> int64_t {
+    float distance = 0.0f;
+    if(line != start)
+    {
+      const float nearEdge = (step > 0 ? line : line + 1) * mCellSize;
+      switch(direction)
+      {
+        case Toolkit::Control::KeyboardFocus::LEFT:
+        {
+          distance = focusedRect.left - (mOriginX + nearEdge);
+          break;
+        }
+        case Toolkit::Control::KeyboardFocus::RIGHT:
+        {
+          distance = (mOriginX + nearEdge) - focusedRect.right;
+          break;
+        }
+        case Toolkit::Control::KeyboardFocus::UP:
+        {
+          distance = focusedRect.top - (mOriginY + nearEdge);
+          break;
+        }
+        default:
+        {
+          distance = (mOriginY + nearEdge) - focusedRect.bottom;
+          break;
+        }
+      }
+    }
+    return std::max(static_cast<int64_t>(distance), int64_t(0));
+  };
+
+  const bool    horizontal = (direction == Toolkit::Control::KeyboardFocus::LEFT || direction == Toolkit::Control::KeyboardFocus::RIGHT);
+  const int32_t lineCount  = horizontal ? mColumns : mRows;
+  const int32_t crossCount = horizontal ? mRows : mColumns;
+  const int32_t beamFirst  = horizontal ? getRow(focusedRect.top) : getColumn(focusedRect.left);
+  const int32_t beamLast   = horizontal ? getRow(focusedRect.bottom) : getColumn(focusedRect.right);
+
+  // Initialize the best candidate to something impossible, as FocusFinder does
+  Rect<float> impossibleRect = focusedRect;
+  switch(direction)
+  {
+    case Toolkit::Control::KeyboardFocus::LEFT:
+    {
+      impossibleRect.left += 1;
+      impossibleRect.right += 1;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::RIGHT:
+    {
+      impossibleRect.left -= 1;
+      impossibleRect.right -= 1;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::UP:
+    {
+      impossibleRect.top += 1;
+      impossibleRect.bottom += 1;
+      break;
+    }
+    default:
+    {
+      impossibleRect.top -= 1;
+      impossibleRect.bottom -= 1;
+      break;
+    }
+  }
+
+  int32_t  bestEntry    = -1;
+  Actor    bestActor;
+  bool     bestInBeam   = false;
+  uint64_t bestDistance = 0u;
+  ++mVisitStamp;
+
+  for(int32_t line = start; line >= 0 && line < lineCount; line += step)
+  {
+    // Once nothing in this line can be nearer than the best candidate, only an actor in the beam can still win,
+    // and not even that if the best candidate is in the beam already.
+    const int64_t lowerBound = getLowerBound(line);
+    const bool    tooFar     = bestEntry >= 0 && static_cast<uint64_t>(13 * lowerBound * lowerBound) > bestDistance;
+    if(tooFar && bestInBeam)
+    {
+      break;
+    }
+
+    const int32_t crossFirst = tooFar ? beamFirst : 0;
+    const int32_t crossLast  = tooFar ? beamLast : crossCount - 1;
+    for(int32_t cross = crossFirst; cross <= crossLast; ++cross)
+    {
+      const auto& cell = horizontal ? mCells[cross * mColumns + line] : mCells[line * mColumns + cross];
+      for(uint32_t index : cell)
+      {
+        Entry& entry = mEntries[index];
+        if(entry.visitStamp == mVisitStamp)
+        {
+          continue;
+        }
+        entry.visitStamp = mVisitStamp;
+
+        Actor actor = entry.actor.GetHandle();
+        if(!actor || actor == focusedActor || !FocusFinder::IsFocusable(actor))
+        {
+          continue;
+        }
+
+        // The moves which are not reported are found here. The candidate is compared in its new cells on the next round.
+        if(entry.moved || FocusFinder::GetScreenRect(actor) != entry.rect)
+        {
+          if(!entry.moved)
+          {
+            entry.moved = true;
+            mMovedEntries.push_back(index);
+          }
+          continue;
+        }
+
+        Rect<float>& bestRect = bestEntry >= 0 ? mEntries[bestEntry].rect : impossibleRect;
+        bool         better   = FocusFinder::IsBetterCandidate(direction, focusedRect, entry.rect, bestRect);
+
+        // FocusFinder keeps the first of equally good candidates
+        if(!better && bestEntry >= 0 && !FocusFinder::IsBetterCandidate(direction, focusedRect, bestRect, entry.rect) && FocusFinder::IsBetterCandidate(direction, focusedRect, entry.rect, impossibleRect))
+        {
+          better = IsVisitedBefore(actor, bestActor);
+        }
+
+        if(better)
+        {
+          bestEntry    = static_cast<int32_t>(index);
+          bestActor    = actor;
+          bestInBeam   = FocusFinder::IsInBeam(direction, focusedRect, entry.rect);
+          bestDistance = FocusFinder::GetWeightedDistance(direction, focusedRect, entry.rect);
+        }
+      }
+    }
+  }
+  return bestEntry;
+}
+
+void FocusSpatialIndex::MarkMoved(Actor actor)
+{
+  auto iter = mEntryIndices.find(GetActorId(actor));
+  if(iter != mEntryIndices.end() && !mEntries[iter->second].moved)
+  {
+    mEntries[iter->second].moved = true;
+    mMovedEntries.push_back(iter->second);
+  }
+}
+
+void FocusSpatialIndex::MarkSubtreeMoved(Actor actor)
+{
+  MarkMoved(actor);
+
+  const auto childCount = actor.GetChildCount();
+  for(auto i = 0u; i < childCount; ++i)
+  {
+    Actor child = actor.GetChildAt(i);
+    if(child)
+    {
+      MarkSubtreeMoved(child);
+    }
+  }
+}
+
+void FocusSpatialIndex::OnChildAdded(Actor child)
+{
+  mChangedSubtrees.push_back(WeakHandle<Actor>(child));
+}
+
+void FocusSpatialIndex::OnChildRemoved(Actor child)
+{
+  RemoveActor(child);
+}
+
+void FocusSpatialIndex::OnPropertySet(Handle& handle, Property::Index index, const Property::Value& value)
+{
+  if(index == Actor::Property::VISIBLE || index == Actor::Property::KEYBOARD_FOCUSABLE || index == DevelActor::Property::KEYBOARD_FOCUSABLE_CHILDREN)
+  {
+    mChangedSubtrees.push_back(WeakHandle<Actor>(Actor::DownCast(handle)));
+  }
+  else if(IsGeometryProperty(index) && !mAllMoved)
+  {
+    MarkSubtreeMoved(Actor::DownCast(handle));
+  }
+}
+
+void FocusSpatialIndex::OnRelayout(Actor actor)
+{
+  MarkMoved(actor);
+}
+
+void FocusSpatialIndex::OnScrollUpdated(const Vector2& position)
+{
+  mAllMoved = true;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
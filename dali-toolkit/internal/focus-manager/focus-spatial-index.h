@@ -0,0 +1,223 @@
+#ifndef DALI_TOOLKIT_INTERNAL_FOCUS_SPATIAL_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_FOCUS_SPATIAL_INDEX_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * A uniform grid of the screen rects of the focusable actors under a root, to find the nearest
+ * focusable actor without visiting and measuring every actor on each focus move.
+ *
+ * The grid holds the actors whose KEYBOARD_FOCUSABLE is set; the rest of the focusability is
+ * checked when a candidate is compared. It is built on the first query under a root, then kept up
+ * to date one actor at a time:
+ * - an added actor, or one whose VISIBLE, KEYBOARD_FOCUSABLE or KEYBOARD_FOCUSABLE_CHILDREN is set,
+ *   has its subtree visited again;
+ * - a removed actor has the entries of its subtree removed;
+ * - a focusable actor that is relaid out, or whose position, size, scale, orientation, anchor
+ *   point or parent origin is set, is measured again and moved to the cells of its new rect,
+ *   along with the focusable actors under it;
+ * - all the actors are measured again once a Scrollable under the root scrolls.
+ * The changes are applied on the next query. Moves that are not reported, e.g. by animations,
+ * are caught lazily: each candidate compared by a query is measured, and the query is repeated
+ * once the moved candidates are in their new cells.
+ *
+ * It finds the same actor as FocusFinder::GetNearestFocusableActor() would.
+ */
+class FocusSpatialIndex : public ConnectionTracker
+{
+public:
+  /**
+   * Constructor
+   */
+  FocusSpatialIndex();
+
+  /**
+   * Destructor
+   */
+  ~FocusSpatialIndex() override;
+
+  /**
+   * Get the nearest focusable actor.
+   * @param[in] rootActor The root actor.
+   * @param[in] focusedActor The current focused actor.
+   * @param[in] direction The direction.
+   * @return The nearest focusable actor, or an empty handle if none exists.
+   */
+  Actor GetNearestFocusableActor(Actor rootActor, Actor focusedActor, Toolkit::Control::KeyboardFocus::Direction direction);
+
+private:
+  struct Entry
+  {
+    WeakHandle<Actor> actor;
+    uint32_t          actorId;
+    Rect<float>       rect;        ///< In left, right, bottom, top coordinates
+    int32_t           firstColumn; ///< The cells the entry is in
+    int32_t           lastColumn;
+    int32_t           firstRow;
+    int32_t           lastRow;
+    uint32_t          visitStamp; ///< The last query that visited the entry, as it may be in several cells
+    bool              used;       ///< False if the entry is free
+    bool              moved;      ///< Whether the actor has moved since the last query
+  };
+
+  /**
+   * Remove all the entries and disconnect from all the actors.
+   */
+  void Clear();
+
+  /**
+   * Visit an actor and its subtree as FocusFinder does, adding the focusable actors.
+   * @param[in] actor The actor
+   */
+  void AddActor(Actor actor);
+
+  /**
+   * Visit the children of an actor as FocusFinder does, adding the focusable actors.
+   * @param[in] actor The actor whose children are visited
+   */
+  void AddChildren(Actor actor);
+
+  /**
+   * Remove the entries of an actor and its subtree and disconnect from them.
+   * @param[in] actor The actor
+   */
+  void RemoveActor(Actor actor);
+
+  /**
+   * Add the entry of a focusable actor.
+   * @param[in] actor The actor
+   */
+  void AddEntry(Actor actor);
+
+  /**
+   * Remove an entry.
+   * @param[in] index The index of the entry
+   */
+  void RemoveEntry(uint32_t index);
+
+  /**
+   * Measure the actor of an entry again and move it to the cells of its rect.
+   * @param[in] index The index of the entry
+   */
+  void UpdateEntry(uint32_t index);
+
+  /**
+   * Add an entry to the cells of its rect.
+   * @param[in] index The index of the entry
+   */
+  void InsertIntoCells(uint32_t index);
+
+  /**
+   * Remove an entry from its cells.
+   * @param[in] index The index of the entry
+   */
+  void RemoveFromCells(uint32_t index);
+
+  /**
+   * Apply the changes reported since the last query.
+   */
+  void ApplyChanges();
+
+  /**
+   * Measure the moved entries again.
+   */
+  void ApplyMoves();
+
+  /**
+   * Get whether FocusFinder visits the children of an actor and all its ancestors up to the root.
+   * @param[in] actor The actor
+   * @return True if the children are visited.
+   */
+  bool AreChildrenVisited(Actor actor) const;
+
+  /**
+   * Build the grid from the entries.
+   */
+  void BuildGrid();
+
+  /**
+   * Find the best candidate in the grid.
+   *
+   * The candidates found to have moved are skipped and marked to be measured again.
+   * @param[in] focusedActor The current focused actor.
+   * @param[in] focusedRect The rect of the focused actor
+   * @param[in] direction The direction.
+   * @return The index of the best entry, or -1 if none exists.
+   */
+  int32_t FindBestEntry(Actor focusedActor, Rect<float>& focusedRect, Toolkit::Control::KeyboardFocus::Direction direction);
+
+  /**
+   * Mark the entry of an actor to be measured again on the next query.
+   * @param[in] actor The actor
+   */
+  void MarkMoved(Actor actor);
+
+  /**
+   * Mark the entries of an actor and its subtree to be measured again on the next query.
+   * @param[in] actor The actor
+   */
+  void MarkSubtreeMoved(Actor actor);
+
+  void OnChildAdded(Actor child);
+  void OnChildRemoved(Actor child);
+  void OnPropertySet(Handle& handle, Property::Index index, const Property::Value& value);
+  void OnRelayout(Actor actor);
+  void OnScrollUpdated(const Vector2& position);
+
+private:
+  WeakHandle<Actor>                      mRootActor;
+  std::vector<Entry>                     mEntries;
+  std::vector<uint32_t>                  mFreeEntries;  ///< Indices of the free entries, to reuse
+  std::unordered_map<uint32_t, uint32_t> mEntryIndices; ///< Entry indices by actor id
+  std::vector<std::vector<uint32_t>>     mCells;        ///< Entry indices, row by row
+  std::vector<WeakHandle<Actor>>         mChangedSubtrees; ///< Actors whose subtrees are visited again on the next query
+  std::vector<uint32_t>                  mMovedEntries;    ///< Entries measured again on the next query
+  float                                  mOriginX;
+  float                                  mOriginY;
+  float                                  mCellSize;
+  int32_t                                mColumns;
+  int32_t                                mRows;
+  uint32_t                               mVisitStamp;
+  bool                                   mBuilt;     ///< Whether the entries of the root are added
+  bool                                   mGridDirty; ///< Whether an entry is out of the grid, so that it needs to grow
+  bool                                   mAllMoved;  ///< Whether all the entries are measured again on the next query, as a Scrollable scrolled
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_FOCUS_SPATIAL_INDEX_H
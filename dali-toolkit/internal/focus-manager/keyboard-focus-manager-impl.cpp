@@ -120,6 +120,7 @@ KeyboardFocusManager::KeyboardFocusManager()
   mCurrentFocusActor(),
   mFocusIndicatorActor(),
   mFocusFinderRootActor(),
+  mFocusSpatialIndex(),
   mFocusHistory(),
   mSlotDelegate(this),
   mCustomAlgorithmInterface(NULL),
@@ -546,7 +547,14 @@ bool KeyboardFocusManager::MoveFocus(Toolkit::Control::KeyboardFocus::Direction
         if(rootActor)
         {
           // We should find it among the actors nearby.
-          nextFocusableActor = Toolkit::FocusFinder::GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          if(mFocusSpatialIndex)
+          {
+            nextFocusableActor = mFocusSpatialIndex->GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          }
+          else
+          {
+            nextFocusableActor = Toolkit::FocusFinder::GetNearestFocusableActor(rootActor, currentFocusActor, direction);
+          }
         }
       }
     }
@@ -1216,6 +1224,23 @@ void KeyboardFocusManager::ResetFocusFinderRootActor()
   mFocusFinderRootActor.Reset();
 }
 
+void KeyboardFocusManager::EnableFocusSpatialIndex(bool enable)
+{
+  if(!enable)
+  {
+    mFocusSpatialIndex.reset();
+  }
+  else if(!mFocusSpatialIndex)
+  {
+    mFocusSpatialIndex = std::make_unique<FocusSpatialIndex>();
+  }
+}
+
+bool KeyboardFocusManager::IsFocusSpatialIndexEnabled() const
+{
+  return mFocusSpatialIndex != nullptr;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -22,9 +22,11 @@
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/focus-manager/keyboard-focus-manager-devel.h>
+#include <dali-toolkit/internal/focus-manager/focus-spatial-index.h>
 #include <dali-toolkit/public-api/focus-manager/keyboard-focus-manager.h>
 #include <dali/devel-api/adaptor-framework/window-devel.h>
 
@@ -172,6 +174,16 @@ public:
    */
   void ResetFocusFinderRootActor();
 
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::EnableFocusSpatialIndex
+   */
+  void EnableFocusSpatialIndex(bool enable);
+
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::IsFocusSpatialIndexEnabled
+   */
+  bool IsFocusSpatialIndexEnabled() const;
+
 public:
   /**
    * @copydoc Toolkit::KeyboardFocusManager::PreFocusChangeSignal()
@@ -361,6 +373,8 @@ private:
 
   WeakHandle<Actor> mFocusFinderRootActor; ///<The root actor from which the focus finder is started.
 
+  std::unique_ptr<FocusSpatialIndex> mFocusSpatialIndex; ///< The index of focusable actors used by the default algorithm, if enabled
+
   FocusStack mFocusHistory; ///< Stack to contain pre-focused actor's BaseObject*
 
   SlotDelegate<KeyboardFocusManager> mSlotDelegate;
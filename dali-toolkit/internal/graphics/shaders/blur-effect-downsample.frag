@@ -0,0 +1,13 @@
+varying highp vec2 vTexCoord;
+uniform sampler2D sTexture;
+uniform highp vec2 uHalfPixel;
+
+void main()
+{
+  highp vec4 col = texture2D(sTexture, vTexCoord) * 4.0;
+  col += texture2D(sTexture, vTexCoord - uHalfPixel);
+  col += texture2D(sTexture, vTexCoord + uHalfPixel);
+  col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x, -uHalfPixel.y));
+  col += texture2D(sTexture, vTexCoord - vec2(uHalfPixel.x, -uHalfPixel.y));
+  gl_FragColor = col * 0.125;
+}
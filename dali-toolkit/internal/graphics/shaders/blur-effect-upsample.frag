@@ -0,0 +1,16 @@
+varying highp vec2 vTexCoord;
+uniform sampler2D sTexture;
+uniform highp vec2 uHalfPixel;
+
+void main()
+{
+  highp vec4 col = texture2D(sTexture, vTexCoord + vec2(-uHalfPixel.x * 2.0, 0.0));
+  col += texture2D(sTexture, vTexCoord + vec2(-uHalfPixel.x, uHalfPixel.y)) * 2.0;
+  col += texture2D(sTexture, vTexCoord + vec2(0.0, uHalfPixel.y * 2.0));
+  col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x, uHalfPixel.y)) * 2.0;
+  col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x * 2.0, 0.0));
+  col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x, -uHalfPixel.y)) * 2.0;
+  col += texture2D(sTexture, vTexCoord + vec2(0.0, -uHalfPixel.y * 2.0));
+  col += texture2D(sTexture, vTexCoord + vec2(-uHalfPixel.x, -uHalfPixel.y)) * 2.0;
+  gl_FragColor = col / 12.0;
+}
@@ -0,0 +1,8 @@
+varying lowp vec4 vColor;
+uniform lowp vec4 uColor;
+
+void main()
+{
+  // The children only inherit the alpha of the view.
+  gl_FragColor = vec4(vColor.rgb, vColor.a * uColor.a);
+}
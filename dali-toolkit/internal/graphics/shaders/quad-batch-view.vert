@@ -0,0 +1,10 @@
+attribute highp vec2 aPosition;
+attribute lowp vec4 aColor;
+varying lowp vec4 vColor;
+uniform highp mat4 uMvpMatrix;
+
+void main()
+{
+  gl_Position = uMvpMatrix * vec4(aPosition, 0.0, 1.0);
+  vColor = aColor;
+}
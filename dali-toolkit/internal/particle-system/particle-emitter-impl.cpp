@@ -28,6 +28,7 @@
 #include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/update/frame-callback-interface.h>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace Dali::Toolkit::ParticleSystem::Internal
@@ -212,32 +213,12 @@ void ParticleEmitter::Update()
   }
 
   // Update lifetimes and discard dead particles
-  auto& particles = mParticleList.GetActiveParticles();
-  auto  dt        = ms - mLastUpdateMs;
-  if(dt.count())
+  auto& list      = GetImplementation(mParticleList);
+  auto  deltaTime = float((ms - mLastUpdateMs).count()) / 1000.0f;
+  list.SetUpdateDeltaTime(deltaTime);
+  if(deltaTime > 0.0f && list.GetActiveParticleCount())
   {
-    std::vector<int> toErase;
-    int              n = 0;
-    for(auto& p : particles)
-    {
-      auto& lifetime = p.Get<float>(ParticleStream::LIFETIME_STREAM_BIT);
-      lifetime -= (float(dt.count()) / 1000.0f);
-      if(lifetime <= 0.0f)
-      {
-        toErase.emplace_back(n);
-      }
-      ++n;
-    }
-
-    if(!toErase.empty())
-    {
-      int indexShift = 0;
-      for(auto& v : toErase)
-      {
-        GetImplementation(mParticleList).ReleaseParticle(v - indexShift);
-        ++indexShift;
-      }
-    }
+    UpdateLifetimes(deltaTime);
   }
   mLastUpdateMs = ms;
 
@@ -259,24 +240,7 @@ void ParticleEmitter::Update()
     UpdateSource(emissionCount);
   }
 
-  // Update modifier stack
-  for(auto& modifier : mModifiers)
-  {
-    if(modifier)
-    {
-      // Parallel processing must be enabled in order to use MT mode
-      bool mt = GetImplementation(modifier).GetUpdater().IsMultiThreaded() && mParallelProcessing;
-
-      if(!mt) // single-threaded, update all particles in one go
-      {
-        GetImplementation(modifier).Update(mParticleList, 0, mParticleList.GetActiveParticleCount());
-      }
-      else
-      {
-        UpdateModifierMT(modifier);
-      }
-    }
-  }
+  UpdateModifiers();
 
   UpdateDomain();
 }
@@ -296,62 +260,126 @@ void ParticleEmitter::UpdateSource(uint32_t count)
   GetImplementation(mParticleSource).Update(mParticleList, count);
 }
 
-void ParticleEmitter::UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier)
+void ParticleEmitter::UpdateLifetimes(float deltaTime)
 {
-  auto& threadPool    = GetThreadPool();
-  auto  workerThreads = threadPool.GetWorkerCount();
-  auto  activeCount   = mParticleList.GetActiveParticleCount();
-
-  // at least 10 particles per worker thread (should be parametrized)
-  // If less, continue ST
-  if(activeCount < workerThreads * 10)
+  auto& list          = GetImplementation(mParticleList);
+  auto* lifetimes     = reinterpret_cast<float*>(list.GetDefaultStream(ParticleStream::LIFETIME_STREAM_BIT));
+  auto  particleCount = list.GetActiveParticleCount();
+  auto  rangeCount    = GetParallelRangeCount(particleCount);
+  if(!lifetimes)
   {
-    GetImplementation(modifier).Update(mParticleList, 0, activeCount);
     return;
   }
 
-  auto partial = mParticleList.GetActiveParticleCount() / workerThreads;
+  // Each range collects its own expired particles, in ascending order
+  mExpiredParticles.resize(rangeCount);
+  RunParallel(particleCount, rangeCount, [this, lifetimes, deltaTime](uint32_t range, uint32_t first, uint32_t count) {
+    auto& expired = mExpiredParticles[range];
+    expired.clear();
+    for(auto i = first; i < first + count; ++i)
+    {
+      lifetimes[i] -= deltaTime;
+      if(lifetimes[i] <= 0.0f)
+      {
+        expired.emplace_back(i);
+      }
+    }
+  });
 
-  // make tasks
-  struct UpdateTask
+  // Release from the back, so the last particle that is moved into each released slot is always alive
+  for(auto range = rangeCount; range-- > 0u;)
   {
-    UpdateTask(Internal::ParticleModifier& modifier, ParticleSystem::ParticleList& list, uint32_t first, uint32_t count)
-    : mModifier(modifier),
-      mList(list),
-      mFirst(first),
-      mCount(count)
+    auto& expired = mExpiredParticles[range];
+    for(auto iter = expired.rbegin(); iter != expired.rend(); ++iter)
     {
+      list.ReleaseParticle(*iter);
     }
+  }
+}
 
-    Internal::ParticleModifier&   mModifier;
-    ParticleSystem::ParticleList& mList;
-    uint32_t                      mFirst;
-    uint32_t                      mCount;
+void ParticleEmitter::UpdateModifiers()
+{
+  auto particleCount = mParticleList.GetActiveParticleCount();
+  auto rangeCount    = GetParallelRangeCount(particleCount);
+
+  auto isBuiltIn = [](const ParticleSystem::ParticleModifier& modifier) {
+    return modifier && GetImplementation(modifier).IsBuiltIn();
+  };
 
-    void Update()
+  for(auto i = 0u; i < mModifiers.size();)
+  {
+    if(!mModifiers[i])
     {
-      mModifier.Update(mList, mFirst, mCount);
+      ++i;
+      continue;
     }
-  };
 
-  std::vector<UpdateTask> updateTasks;
-  updateTasks.reserve(workerThreads);
-  std::vector<Task> tasks;
+    auto& modifier = GetImplementation(mModifiers[i]);
+    if(rangeCount <= 1u || !modifier.GetUpdater().IsMultiThreaded())
+    {
+      // single-threaded, update all particles in one go
+      modifier.Update(mParticleList, 0, particleCount);
+      ++i;
+      continue;
+    }
 
-  for(auto i = 0u; i < workerThreads; ++i)
-  {
-    auto index = i * partial;
-    auto count = partial;
-    if(i == workerThreads - 1 && index + count < activeCount)
+    // Adjacent built-in modifiers run in a single pass, each range of particles going through all of them.
+    // They only access their own range, so the order is preserved. Any other multi-threaded modifier may
+    // depend on the whole list being updated by the previous one, so it gets a pass of its own.
+    auto end = i + 1u;
+    if(modifier.IsBuiltIn())
     {
-      count = activeCount - index;
+      while(end < mModifiers.size() && isBuiltIn(mModifiers[end]))
+      {
+        ++end;
+      }
     }
 
-    updateTasks.emplace_back(GetImplementation(modifier), mParticleList, index, count);
-    tasks.emplace_back([&task = updateTasks.back()](uint32_t n) { task.Update(); });
+    RunParallel(particleCount, rangeCount, [this, begin = i, end](uint32_t range, uint32_t first, uint32_t count) {
+      for(auto m = begin; m < end; ++m)
+      {
+        GetImplementation(mModifiers[m]).Update(mParticleList, first, count);
+      }
+    });
+    i = end;
+  }
+}
+
+uint32_t ParticleEmitter::GetParallelRangeCount(uint32_t particleCount) const
+{
+  auto workerThreads = GetThreadPool().GetWorkerCount();
+
+  // at least 10 particles per worker thread (should be parametrized)
+  // If less, continue ST
+  if(!mParallelProcessing || particleCount < workerThreads * 10)
+  {
+    return 1u;
+  }
+  return workerThreads;
+}
+
+void ParticleEmitter::RunParallel(uint32_t particleCount, uint32_t rangeCount, const std::function<void(uint32_t, uint32_t, uint32_t)>& task)
+{
+  if(rangeCount <= 1u)
+  {
+    task(0u, 0u, particleCount);
+    return;
+  }
+
+  auto partial = particleCount / rangeCount;
+
+  std::vector<Task> tasks;
+  tasks.reserve(rangeCount);
+  for(auto i = 0u; i < rangeCount; ++i)
+  {
+    auto first = i * partial;
+
+    // make sure there's no leftover particles!
+    auto count = (i == rangeCount - 1) ? particleCount - first : partial;
+    tasks.emplace_back([&task, i, first, count](uint32_t n) { task(i, first, count); });
   }
 
-  auto future = threadPool.SubmitTasks(tasks, 0);
+  auto future = GetThreadPool().SubmitTasks(tasks, 0);
   future->Wait();
 }
 
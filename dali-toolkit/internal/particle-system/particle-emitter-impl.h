@@ -22,6 +22,7 @@
 #include <dali/public-api/object/base-object.h>
 #include <chrono>
 #include <ctime>
+#include <functional>
 #include <memory>
 
 // For multithreading update
@@ -93,7 +94,34 @@ public:
 
   void UpdateSource(uint32_t count);
 
-  void UpdateModifierMT(Dali::Toolkit::ParticleSystem::ParticleModifier& modifier);
+  /**
+   * @brief Decrements the lifetimes of the active particles and releases the expired ones
+   *
+   * @param[in] deltaTime Time elapsed since the last update in seconds
+   */
+  void UpdateLifetimes(float deltaTime);
+
+  /**
+   * @brief Runs the modifier stack on the active particles
+   */
+  void UpdateModifiers();
+
+  /**
+   * @brief Returns into how many ranges the particles should be split to be processed in parallel
+   *
+   * @param[in] particleCount Number of particles to process
+   * @return Number of ranges, 1 if the particles should be processed on the calling thread
+   */
+  [[nodiscard]] uint32_t GetParallelRangeCount(uint32_t particleCount) const;
+
+  /**
+   * @brief Runs the task on each range of particles in the thread pool and waits for all of them
+   *
+   * @param[in] particleCount Number of particles to process
+   * @param[in] rangeCount Number of ranges
+   * @param[in] task Task taking the range index, the first particle and the particle count
+   */
+  void RunParallel(uint32_t particleCount, uint32_t rangeCount, const std::function<void(uint32_t, uint32_t, uint32_t)>& task);
 
   void UpdateDomain();
 
@@ -157,6 +185,8 @@ public:
 
   bool                           mParallelProcessing{false};
   std::unique_ptr<FrameCallback> mFrameCallback;
+
+  std::vector<std::vector<uint32_t>> mExpiredParticles; ///< Expired particles of each range, reused between updates
 };
 
 } // namespace Dali::Toolkit::ParticleSystem::Internal
@@ -30,7 +30,11 @@ Particle::Particle(Internal::ParticleList& ownerList, uint32_t index)
 void* Particle::Get(ParticleStreamTypeFlagBit streamBit)
 {
   auto streamIndex = mOwnerList.GetDefaultStreamIndex(streamBit);
-  auto dataSize    = mOwnerList.GetStreamDataTypeSize(streamIndex);
+  if(streamIndex == ParticleList::INVALID_STREAM_INDEX)
+  {
+    return nullptr;
+  }
+  auto dataSize = mOwnerList.GetStreamDataTypeSize(streamIndex);
   return reinterpret_cast<uint8_t*>(mOwnerList.GetDefaultStream(streamBit)) + (mIndex * dataSize);
 }
 
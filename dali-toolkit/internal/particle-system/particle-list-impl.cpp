@@ -91,14 +91,7 @@ ParticleList::ParticleList(uint32_t capacity, ParticleSystem::ParticleList::Part
     mBuiltInStreamMap[uint32_t(ParticleStream::LIFETIME_BASE_STREAM_BIT)] = mDataStreams.size() - 1;
   }
 
-  // create free chain
-  mFreeChain.resize(capacity);
-  for(auto i = 0u; i < mFreeChain.size(); ++i)
-  {
-    mFreeChain[i] = i + 1;
-  }
-  mFreeChain[mFreeChain.size() - 1] = 0;
-  mFreeIndex                        = 0;
+  mParticleViews.resize(capacity);
 }
 
 ParticleList::~ParticleList() = default;
@@ -149,7 +142,7 @@ uint32_t ParticleList::GetParticleCount() const
 
 uint32_t ParticleList::GetActiveParticleCount() const
 {
-  return mParticles.size();
+  return mAliveParticleCount;
 }
 
 ParticleStream::StreamDataType ParticleList::GetStreamDataType(uint32_t streamIndex)
@@ -174,28 +167,35 @@ uint32_t ParticleList::GetStreamDataTypeSize(uint32_t streamIndex) const
 
 ParticleSystem::Particle ParticleList::NewParticle(float lifetime)
 {
-  if(mParticles.size() < mMaxParticleCount)
+  if(mAliveParticleCount < mMaxParticleCount)
   {
-    auto newIndex = int32_t(mFreeIndex);
-    mFreeIndex    = int32_t(mFreeChain[mFreeIndex]);
-    mAliveParticleCount++;
-
-    // Add particle
-    mParticles.emplace_back(new Internal::Particle(*this, newIndex));
-
-    // Set particle lifetime
-    auto& particle = mParticles.back();
+    auto newIndex = mAliveParticleCount++;
 
-    particle.Get<float>(ParticleStream::LIFETIME_STREAM_BIT) = lifetime;
-
-    // Store initial lifetime
-    particle.Get<float>(ParticleStream::LIFETIME_BASE_STREAM_BIT) = lifetime;
+    auto* lifetimes     = reinterpret_cast<float*>(GetDefaultStream(ParticleStream::LIFETIME_STREAM_BIT));
+    auto* lifetimeBases = reinterpret_cast<float*>(GetDefaultStream(ParticleStream::LIFETIME_BASE_STREAM_BIT));
+    if(lifetimes && lifetimeBases)
+    {
+      // Set particle lifetime and store initial lifetime
+      lifetimes[newIndex]     = lifetime;
+      lifetimeBases[newIndex] = lifetime;
+    }
 
-    return mParticles.back();
+    return GetParticle(newIndex);
   }
   return {nullptr};
 }
 
+ParticleSystem::Particle ParticleList::GetParticle(uint32_t particleIndex)
+{
+  // Views only store the slot index, so each one is allocated once and shared
+  auto& view = mParticleViews[particleIndex];
+  if(!view)
+  {
+    view = ParticleSystem::Particle(new Internal::Particle(*this, particleIndex));
+  }
+  return view;
+}
+
 uint32_t ParticleList::GetStreamElementSize(bool includeLocalStream)
 {
   if(includeLocalStream)
@@ -208,36 +208,60 @@ uint32_t ParticleList::GetStreamElementSize(bool includeLocalStream)
   }
 }
 
-void ParticleList::ReleaseParticle(uint32_t particleIndex)
+void ParticleList::SetUpdateDeltaTime(float deltaTime)
 {
-  auto it = mParticles.begin();
-  std::advance(it, particleIndex);
+  mUpdateDeltaTime = deltaTime;
+}
 
-  // Point at this slot of memory as next free slot
-  auto& p = *it;
-  if(mFreeIndex > -1)
+float ParticleList::GetUpdateDeltaTime() const
+{
+  return mUpdateDeltaTime;
+}
+
+void ParticleList::ReleaseParticle(uint32_t particleIndex)
+{
+  if(particleIndex >= mAliveParticleCount)
   {
-    mFreeChain[p.GetIndex()] = mFreeIndex;
+    return;
   }
-  mFreeIndex = p.GetIndex();
 
-  // Remove particle from the list
-  mParticles.erase(it);
-  mAliveParticleCount--;
+  // Move the last active particle into the released slot to keep the streams dense
+  auto lastIndex = --mAliveParticleCount;
+  if(particleIndex != lastIndex)
+  {
+    for(auto& stream : mDataStreams)
+    {
+      auto* data     = stream->data.data();
+      auto  dataSize = stream->dataSize;
+      std::copy(data + lastIndex * dataSize, data + (lastIndex + 1) * dataSize, data + particleIndex * dataSize);
+    }
+  }
 }
 
 void* ParticleList::GetDefaultStream(ParticleStreamTypeFlagBit streamBit)
 {
-  return GetRawStream(mBuiltInStreamMap[streamBit]);
+  return GetRawStream(GetDefaultStreamIndex(streamBit));
 }
 
 uint32_t ParticleList::GetDefaultStreamIndex(ParticleStreamTypeFlagBit streamBit)
 {
-  return mBuiltInStreamMap[uint32_t(streamBit)];
+  auto iter = mBuiltInStreamMap.find(uint32_t(streamBit));
+  return iter != mBuiltInStreamMap.end() ? iter->second : INVALID_STREAM_INDEX;
 }
 
 std::list<ParticleSystem::Particle>& ParticleList::GetParticles()
 {
+  // Views refer to slots, so the list only follows the number of active particles.
+  // Modifiers may call this from several threads at once, while no particle is emitted or released.
+  std::scoped_lock<std::mutex> lock(mParticlesMutex);
+  while(mParticles.size() > mAliveParticleCount)
+  {
+    mParticles.pop_back();
+  }
+  while(mParticles.size() < mAliveParticleCount)
+  {
+    mParticles.emplace_back(GetParticle(static_cast<uint32_t>(mParticles.size())));
+  }
   return mParticles;
 }
 
@@ -28,6 +28,7 @@
 #include <dali/devel-api/common/map-wrapper.h>
 #include <algorithm>
 #include <memory>
+#include <mutex>
 
 
 namespace Dali::Toolkit::ParticleSystem::Internal
@@ -102,13 +103,18 @@ struct ParticleDataStream
  * Particle list stores particle-specific data and manages the particles memory
  * It can return a sub-list.
  *
- * ParticleList manages the storage memory.
- *
+ * ParticleList manages the storage memory. Each stream is a separate array and the
+ * active particles always occupy the first GetActiveParticleCount() slots of every
+ * stream, so a new particle takes the next free slot and a released particle is
+ * replaced by the last active one. Neither allocates nor shifts the other particles.
  *
+ * Replacing a released particle changes the order the particles are drawn in. Both
+ * BlendingMode values are order independent, so the rendered result is the same.
  */
 class ParticleList : public Dali::BaseObject
 {
 public:
+  static constexpr uint32_t INVALID_STREAM_INDEX = 0xFFFFFFFFu;
 
   ParticleList(uint32_t capacity, ParticleSystem::ParticleList::ParticleStreamTypeFlags streamFlags);
 
@@ -158,20 +164,60 @@ public:
   /**
    * Allocates new particle in the streams
    * @param lifetime
-   * @return
+   * @return View on the new particle, or an empty handle if the list is full
    */
   ParticleSystem::Particle NewParticle(float lifetime);
 
+  /**
+   * Returns a view on the particle stored in the given slot
+   * @param[in] particleIndex Index of the particle, below the active particle count
+   * @return View on the particle
+   */
+  ParticleSystem::Particle GetParticle(uint32_t particleIndex);
+
+  /**
+   * Returns raw pointer to the data of a built-in stream
+   * @return Pointer to the stream data, or nullptr if the list doesn't have the stream
+   */
   void* GetDefaultStream(ParticleStreamTypeFlagBit streamBit);
 
+  /**
+   * Returns index of a built-in stream
+   * @return Index of the stream, or INVALID_STREAM_INDEX if the list doesn't have the stream
+   */
   uint32_t GetDefaultStreamIndex(ParticleStreamTypeFlagBit streamBit);
 
+  /**
+   * Returns a list of views on the active particles.
+   *
+   * The list is kept between calls, and only the views of emitted or released slots
+   * are added or removed. Accessing the streams by particle index is still faster.
+   * @return List of active particles
+   * @note It can be called from multi-threaded modifiers, as long as no particle is emitted or released meanwhile.
+   */
   std::list<ParticleSystem::Particle>& GetParticles();
 
+  /**
+   * Releases the particle in the given slot. The last active particle is moved
+   * into the slot, so any views on it will see the moved particle afterwards.
+   * @param[in] particleIndex Index of the particle, below the active particle count
+   */
   void ReleaseParticle(uint32_t particleIndex);
 
   uint32_t GetStreamElementSize(bool includeLocalStream);
 
+  /**
+   * Sets the time simulated by the current update
+   * @param[in] deltaTime Time in seconds
+   */
+  void SetUpdateDeltaTime(float deltaTime);
+
+  /**
+   * Returns the time simulated by the current update
+   * @return Time in seconds
+   */
+  [[nodiscard]] float GetUpdateDeltaTime() const;
+
 private:
   template<class T>
   uint32_t AddStream(const T& defaultValue, const char* streamName, bool localStream)
@@ -186,23 +232,22 @@ public:
   uint32_t AddStream(uint32_t sizeOfDataType, const void* defaultValue, ParticleStream::StreamDataType dataType, const char* streamName, bool localStream);
 
 private:
-  std::vector<char> mBuffer[2];
-
   uint32_t mAliveParticleCount{0u};
   uint32_t mMaxParticleCount;
 
   // Data storage
   std::vector<std::unique_ptr<ParticleDataStream>> mDataStreams;
 
-  std::vector<uint32_t> mFreeChain;
-  int32_t               mFreeIndex{0u};
-
   std::map<uint32_t, uint32_t> mBuiltInStreamMap;
 
-  std::list<ParticleSystem::Particle> mParticles;
+  std::vector<ParticleSystem::Particle> mParticleViews;  ///< Views on each slot, created on first use and reused
+  std::list<ParticleSystem::Particle>   mParticles;      ///< Only filled in by GetParticles()
+  std::mutex                            mParticlesMutex; ///< Guards mParticles against modifiers running in parallel
 
   uint32_t mParticleStreamElementSizeWithLocal{0u};
   uint32_t mParticleStreamElementSize{0u};
+
+  float mUpdateDeltaTime{0.0f};
 };
 
 } // namespace Dali::Toolkit::ParticleSystem::Internal
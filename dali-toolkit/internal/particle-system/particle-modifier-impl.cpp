@@ -17,11 +17,18 @@
 
 #include <dali-toolkit/internal/particle-system/particle-modifier-impl.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/particle-system/particle-builtin-modifiers.h>
+
 namespace Dali::Toolkit::ParticleSystem::Internal
 {
 ParticleModifier::ParticleModifier(std::unique_ptr<ParticleModifierInterface>&& updater)
 {
-  mUpdater = std::move(updater);
+  mUpdater   = std::move(updater);
+  mIsBuiltIn = dynamic_cast<GravityModifier*>(mUpdater.get()) ||
+               dynamic_cast<DragModifier*>(mUpdater.get()) ||
+               dynamic_cast<ColorOverLifeModifier*>(mUpdater.get()) ||
+               dynamic_cast<ScaleOverLifeModifier*>(mUpdater.get());
 }
 
 void ParticleModifier::Update(ParticleSystem::ParticleList& list, uint32_t first, uint32_t count)
@@ -34,4 +41,9 @@ ParticleModifierInterface& ParticleModifier::GetUpdater()
   return *mUpdater;
 }
 
+bool ParticleModifier::IsBuiltIn() const
+{
+  return mIsBuiltIn;
+}
+
 } // namespace Dali::Toolkit::ParticleSystem::Internal
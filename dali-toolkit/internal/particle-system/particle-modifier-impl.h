@@ -33,8 +33,15 @@ public:
 
   ParticleModifierInterface& GetUpdater();
 
+  /**
+   * Returns whether the updater is one of the built-in modifiers, which only access
+   * the built-in streams of the particles in the range they update
+   */
+  [[nodiscard]] bool IsBuiltIn() const;
+
 private:
   std::unique_ptr<ParticleModifierInterface> mUpdater;
+  bool                                       mIsBuiltIn{false};
 };
 
 } // namespace Dali::Toolkit::ParticleSystem::Internal
@@ -0,0 +1,102 @@
+#ifndef DALI_TOOLKIT_PARTICLE_SYSTEM_INTERNAL_PARTICLE_MODIFIER_KERNELS_H
+#define DALI_TOOLKIT_PARTICLE_SYSTEM_INTERNAL_PARTICLE_MODIFIER_KERNELS_H
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+/**
+ * Kernels of the built-in modifiers.
+ *
+ * They work on contiguous arrays of floats taken straight from the particle streams, with
+ * no aliasing between inputs and outputs, so that the compiler can vectorize the loops
+ * for the target (SSE, NEON) without any platform specific code.
+ */
+namespace Dali::Toolkit::ParticleSystem::Internal::ModifierKernels
+{
+/**
+ * Adds the acceleration to the velocities, then moves the positions by the velocities.
+ * @param[in,out] positions Positions, 3 floats per particle
+ * @param[in,out] velocities Velocities, 3 floats per particle
+ * @param[in] count Number of particles
+ * @param[in] acceleration Acceleration, 3 floats
+ * @param[in] deltaTime Time step in seconds
+ */
+inline void Accelerate(float* __restrict__ positions, float* __restrict__ velocities, uint32_t count, const float* acceleration, float deltaTime)
+{
+  const float dv[3] = {acceleration[0] * deltaTime, acceleration[1] * deltaTime, acceleration[2] * deltaTime};
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    velocities[i * 3u] += dv[0];
+    velocities[i * 3u + 1u] += dv[1];
+    velocities[i * 3u + 2u] += dv[2];
+  }
+
+  // Positions and velocities have the same layout, so they can be treated as flat arrays
+  for(uint32_t i = 0u; i < count * 3u; ++i)
+  {
+    positions[i] += velocities[i] * deltaTime;
+  }
+}
+
+/**
+ * Scales all the values by the same factor.
+ * @param[in,out] values Values to scale
+ * @param[in] valueCount Number of floats
+ * @param[in] factor Scale factor
+ */
+inline void Scale(float* __restrict__ values, uint32_t valueCount, float factor)
+{
+  for(uint32_t i = 0u; i < valueCount; ++i)
+  {
+    values[i] *= factor;
+  }
+}
+
+/**
+ * Interpolates the values from start to end by the age of each particle.
+ * @tparam N Number of floats per particle
+ * @param[out] values Values, N floats per particle
+ * @param[in] lifetimes Remaining lifetimes
+ * @param[in] lifetimeBases Initial lifetimes
+ * @param[in] count Number of particles
+ * @param[in] start Value of newborn particles, N floats
+ * @param[in] end Value of dying particles, N floats
+ */
+template<uint32_t N>
+inline void InterpolateOverLife(float* __restrict__ values, const float* __restrict__ lifetimes, const float* __restrict__ lifetimeBases, uint32_t count, const float* start, const float* end)
+{
+  float delta[N];
+  for(uint32_t c = 0u; c < N; ++c)
+  {
+    delta[c] = end[c] - start[c];
+  }
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const float age = lifetimeBases[i] > 0.0f ? 1.0f - lifetimes[i] / lifetimeBases[i] : 0.0f;
+    for(uint32_t c = 0u; c < N; ++c)
+    {
+      values[i * N + c] = start[c] + delta[c] * age;
+    }
+  }
+}
+
+} // namespace Dali::Toolkit::ParticleSystem::Internal::ModifierKernels
+
+#endif // DALI_TOOLKIT_PARTICLE_SYSTEM_INTERNAL_PARTICLE_MODIFIER_KERNELS_H
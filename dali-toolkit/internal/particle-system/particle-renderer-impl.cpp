@@ -29,6 +29,12 @@
 
 namespace Dali::Toolkit::ParticleSystem::Internal
 {
+namespace
+{
+constexpr uint32_t MINIMUM_SHADER_VERSION_SUPPORT_INSTANCING = 300;
+constexpr uint32_t VERTICES_PER_PARTICLE                     = 6u;
+} // namespace
+
 ParticleRenderer::ParticleRenderer()
 {
   mStreamBufferUpdateCallback = Dali::VertexBufferUpdateCallback::New(this, &ParticleRenderer::OnStreamBufferUpdate);
@@ -60,6 +66,9 @@ void ParticleRenderer::CreateShader()
   auto& list        = GetImplementation(mEmitter->GetParticleList());
   auto  streamCount = list.GetStreamCount();
 
+  // Instanced attributes need GLES3, otherwise the stream data is replicated for each vertex
+  mUsingStreamDivisor = Dali::Shader::GetShaderLanguageVersion() >= MINIMUM_SHADER_VERSION_SUPPORT_INSTANCING;
+
   static const char* ATTR_GLSL_TYPES[] =
     {
       "float", "vec2", "vec3", "vec4", "int", "ivec2", "ivec3", "ivec4"};
@@ -184,22 +193,27 @@ void ParticleRenderer::CreateShader()
     Vertex2D a5{Vector2(0.0f, 1.0f) - C, Vector2(0.0f, 1.0f)};
   } QUAD;
 
+  // With instancing, a single quad is drawn once per particle
   std::vector<Quad2D> quads;
-  quads.resize(mEmitter->GetParticleList().GetCapacity());
+  quads.resize(mUsingStreamDivisor ? 1u : mEmitter->GetParticleList().GetCapacity());
   std::fill(quads.begin(), quads.end(), QUAD);
-  vertexBuffer0.SetData(quads.data(), 6u * quads.size());
+  vertexBuffer0.SetData(quads.data(), VERTICES_PER_PARTICLE * quads.size());
 
   // Second vertex buffer with stream data
   VertexBuffer vertexBuffer1 = VertexBuffer::New(streamAtttributes);
 
   /**
-   * For more efficient stream management we need to support glVertexAttribDivisor() function.
-   * This will allow step 1 attribute per 4 vertices (GLES3+). Problem: DALi doesn't support instancing
+   * With GLES3+ the stream buffer is an instance buffer (attribute divisor 1), so the data of
+   * each particle is written once and shared by all the vertices of its quad.
    *
-   * For older GLES2 we need to duplicate stream data (4x more memory in case of using a quad geometry)
+   * For older GLES2 we need to duplicate stream data (6x more memory in case of using a quad geometry)
    *
    * Point-sprites may be of use in the future (problem: point sprites use screen space)
    */
+  if(mUsingStreamDivisor)
+  {
+    vertexBuffer1.SetDivisor(1u);
+  }
 
   // Based on the particle system, populate buffer
   mGeometry.AddVertexBuffer(vertexBuffer0);
@@ -213,10 +227,10 @@ void ParticleRenderer::CreateShader()
   // Set some initial data for streambuffer to force initialization
   std::vector<uint8_t> data;
   // Resize using only-non local streams
-  auto elementSize = mEmitter->GetParticleList().GetParticleDataSize(false);
-  data.resize(elementSize *
-              mEmitter->GetParticleList().GetCapacity() * 6u);
-  mStreamBuffer.SetData(data.data(), mEmitter->GetParticleList().GetCapacity() * 6u); // needed to initialize
+  auto elementSize  = mEmitter->GetParticleList().GetParticleDataSize(false);
+  auto elementCount = mEmitter->GetParticleList().GetCapacity() * GetStreamElementsPerParticle();
+  data.resize(elementSize * elementCount);
+  mStreamBuffer.SetData(data.data(), elementCount); // needed to initialize
 
   // Sets up callback
   mStreamBuffer.SetVertexBufferUpdateCallback(std::move(mStreamBufferUpdateCallback));
@@ -278,8 +292,8 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t size)
     }
   }
 
-  // Prepare source buffer (MUST BE OPTIMIZED TO AVOID ALLOCATING AND COPYING!!)
-  auto totalSize = particleMaxCount * elementSize * 6u;
+  // Prepare source buffer
+  auto totalSize = particleMaxCount * elementSize * GetStreamElementsPerParticle();
 
   // buffer sizes must match
   if(totalSize != size)
@@ -290,8 +304,6 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t size)
 
   auto* dst = reinterpret_cast<uint8_t*>(streamData);
 
-  auto& particles = list.GetParticles();
-
   // prepare worker threads
   auto workerCount = GetThreadPool().GetWorkerCount();
 
@@ -360,38 +372,9 @@ uint32_t ParticleRenderer::OnStreamBufferUpdate(void* streamData, size_t size)
   // less particles so run on a single thread
   if(!runParallel)
   {
-    for(auto& p : particles)
-    {
-      // without instancing we need to duplicate data 4 times per each quad
-      auto* particleDst = dst;
-      for(auto s = 0u; s < streamCount; ++s)
-      {
-        if(!list.IsStreamLocal(s))
-        {
-          // Pointer to stream value
-          auto* valuePtr = &p.GetByIndex<uint8_t*>(s);
-
-          // Size of data
-          auto dataSize = list.GetStreamDataTypeSize(s);
-
-          memcpy(dst, valuePtr, dataSize);
-          dst += dataSize;
-        }
-      }
-      // Replicate data 5 more times for each vertex (GLES2)
-      memcpy(dst, particleDst, elementSize);
-      dst += elementSize;
-      memcpy(dst, particleDst, elementSize);
-      dst += elementSize;
-      memcpy(dst, particleDst, elementSize);
-      dst += elementSize;
-      memcpy(dst, particleDst, elementSize);
-      dst += elementSize;
-      memcpy(dst, particleDst, elementSize);
-      dst += elementSize;
-    }
+    UpdateParticlesTask(list, 0u, particleCount, dst);
   }
-  return particleCount * 6u; // return number of elements to render
+  return particleCount * GetStreamElementsPerParticle(); // return number of elements to render
 }
 
 Renderer ParticleRenderer::GetRenderer() const
@@ -404,49 +387,47 @@ void ParticleRenderer::UpdateParticlesTask(Internal::ParticleList& list,
                                            uint32_t                particleCount,
                                            uint8_t*                basePtr)
 {
-  auto& particles   = list.GetParticles();
-  auto  streamCount = list.GetStreamCount();
-  auto  elementSize = list.GetStreamElementSize(false);
+  auto streamCount = list.GetStreamCount();
+  auto elementSize = list.GetStreamElementSize(false);
 
-  // calculate begin of buffer
-  uint8_t* dst = (basePtr + (elementSize * 6u) * particleStartIndex);
+  // Active particles are stored densely, so each stream is read linearly from the first particle
+  std::vector<std::pair<const uint8_t*, uint32_t>> streams;
+  streams.reserve(streamCount);
+  for(auto s = 0u; s < streamCount; ++s)
+  {
+    if(!list.IsStreamLocal(s))
+    {
+      auto dataSize = list.GetStreamDataTypeSize(s);
+      streams.emplace_back(reinterpret_cast<const uint8_t*>(list.GetRawStream(s)) + dataSize * particleStartIndex, dataSize);
+    }
+  }
 
-  auto it = particles.begin();
-  std::advance(it, particleStartIndex);
+  // calculate begin of buffer
+  auto     copyCount = GetStreamElementsPerParticle();
+  uint8_t* dst       = (basePtr + (elementSize * copyCount) * particleStartIndex);
 
-  for(; particleCount; particleCount--, it++)
+  for(auto i = 0u; i < particleCount; ++i)
   {
-    ParticleSystem::Particle& p = *it;
-    // without instancing we need to duplicate data 4 times per each quad
     auto* particleDst = dst;
-    for(auto s = 0u; s < streamCount; ++s)
+    for(auto& stream : streams)
     {
-      if(!list.IsStreamLocal(s))
-      {
-        // Pointer to stream value
-        auto* valuePtr = &p.GetByIndex<uint8_t*>(s);
-
-        // Size of data
-        auto dataSize = list.GetStreamDataTypeSize(s);
-
-        memcpy(dst, valuePtr, dataSize);
-        dst += dataSize;
-      }
+      memcpy(dst, stream.first + stream.second * i, stream.second);
+      dst += stream.second;
+    }
+    // without instancing we need to replicate data for each vertex of the quad (GLES2)
+    for(auto copy = 1u; copy < copyCount; ++copy)
+    {
+      memcpy(dst, particleDst, elementSize);
+      dst += elementSize;
     }
-    // Replicate data 5 more times for each vertex (GLES2)
-    memcpy(dst, particleDst, elementSize);
-    dst += elementSize;
-    memcpy(dst, particleDst, elementSize);
-    dst += elementSize;
-    memcpy(dst, particleDst, elementSize);
-    dst += elementSize;
-    memcpy(dst, particleDst, elementSize);
-    dst += elementSize;
-    memcpy(dst, particleDst, elementSize);
-    dst += elementSize;
   }
 }
 
+uint32_t ParticleRenderer::GetStreamElementsPerParticle() const
+{
+  return mUsingStreamDivisor ? 1u : VERTICES_PER_PARTICLE;
+}
+
 bool ParticleRenderer::Initialize()
 {
   if(!mInitialized)
@@ -77,6 +77,12 @@ public:
 
   uint32_t OnStreamBufferUpdate(void* data, size_t size);
 
+  /**
+   * Returns how many stream buffer elements are written per particle
+   * @return 1 when the stream buffer is an instance buffer, or the number of vertices of a particle quad
+   */
+  [[nodiscard]] uint32_t GetStreamElementsPerParticle() const;
+
   bool mUsingStreamDivisor{true}; ///< If attribute divisor is supported, it's going to be used
 
   Internal::ParticleEmitter* mEmitter{nullptr}; ///< Emitter implementation that uses the renderer
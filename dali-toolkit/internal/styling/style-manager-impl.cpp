@@ -19,10 +19,12 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/singleton-service.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/adaptor-framework/application.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali/public-api/object/type-registry.h>
+#include <chrono>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/asset-manager/asset-manager.h>
@@ -47,6 +49,38 @@ const char* DEFAULT_TOOLKIT_PACKAGE_PATH = "/toolkit/";
 
 static constexpr int32_t COUNT_BROKEN_IMAGE_MAX = 3;
 
+static constexpr uint32_t STYLE_PRECOMPILE_TIME_SLICE_MILLISECONDS = 4u; ///< The time spent precompiling the styles per idle callback
+
+const char* CONTROL_TYPE_NAME = "Control";
+
+uint32_t GetMilliSeconds()
+{
+  // Get the time of a monotonic clock since its epoch.
+  auto epoch = std::chrono::steady_clock::now().time_since_epoch();
+
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(epoch);
+
+  return static_cast<uint32_t>(duration.count());
+}
+
+/**
+ * @brief Checks whether the type is derived from Control.
+ * @param[in] typeInfo The type to check
+ * @return True if the type is a control
+ */
+bool IsControlType(Dali::TypeInfo typeInfo)
+{
+  while(typeInfo)
+  {
+    if(typeInfo.GetName() == CONTROL_TYPE_NAME)
+    {
+      return true;
+    }
+    typeInfo = Dali::TypeRegistry::Get().GetTypeInfo(typeInfo.GetBaseName());
+  }
+  return false;
+}
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_STYLE");
 #endif
@@ -107,7 +141,9 @@ StyleManager::StyleManager()
 : mDefaultFontSize(-1),
   mDefaultFontFamily(""),
   mDefaultThemeFilePath(),
-  mFeedbackStyle(nullptr)
+  mFeedbackStyle(nullptr),
+  mStylePrecompileCallback(nullptr),
+  mStylePrecompileEnabled(false)
 {
   // Add theme builder constants
   const std::string dataReadOnlyDir                     = AssetManager::GetDaliDataReadOnlyPath();
@@ -133,6 +169,12 @@ StyleManager::StyleManager()
 
 StyleManager::~StyleManager()
 {
+  if(mStylePrecompileCallback && Adaptor::IsAvailable())
+  {
+    // Removes the callback from the callback manager in case the style manager is destroyed before the callback is executed.
+    Adaptor::Get().RemoveIdle(mStylePrecompileCallback);
+  }
+
   delete mFeedbackStyle;
 }
 
@@ -274,6 +316,11 @@ void StyleManager::SetTheme(const std::string& themeFile)
       }
 
       EmitStyleChangeSignals(StyleChange::THEME_CHANGE);
+
+      if(mStylePrecompileEnabled)
+      {
+        RequestStylePrecompile();
+      }
     }
     else
     {
@@ -342,6 +389,29 @@ std::vector<std::string> StyleManager::GetBrokenImageUrlList()
   return brokenImageUrlList;
 }
 
+void StyleManager::SetStylePrecompileEnabled(bool enabled)
+{
+  mStylePrecompileEnabled = enabled;
+
+  if(mStylePrecompileEnabled)
+  {
+    if(!mThemeBuilder)
+    {
+      // The styles are precompiled when the theme is loaded.
+      ApplyDefaultTheme();
+    }
+    else
+    {
+      RequestStylePrecompile();
+    }
+  }
+  else
+  {
+    // The idle callback is removed when it's executed next time.
+    mStylesToPrecompile.clear();
+  }
+}
+
 bool StyleManager::LoadFile(const std::string& filename, std::string& stringOut)
 {
   DALI_ASSERT_DEBUG(0 != filename.length());
@@ -499,6 +569,15 @@ const StylePtr StyleManager::GetRecordedStyle(Toolkit::Control control)
   return StylePtr(NULL);
 }
 
+const StylePtr StyleManager::GetRecordedStyle(const std::string& styleName)
+{
+  if(mThemeBuilder)
+  {
+    return GetImpl(mThemeBuilder).GetStyle(styleName);
+  }
+  return StylePtr(NULL);
+}
+
 Toolkit::Builder StyleManager::FindCachedBuilder(const std::string& key)
 {
   BuilderMap::iterator builderIt = mBuilderCache.find(key);
@@ -551,6 +630,57 @@ void StyleManager::EmitStyleChangeSignals(StyleChange::Type styleChange)
   mStyleChangedSignal.Emit(styleManager, styleChange);
 }
 
+void StyleManager::RequestStylePrecompile()
+{
+  mStylesToPrecompile.clear();
+  if(mThemeBuilder)
+  {
+    GetImpl(mThemeBuilder).GetStyleNames(mStylesToPrecompile);
+  }
+
+  if(!mStylePrecompileCallback && !mStylesToPrecompile.empty() && Adaptor::IsAvailable())
+  {
+    mStylePrecompileCallback = MakeCallback(this, &StyleManager::OnStylePrecompileIdle);
+    if(DALI_UNLIKELY(!Adaptor::Get().AddIdle(mStylePrecompileCallback, true)))
+    {
+      DALI_LOG_ERROR("Fail to add idle callback for style precompile. Skip it.\n");
+      mStylePrecompileCallback = nullptr;
+    }
+  }
+}
+
+bool StyleManager::OnStylePrecompileIdle()
+{
+  const uint32_t startTime = GetMilliSeconds();
+
+  while(!mStylesToPrecompile.empty())
+  {
+    const std::string styleName = mStylesToPrecompile.back();
+    mStylesToPrecompile.pop_back();
+
+    // The property names are resolved through the type, so no control is created.
+    Dali::TypeInfo typeInfo = Dali::TypeRegistry::Get().GetTypeInfo(styleName);
+    if(mThemeBuilder && IsControlType(typeInfo))
+    {
+      DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Precompile style %s\n", styleName.c_str());
+      GetImpl(mThemeBuilder).PrecompileStyle(styleName, typeInfo);
+    }
+
+    if(GetMilliSeconds() - startTime >= STYLE_PRECOMPILE_TIME_SLICE_MILLISECONDS)
+    {
+      break;
+    }
+  }
+
+  if(mStylesToPrecompile.empty())
+  {
+    // The callback manager deletes the callback after returning false.
+    mStylePrecompileCallback = nullptr;
+    return false;
+  }
+  return true;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -110,6 +110,11 @@ public: // Public API
    */
   std::vector<std::string> GetBrokenImageUrlList();
 
+  /**
+   * @copydoc Toolkit::DevelStyleManager::SetStylePrecompileEnabled
+   */
+  void SetStylePrecompileEnabled(bool enabled);
+
   /**
    * @brief Apply the theme style to a control.
    *
@@ -136,6 +141,13 @@ public: // Public API
    */
   const StylePtr GetRecordedStyle(Toolkit::Control control);
 
+  /**
+   * Get the style recorded in the theme builder with the given name
+   * @param[in] styleName The name of the style
+   * @return The style information (or empty ptr if not recorded yet)
+   */
+  const StylePtr GetRecordedStyle(const std::string& styleName);
+
 public:
   // SIGNALS
 
@@ -231,6 +243,17 @@ private:
    */
   void EmitStyleChangeSignals(StyleChange::Type styleChange);
 
+  /**
+   * @brief Queues the styles of the current theme to be precompiled in the idle callbacks.
+   */
+  void RequestStylePrecompile();
+
+  /**
+   * @brief Called when the main loop is idle. Records the queued styles in the theme builder until the time slice expires.
+   * @return True if there are styles left to precompile
+   */
+  bool OnStylePrecompileIdle();
+
   // Undefined
   StyleManager(const StyleManager&);
 
@@ -257,6 +280,10 @@ private:
 
   std::vector<std::string> mBrokenImageUrls; ///< Broken Image Urls received from user
 
+  StringList    mStylesToPrecompile;      ///< The names of the styles not precompiled yet
+  CallbackBase* mStylePrecompileCallback; ///< The idle callback which precompiles the styles. Owned by the adaptor
+  bool          mStylePrecompileEnabled;  ///< Whether the styles are precompiled after the theme is loaded
+
   // Signals
   Toolkit::StyleManager::StyleChangedSignalType            mControlStyleChangeSignal; ///< Emitted when the style( theme/font ) changes for the controls to style themselves
   Toolkit::StyleManager::StyleChangedSignalType            mStyleChangedSignal;       ///< Emitted after the controls have been styled
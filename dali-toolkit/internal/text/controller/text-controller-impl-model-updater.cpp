@@ -33,6 +33,7 @@
 #include <dali-toolkit/internal/text/segmentation.h>
 #include <dali-toolkit/internal/text/shaper.h>
 #include <dali-toolkit/internal/text/text-editable-control-interface.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 
 namespace Dali::Toolkit::Text
 {
@@ -165,6 +166,8 @@ bool ControllerImplModelUpdater::Update(Controller::Impl& impl, OperationsMask o
 
   if(Controller::NO_OPERATION != (Controller::GET_LINE_BREAKS & operations))
   {
+    ProfilerScope profilerScope(TextProfiler::Stage::SEGMENTATION, &impl.mProfilerStatistics);
+
     // Retrieves the line break info. The line break info is used to split the text in 'paragraphs' to
     // calculate the bidirectional info for each 'paragraph'.
     // It's also used to layout the text (where it should be a new line) or to shape the text (text in different lines
@@ -223,6 +226,8 @@ bool ControllerImplModelUpdater::Update(Controller::Impl& impl, OperationsMask o
 
   if(getScripts || validateFonts)
   {
+    ProfilerScope profilerScope(TextProfiler::Stage::FONT_VALIDATION, &impl.mProfilerStatistics);
+
     // Validates the fonts assigned by the application or assigns default ones.
     // It makes sure all the characters are going to be rendered by the correct font.
     MultilanguageSupport multilanguageSupport = MultilanguageSupport::Get();
@@ -292,6 +297,8 @@ bool ControllerImplModelUpdater::Update(Controller::Impl& impl, OperationsMask o
   const Length      numberOfParagraphs = impl.mModel->mLogicalModel->mParagraphInfo.Count();
   if(Controller::NO_OPERATION != (Controller::BIDI_INFO & operations))
   {
+    ProfilerScope profilerScope(TextProfiler::Stage::BIDI, &impl.mProfilerStatistics);
+
     Vector<BidirectionalParagraphInfoRun>& bidirectionalInfo = impl.mModel->mLogicalModel->mBidirectionalParagraphInfo;
     bidirectionalInfo.Reserve(numberOfParagraphs);
 
@@ -356,6 +363,8 @@ bool ControllerImplModelUpdater::Update(Controller::Impl& impl, OperationsMask o
 
   if(Controller::NO_OPERATION != (Controller::SHAPE_TEXT & operations))
   {
+    ProfilerScope profilerScope(TextProfiler::Stage::SHAPING, &impl.mProfilerStatistics);
+
     const Vector<Character>& textToShape = textMirrored ? mirroredUtf32Characters : utf32Characters;
     // Shapes the text.
     ShapeText(textToShape,
@@ -1095,6 +1095,8 @@ public:
 
   Shader mShaderBackground; ///< The shader for text background.
 
+  ProfilerStatistics mProfilerStatistics; ///< The time spent in the stages of the text pipeline.
+
   float mCurrentLineSize;              ///< Used to store the MinLineSize set by user when TextFitArray is enabled.
   float mTextFitMinSize;               ///< Minimum Font Size for text fit. Default 10
   float mTextFitMaxSize;               ///< Maximum Font Size for text fit. Default 100
@@ -30,6 +30,7 @@
 #include <dali-toolkit/internal/text/controller/text-controller-event-handler.h>
 #include <dali-toolkit/internal/text/controller/text-controller-impl.h>
 #include <dali-toolkit/internal/text/layouts/layout-parameters.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 
 namespace
 {
@@ -877,13 +878,17 @@ bool Controller::Relayouter::DoRelayout(Controller::Impl& impl, const Size& size
     }
 
     Size newLayoutSize;
-    viewUpdated               = impl.mLayoutEngine.LayoutText(layoutParameters,
-                                                newLayoutSize,
-                                                elideTextEnabled,
-                                                isAutoScrollEnabled,
-                                                isAutoScrollMaxTextureExceeded,
-                                                isHiddenInputEnabled,
-                                                ellipsisPosition);
+    {
+      ProfilerScope profilerScope(TextProfiler::Stage::LAYOUT, &impl.mProfilerStatistics);
+
+      viewUpdated = impl.mLayoutEngine.LayoutText(layoutParameters,
+                                                  newLayoutSize,
+                                                  elideTextEnabled,
+                                                  isAutoScrollEnabled,
+                                                  isAutoScrollMaxTextureExceeded,
+                                                  isHiddenInputEnabled,
+                                                  ellipsisPosition);
+    }
     impl.mIsAutoScrollEnabled = isAutoScrollEnabled;
     layoutTooSmall = !viewUpdated;
 
@@ -1437,6 +1437,16 @@ const ModelInterface* Controller::GetTextModel() const
   return mImpl->mModel.Get();
 }
 
+const ProfilerStatistics& Controller::GetProfilerStatistics() const
+{
+  return mImpl->mProfilerStatistics;
+}
+
+ProfilerStatistics& Controller::GetProfilerStatistics()
+{
+  return mImpl->mProfilerStatistics;
+}
+
 float Controller::GetScrollAmountByUserInput()
 {
   float scrollAmount = 0.0f;
@@ -36,6 +36,7 @@
 #include <dali-toolkit/internal/text/layouts/layout-engine.h>
 #include <dali-toolkit/internal/text/text-anchor-control-interface.h>
 #include <dali-toolkit/internal/text/text-model-interface.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 #include <dali-toolkit/internal/text/text-selectable-control-interface.h>
 #include <dali-toolkit/public-api/text/text-enumerations.h>
 
@@ -1767,6 +1768,18 @@ public: // Queries & retrieves.
    */
   const ModelInterface* GetTextModel() const;
 
+  /**
+   * @brief Retrieves the time spent in the stages of the text pipeline run by this controller.
+   *
+   * @return The statistics of the stages.
+   */
+  const ProfilerStatistics& GetProfilerStatistics() const;
+
+  /**
+   * @copydoc GetProfilerStatistics() const
+   */
+  ProfilerStatistics& GetProfilerStatistics();
+
   /**
    * @brief Used to get scrolled distance by user input
    *
@@ -287,6 +287,20 @@ BidirectionalLineRunIndex LogicalModel::GetBidirectionalLineInfo() const
 
 void LogicalModel::UpdateTextStyleRuns(CharacterIndex index, int numberOfCharacters)
 {
+  if(0 <= numberOfCharacters)
+  {
+    // Inserted characters only move or extend the runs. Neither the text nor the removed runs are needed.
+    const Length numberOfInsertedCharacters = static_cast<Length>(numberOfCharacters);
+    InsertCharacterRuns<ColorRun>(index, numberOfInsertedCharacters, mColorRuns);
+    InsertCharacterRuns<UnderlinedCharacterRun>(index, numberOfInsertedCharacters, mUnderlinedCharacterRuns);
+    InsertCharacterRuns<StrikethroughCharacterRun>(index, numberOfInsertedCharacters, mStrikethroughCharacterRuns);
+    InsertCharacterRuns<ColorRun>(index, numberOfInsertedCharacters, mBackgroundColorRuns);
+    InsertCharacterRuns<FontDescriptionRun>(index, numberOfInsertedCharacters, mFontDescriptionRuns);
+    InsertCharacterRuns<BoundedParagraphRun>(index, numberOfInsertedCharacters, mBoundedParagraphRuns);
+    InsertCharacterRuns<CharacterSpacingCharacterRun>(index, numberOfInsertedCharacters, mCharacterSpacingCharacterRuns);
+    return;
+  }
+
   const Length totalNumberOfCharacters = mText.Count();
 
   // Process the color runs.
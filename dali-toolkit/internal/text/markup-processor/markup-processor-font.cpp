@@ -26,6 +26,7 @@
 #include <dali-toolkit/internal/text/font-description-run.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-attribute-helper-functions.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-helper-functions.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
 #include <dali-toolkit/internal/text/markup-tags-and-attributes.h>
 #include <dali-toolkit/internal/text/text-font-style.h>
 
@@ -39,6 +40,23 @@ namespace
 {
 const unsigned int MAX_FONT_ATTRIBUTE_SIZE = 15u;  ///< The maximum length of any of the possible 'weight', 'width' or 'slant' values.
 const float        PIXEL_FORMAT_64_FACTOR  = 64.f; ///< 64.f is used to convert from point size to 26.6 pixel format.
+
+enum class FontAttribute
+{
+  UNKNOWN,
+  FAMILY,
+  SIZE,
+  WEIGHT,
+  WIDTH,
+  SLANT
+};
+
+constexpr auto FONT_ATTRIBUTE_TABLE = MakeTokenTable<FontAttribute>({{MARKUP::FONT_ATTRIBUTES::FAMILY, FontAttribute::FAMILY},
+                                                                     {MARKUP::FONT_ATTRIBUTES::SIZE, FontAttribute::SIZE},
+                                                                     {MARKUP::FONT_ATTRIBUTES::WEIGHT, FontAttribute::WEIGHT},
+                                                                     {MARKUP::FONT_ATTRIBUTES::WIDTH, FontAttribute::WIDTH},
+                                                                     {MARKUP::FONT_ATTRIBUTES::SLANT, FontAttribute::SLANT}});
+static_assert(FONT_ATTRIBUTE_TABLE.GetMaxProbeLength() == 1u, "Every attribute should be found with a single comparison");
 } // namespace
 
 void processFontAttributeValue(char value[], const Attribute& attribute)
@@ -89,25 +107,37 @@ void ProcessFontTag(const Tag& tag, FontDescriptionRun& fontRun)
   {
     const Attribute& attribute(*it);
 
-    if(TokenComparison(MARKUP::FONT_ATTRIBUTES::FAMILY, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessFontFamily(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::FONT_ATTRIBUTES::SIZE, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessFontSize(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::FONT_ATTRIBUTES::WEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessFontWeight(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::FONT_ATTRIBUTES::WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessFontWidth(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::FONT_ATTRIBUTES::SLANT, attribute.nameBuffer, attribute.nameLength))
+    switch(FONT_ATTRIBUTE_TABLE.Find(attribute.nameBuffer, attribute.nameLength, FontAttribute::UNKNOWN))
     {
-      ProcessFontSlant(attribute, fontRun);
+      case FontAttribute::FAMILY:
+      {
+        ProcessFontFamily(attribute, fontRun);
+        break;
+      }
+      case FontAttribute::SIZE:
+      {
+        ProcessFontSize(attribute, fontRun);
+        break;
+      }
+      case FontAttribute::WEIGHT:
+      {
+        ProcessFontWeight(attribute, fontRun);
+        break;
+      }
+      case FontAttribute::WIDTH:
+      {
+        ProcessFontWidth(attribute, fontRun);
+        break;
+      }
+      case FontAttribute::SLANT:
+      {
+        ProcessFontSlant(attribute, fontRun);
+        break;
+      }
+      case FontAttribute::UNKNOWN:
+      {
+        break;
+      }
     }
   }
 }
@@ -22,8 +22,10 @@
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/math/vector2.h>
 #include <stdlib.h>
-#include <iomanip>
-#include <sstream>
+#include <cstdio>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
 
 namespace Dali
 {
@@ -39,20 +41,36 @@ const char LAST_UPPER_CASE  = 0x5b; // ASCII value of the one after the last upp
 const char TO_LOWER_CASE    = 32;   // Value to add to a upper case character to transform it into a lower case.
 
 const unsigned int MAX_FLOAT_ATTRIBUTE_SIZE = 17u; ///< The maximum length of any of the possible float values.  +99999.999999999f  (sign, five digits, dot, nine digits, f)
+const unsigned int MAX_NUMBER_STRING_SIZE   = 32u; ///< Big enough for any float printed with "%g" and for a "0xAARRGGBB" color, with the terminating null.
 
 const char        WEB_COLOR_TOKEN('#');
 const char* const HEX_COLOR_TOKEN("0x");
 const char* const ALPHA_ONE("FF");
 
-const char* BLACK_COLOR("black");
-const char* WHITE_COLOR("white");
-const char* RED_COLOR("red");
-const char* GREEN_COLOR("green");
-const char* BLUE_COLOR("blue");
-const char* YELLOW_COLOR("yellow");
-const char* MAGENTA_COLOR("magenta");
-const char* CYAN_COLOR("cyan");
-const char* TRANSPARENT_COLOR("transparent");
+const Length MAX_WEB_COLOR_LENGTH = 8u; ///< The number of hexadecimal digits of an 'AARRGGBB' web color.
+
+constexpr std::string_view BLACK_COLOR("black");
+constexpr std::string_view WHITE_COLOR("white");
+constexpr std::string_view RED_COLOR("red");
+constexpr std::string_view GREEN_COLOR("green");
+constexpr std::string_view BLUE_COLOR("blue");
+constexpr std::string_view YELLOW_COLOR("yellow");
+constexpr std::string_view MAGENTA_COLOR("magenta");
+constexpr std::string_view CYAN_COLOR("cyan");
+constexpr std::string_view TRANSPARENT_COLOR("transparent");
+
+// The named colors as 0xAARRGGBB. No named color is fully transparent red, so it marks a name not found.
+const uint32_t INVALID_NAMED_COLOR = 0x00FF0000u;
+
+constexpr auto NAMED_COLOR_TABLE = MakeTokenTable<uint32_t>({{BLACK_COLOR, 0xFF000000u},
+                                                             {WHITE_COLOR, 0xFFFFFFFFu},
+                                                             {RED_COLOR, 0xFFFF0000u},
+                                                             {GREEN_COLOR, 0xFF00FF00u},
+                                                             {BLUE_COLOR, 0xFF0000FFu},
+                                                             {YELLOW_COLOR, 0xFFFFFF00u},
+                                                             {MAGENTA_COLOR, 0xFFFF00FFu},
+                                                             {CYAN_COLOR, 0xFF00FFFFu},
+                                                             {TRANSPARENT_COLOR, 0x00000000u}});
 
 const char* SOLID_UNDERLINE("solid");
 const char* DASHED_UNDERLINE("dashed");
@@ -64,7 +82,7 @@ const char* END_HORIZONTAL_ALIGNMENT("end");
 
 } // namespace
 
-bool TokenComparison(const std::string& string1, const char* const stringBuffer2, Length length)
+bool TokenComparison(std::string_view string1, const char* const stringBuffer2, Length length)
 {
   const Length stringSize = string1.size();
   if(stringSize != length)
@@ -73,7 +91,7 @@ bool TokenComparison(const std::string& string1, const char* const stringBuffer2
     return false;
   }
 
-  const char* const stringBuffer1 = string1.c_str();
+  const char* const stringBuffer1 = string1.data();
 
   for(std::size_t index = 0; index < stringSize; ++index)
   {
@@ -119,16 +137,15 @@ float StringToFloat(const char* const floatStr)
 
 void FloatToString(float value, std::string& floatStr)
 {
-  std::stringstream ss;
-  ss << value;
-  floatStr = ss.str();
+  // Same format as a default std::stringstream, without creating one.
+  char buffer[MAX_NUMBER_STRING_SIZE];
+  snprintf(buffer, MAX_NUMBER_STRING_SIZE, "%g", value);
+  floatStr = buffer;
 }
 
 void UintToString(unsigned int value, std::string& uIntStr)
 {
-  std::stringstream ss;
-  ss << value;
-  uIntStr = ss.str();
+  uIntStr = std::to_string(value);
 }
 
 void UintColorToVector4(unsigned int color, Vector4& retColor)
@@ -143,60 +160,46 @@ void ColorStringToVector4(const char* const colorStr, Length length, Vector4& re
 {
   if(WEB_COLOR_TOKEN == *colorStr)
   {
-    std::string webColor(colorStr + 1u, length - 1u);
+    // Expands the web color into an 'AARRGGBB' string on the stack.
+    char        webColor[MAX_WEB_COLOR_LENGTH + 1u] = {};
+    const char* digits                              = colorStr + 1u;
+    Length      index                               = 0u;
     if(4u == length) // 3 component web color #F00 (red)
     {
-      webColor.insert(2u, &(webColor[2]), 1u);
-      webColor.insert(1u, &(webColor[1]), 1u);
-      webColor.insert(0u, &(webColor[0]), 1u);
-      webColor.insert(0u, ALPHA_ONE);
+      webColor[index++] = ALPHA_ONE[0u];
+      webColor[index++] = ALPHA_ONE[1u];
+      for(Length digit = 0u; digit < 3u; ++digit)
+      {
+        webColor[index++] = digits[digit];
+        webColor[index++] = digits[digit];
+      }
     }
-    else if(7u == length) // 6 component web color #FF0000 (red)
+    else
     {
-      webColor.insert(0u, ALPHA_ONE);
+      if(7u == length) // 6 component web color #FF0000 (red)
+      {
+        webColor[index++] = ALPHA_ONE[0u];
+        webColor[index++] = ALPHA_ONE[1u];
+      }
+      for(Length digit = 0u; (digit + 1u < length) && (index < MAX_WEB_COLOR_LENGTH); ++digit)
+      {
+        webColor[index++] = digits[digit];
+      }
     }
 
-    UintColorToVector4(StringToHex(webColor.c_str()), retColor);
+    UintColorToVector4(StringToHex(webColor), retColor);
   }
   else if(TokenComparison(HEX_COLOR_TOKEN, colorStr, 2u))
   {
     UintColorToVector4(StringToHex(colorStr + 2u), retColor);
   }
-  else if(TokenComparison(BLACK_COLOR, colorStr, length))
-  {
-    retColor = Color::BLACK;
-  }
-  else if(TokenComparison(WHITE_COLOR, colorStr, length))
-  {
-    retColor = Color::WHITE;
-  }
-  else if(TokenComparison(RED_COLOR, colorStr, length))
+  else
   {
-    retColor = Color::RED;
-  }
-  else if(TokenComparison(GREEN_COLOR, colorStr, length))
-  {
-    retColor = Color::GREEN;
-  }
-  else if(TokenComparison(BLUE_COLOR, colorStr, length))
-  {
-    retColor = Color::BLUE;
-  }
-  else if(TokenComparison(YELLOW_COLOR, colorStr, length))
-  {
-    retColor = Color::YELLOW;
-  }
-  else if(TokenComparison(MAGENTA_COLOR, colorStr, length))
-  {
-    retColor = Color::MAGENTA;
-  }
-  else if(TokenComparison(CYAN_COLOR, colorStr, length))
-  {
-    retColor = Color::CYAN;
-  }
-  else if(TokenComparison(TRANSPARENT_COLOR, colorStr, length))
-  {
-    retColor = Color::TRANSPARENT;
+    const uint32_t color = NAMED_COLOR_TABLE.Find(colorStr, length, INVALID_NAMED_COLOR);
+    if(INVALID_NAMED_COLOR != color)
+    {
+      UintColorToVector4(color, retColor);
+    }
   }
 }
 
@@ -261,19 +264,9 @@ void Vector4ToColorString(const Vector4& value, std::string& vector2Str)
   const unsigned int green = static_cast<unsigned int>(255.f * value.g);
   const unsigned int blue  = static_cast<unsigned int>(255.f * value.b);
 
-  std::stringstream  ss;
-  const unsigned int size = 2u * sizeof(unsigned char);
-
-  ss << "0x"
-     << std::setfill('0') << std::setw(size)
-     << std::hex << alpha
-     << std::setfill('0') << std::setw(size)
-     << std::hex << red
-     << std::setfill('0') << std::setw(size)
-     << std::hex << green
-     << std::setfill('0') << std::setw(size)
-     << std::hex << blue;
-  vector2Str = ss.str();
+  char buffer[MAX_NUMBER_STRING_SIZE];
+  snprintf(buffer, MAX_NUMBER_STRING_SIZE, "0x%02x%02x%02x%02x", alpha, red, green, blue);
+  vector2Str = buffer;
 }
 
 void StringToVector2(const char* const vectorStr, Length length, Vector2& vector2)
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <string>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/text-definitions.h>
@@ -72,7 +73,7 @@ struct Tag
  *
  * @return @e true if both strings are equal.
  */
-bool TokenComparison(const std::string& string1, const char* const stringBuffer2, Length length);
+bool TokenComparison(std::string_view string1, const char* const stringBuffer2, Length length);
 
 /**
  * @brief Skips any unnecessary white space.
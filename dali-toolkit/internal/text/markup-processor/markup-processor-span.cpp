@@ -28,6 +28,7 @@
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-font.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-helper-functions.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-strikethrough.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-underline.h>
 #include <dali-toolkit/internal/text/markup-tags-and-attributes.h>
 
@@ -37,6 +38,46 @@ namespace Toolkit
 {
 namespace Text
 {
+namespace
+{
+enum class SpanAttribute
+{
+  UNKNOWN,
+  TEXT_COLOR,
+  BACKGROUND_COLOR,
+  FONT_FAMILY,
+  FONT_SIZE,
+  FONT_WEIGHT,
+  FONT_WIDTH,
+  FONT_SLANT,
+  UNDERLINE_COLOR,
+  UNDERLINE_HEIGHT,
+  UNDERLINE_TYPE,
+  UNDERLINE_DASH_GAP,
+  UNDERLINE_DASH_WIDTH,
+  STRIKETHROUGH_COLOR,
+  STRIKETHROUGH_HEIGHT,
+  CHARACTER_SPACING_VALUE
+};
+
+constexpr auto SPAN_ATTRIBUTE_TABLE = MakeTokenTable<SpanAttribute>({{MARKUP::SPAN_ATTRIBUTES::TEXT_COLOR, SpanAttribute::TEXT_COLOR},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::BACKGROUND_COLOR, SpanAttribute::BACKGROUND_COLOR},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::FONT_FAMILY, SpanAttribute::FONT_FAMILY},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::FONT_SIZE, SpanAttribute::FONT_SIZE},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::FONT_WEIGHT, SpanAttribute::FONT_WEIGHT},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::FONT_WIDTH, SpanAttribute::FONT_WIDTH},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::FONT_SLANT, SpanAttribute::FONT_SLANT},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::UNDERLINE_COLOR, SpanAttribute::UNDERLINE_COLOR},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::UNDERLINE_HEIGHT, SpanAttribute::UNDERLINE_HEIGHT},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::UNDERLINE_TYPE, SpanAttribute::UNDERLINE_TYPE},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_GAP, SpanAttribute::UNDERLINE_DASH_GAP},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_WIDTH, SpanAttribute::UNDERLINE_DASH_WIDTH},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_COLOR, SpanAttribute::STRIKETHROUGH_COLOR},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_HEIGHT, SpanAttribute::STRIKETHROUGH_HEIGHT},
+                                                                     {MARKUP::SPAN_ATTRIBUTES::CHARACTER_SPACING_VALUE, SpanAttribute::CHARACTER_SPACING_VALUE}});
+static_assert(SPAN_ATTRIBUTE_TABLE.GetMaxProbeLength() == 1u, "Every attribute should be found with a single comparison");
+} // namespace
+
 void ProcessSpanTag(const Tag&                    tag,
                     ColorRun&                     colorRun,
                     FontDescriptionRun&           fontRun,
@@ -58,80 +99,102 @@ void ProcessSpanTag(const Tag&                    tag,
   {
     const Attribute& attribute(*it);
 
-    if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::TEXT_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isColorDefined = true;
-      ProcessColor(attribute, colorRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::BACKGROUND_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isBackgroundColorDefined = true;
-      ProcessColor(attribute, backgroundColorRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_FAMILY, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontFamily(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_SIZE, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontSize(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_WEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontWeight(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontWidth(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::FONT_SLANT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isFontDefined = true;
-      ProcessFontSlant(attribute, fontRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessColorAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_HEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessHeightAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_TYPE, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessTypeAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_GAP, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessDashGapAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::UNDERLINE_DASH_WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      isUnderlinedCharacterDefined = true;
-      ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      isStrikethroughDefined = true;
-      ProcessColorAttribute(attribute, strikethroughRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::STRIKETHROUGH_HEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      isStrikethroughDefined = true;
-      ProcessHeightAttribute(attribute, strikethroughRun);
-    }
-    else if(TokenComparison(MARKUP::SPAN_ATTRIBUTES::CHARACTER_SPACING_VALUE, attribute.nameBuffer, attribute.nameLength))
+    switch(SPAN_ATTRIBUTE_TABLE.Find(attribute.nameBuffer, attribute.nameLength, SpanAttribute::UNKNOWN))
     {
-      isCharacterSpacingDefined = true;
-      ProcessValueAttribute(attribute, characterSpacingCharacterRun);
+      case SpanAttribute::TEXT_COLOR:
+      {
+        isColorDefined = true;
+        ProcessColor(attribute, colorRun);
+        break;
+      }
+      case SpanAttribute::BACKGROUND_COLOR:
+      {
+        isBackgroundColorDefined = true;
+        ProcessColor(attribute, backgroundColorRun);
+        break;
+      }
+      case SpanAttribute::FONT_FAMILY:
+      {
+        isFontDefined = true;
+        ProcessFontFamily(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_SIZE:
+      {
+        isFontDefined = true;
+        ProcessFontSize(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_WEIGHT:
+      {
+        isFontDefined = true;
+        ProcessFontWeight(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_WIDTH:
+      {
+        isFontDefined = true;
+        ProcessFontWidth(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::FONT_SLANT:
+      {
+        isFontDefined = true;
+        ProcessFontSlant(attribute, fontRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_COLOR:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessColorAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_HEIGHT:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessHeightAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_TYPE:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessTypeAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_DASH_GAP:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessDashGapAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNDERLINE_DASH_WIDTH:
+      {
+        isUnderlinedCharacterDefined = true;
+        ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case SpanAttribute::STRIKETHROUGH_COLOR:
+      {
+        isStrikethroughDefined = true;
+        ProcessColorAttribute(attribute, strikethroughRun);
+        break;
+      }
+      case SpanAttribute::STRIKETHROUGH_HEIGHT:
+      {
+        isStrikethroughDefined = true;
+        ProcessHeightAttribute(attribute, strikethroughRun);
+        break;
+      }
+      case SpanAttribute::CHARACTER_SPACING_VALUE:
+      {
+        isCharacterSpacingDefined = true;
+        ProcessValueAttribute(attribute, characterSpacingCharacterRun);
+        break;
+      }
+      case SpanAttribute::UNKNOWN:
+      {
+        break;
+      }
     }
   }
 }
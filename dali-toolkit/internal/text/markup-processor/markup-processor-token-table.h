@@ -0,0 +1,252 @@
+#ifndef DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_TOKEN_TABLE_H
+#define DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_TOKEN_TABLE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Converts an ASCII upper case character to lower case. Any other character is returned as it is.
+ *
+ * @param[in] character The character.
+ *
+ * @return The lower case character.
+ */
+constexpr char ToLowerAscii(char character)
+{
+  return ((character >= 'A') && (character <= 'Z')) ? static_cast<char>(character + ('a' - 'A')) : character;
+}
+
+/**
+ * @brief Hashes a token with FNV-1a.
+ *
+ * @tparam CaseSensitive Whether upper and lower case characters hash differently.
+ *
+ * @param[in] buffer Pointer to the token buffer.
+ * @param[in] length The length of the token.
+ * @param[in] seed Changes the hash of every token.
+ *
+ * @return The hash of the token.
+ */
+template<bool CaseSensitive>
+constexpr uint32_t HashToken(const char* const buffer, std::size_t length, uint32_t seed = 0u)
+{
+  uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+  for(std::size_t index = 0u; index < length; ++index)
+  {
+    const char character = CaseSensitive ? buffer[index] : ToLowerAscii(buffer[index]);
+    hash                 = (hash ^ static_cast<uint8_t>(character)) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * @brief A hash table of html-ish tokens built at compile time.
+ *
+ * It maps the tag names, attribute names and other keywords of the mark-up to values,
+ * so the parser finds a token with a single hash of its buffer and usually a single
+ * comparison, instead of comparing it with every token in turn.
+ *
+ * The table is open addressed with at most a quarter of its slots used, so it never allocates.
+ * Its hash is seeded so that the tokens don't collide whenever such a seed is found,
+ * which makes it a perfect hash table for the small sets of tags and attributes.
+ * The tokens must be lower case unless the table is case sensitive, as the buffers
+ * being looked up are transformed to lower case (see TokenComparison()).
+ *
+ * @code
+ * constexpr auto TABLE = MakeTokenTable<TokenType>({{MARKUP::TAG::COLOR, TokenType::COLOR}, {MARKUP::TAG::FONT, TokenType::FONT}});
+ * static_assert(TABLE.GetMaxProbeLength() == 1u, "Tokens collide");
+ * @endcode
+ *
+ * @tparam Value The type of the values.
+ * @tparam Count The number of tokens.
+ * @tparam CaseSensitive Whether the lookup is case sensitive.
+ */
+template<typename Value, std::size_t Count, bool CaseSensitive>
+class TokenTable
+{
+public:
+  using Entry = std::pair<std::string_view, Value>;
+
+  /**
+   * @brief Builds the table.
+   *
+   * @param[in] entries The tokens and their values. The tokens must be unique.
+   */
+  constexpr explicit TokenTable(const Entry (&entries)[Count])
+  : mSlots{}
+  {
+    // Look for a seed that hashes every token to a different slot, so any lookup is a single comparison.
+    // Large tables rarely have one, and keep the seed with the shortest probes instead.
+    uint32_t    bestSeed        = 0u;
+    std::size_t bestProbeLength = Count + 1u;
+    for(uint32_t seed = 0u; (seed < MAX_SEED_ATTEMPTS) && (bestProbeLength > 1u); ++seed)
+    {
+      Build(entries, seed);
+      if(mMaxProbeLength < bestProbeLength)
+      {
+        bestSeed        = seed;
+        bestProbeLength = mMaxProbeLength;
+      }
+    }
+    if(mSeed != bestSeed)
+    {
+      Build(entries, bestSeed);
+    }
+  }
+
+  /**
+   * @brief Finds the value of a token.
+   *
+   * @param[in] buffer Pointer to the token buffer.
+   * @param[in] length The length of the token.
+   * @param[in] notFound The value returned if the token is not in the table.
+   *
+   * @return The value of the token, or @p notFound.
+   */
+  constexpr Value Find(const char* const buffer, std::size_t length, Value notFound) const
+  {
+    for(std::size_t slotIndex = HashToken<CaseSensitive>(buffer, length, mSeed) & SLOT_MASK;
+        mSlots[slotIndex].used;
+        slotIndex = (slotIndex + 1u) & SLOT_MASK)
+    {
+      if(IsEqual(mSlots[slotIndex].token, buffer, length))
+      {
+        return mSlots[slotIndex].value;
+      }
+    }
+    return notFound;
+  }
+
+  /**
+   * @brief Retrieves the largest number of slots looked at to find any token of the table.
+   *
+   * @return The maximum probe length. It is 1 when no tokens collide.
+   */
+  constexpr std::size_t GetMaxProbeLength() const
+  {
+    return mMaxProbeLength;
+  }
+
+private:
+  static constexpr std::size_t GetSlotCount()
+  {
+    std::size_t slotCount = 2u;
+    while(slotCount < 4u * Count)
+    {
+      slotCount <<= 1u;
+    }
+    return slotCount;
+  }
+
+  /**
+   * @brief Fills the slots with the given seed, and sets the maximum probe length.
+   */
+  constexpr void Build(const Entry (&entries)[Count], uint32_t seed)
+  {
+    for(std::size_t slotIndex = 0u; slotIndex < SLOT_COUNT; ++slotIndex)
+    {
+      mSlots[slotIndex] = Slot{};
+    }
+    mSeed           = seed;
+    mMaxProbeLength = 0u;
+
+    for(std::size_t index = 0u; index < Count; ++index)
+    {
+      const std::string_view token = entries[index].first;
+
+      std::size_t slotIndex   = HashToken<CaseSensitive>(token.data(), token.size(), seed) & SLOT_MASK;
+      std::size_t probeLength = 1u;
+      for(; mSlots[slotIndex].used; slotIndex = (slotIndex + 1u) & SLOT_MASK)
+      {
+        ++probeLength;
+      }
+
+      mSlots[slotIndex].token = token;
+      mSlots[slotIndex].value = entries[index].second;
+      mSlots[slotIndex].used  = true;
+
+      mMaxProbeLength = (probeLength > mMaxProbeLength) ? probeLength : mMaxProbeLength;
+    }
+  }
+
+  static constexpr bool IsEqual(std::string_view token, const char* const buffer, std::size_t length)
+  {
+    if(token.size() != length)
+    {
+      return false;
+    }
+    for(std::size_t index = 0u; index < length; ++index)
+    {
+      if(token[index] != (CaseSensitive ? buffer[index] : ToLowerAscii(buffer[index])))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  struct Slot
+  {
+    std::string_view token{};
+    Value            value{};
+    bool             used{false};
+  };
+
+  static constexpr uint32_t    MAX_SEED_ATTEMPTS = 32u;
+  static constexpr std::size_t SLOT_COUNT        = GetSlotCount();
+  static constexpr std::size_t SLOT_MASK         = SLOT_COUNT - 1u;
+
+  Slot        mSlots[SLOT_COUNT];
+  uint32_t    mSeed{0u};
+  std::size_t mMaxProbeLength{0u};
+};
+
+/**
+ * @brief Creates a token table, deducing the number of tokens.
+ *
+ * @tparam Value The type of the values.
+ * @tparam CaseSensitive Whether the lookup is case sensitive.
+ *
+ * @param[in] entries The tokens and their values.
+ *
+ * @return The token table.
+ */
+template<typename Value, bool CaseSensitive = false, std::size_t Count>
+constexpr TokenTable<Value, Count, CaseSensitive> MakeTokenTable(const std::pair<std::string_view, Value> (&entries)[Count])
+{
+  return TokenTable<Value, Count, CaseSensitive>(entries);
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_MARKUP_PROCESSOR_TOKEN_TABLE_H
@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-attribute-helper-functions.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-helper-functions.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
 #include <dali-toolkit/internal/text/markup-tags-and-attributes.h>
 #include <dali-toolkit/internal/text/text-effects-style.h>
 #include <dali-toolkit/internal/text/underlined-character-run.h>
@@ -38,6 +39,23 @@ namespace
 {
 const unsigned int MAX_TYPE_ATTRIBUTE_SIZE = 7u; ///< The maximum length of any of the possible 'type' values.
 
+enum class UnderlineAttribute
+{
+  UNKNOWN,
+  COLOR,
+  HEIGHT,
+  TYPE,
+  DASH_GAP,
+  DASH_WIDTH
+};
+
+constexpr auto UNDERLINE_ATTRIBUTE_TABLE = MakeTokenTable<UnderlineAttribute>({{MARKUP::UNDERLINE_ATTRIBUTES::COLOR, UnderlineAttribute::COLOR},
+                                                                               {MARKUP::UNDERLINE_ATTRIBUTES::HEIGHT, UnderlineAttribute::HEIGHT},
+                                                                               {MARKUP::UNDERLINE_ATTRIBUTES::TYPE, UnderlineAttribute::TYPE},
+                                                                               {MARKUP::UNDERLINE_ATTRIBUTES::DASH_GAP, UnderlineAttribute::DASH_GAP},
+                                                                               {MARKUP::UNDERLINE_ATTRIBUTES::DASH_WIDTH, UnderlineAttribute::DASH_WIDTH}});
+static_assert(UNDERLINE_ATTRIBUTE_TABLE.GetMaxProbeLength() == 1u, "Every attribute should be found with a single comparison");
+
 } // namespace
 
 void ProcessTypeAttribute(const Attribute& attribute, UnderlinedCharacterRun& underlinedCharacterRun)
@@ -80,25 +98,37 @@ void ProcessUnderlineTag(const Tag& tag, UnderlinedCharacterRun& underlinedChara
   {
     const Attribute& attribute(*it);
 
-    if(TokenComparison(MARKUP::UNDERLINE_ATTRIBUTES::COLOR, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessColorAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::UNDERLINE_ATTRIBUTES::HEIGHT, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessHeightAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::UNDERLINE_ATTRIBUTES::TYPE, attribute.nameBuffer, attribute.nameLength))
+    switch(UNDERLINE_ATTRIBUTE_TABLE.Find(attribute.nameBuffer, attribute.nameLength, UnderlineAttribute::UNKNOWN))
     {
-      ProcessTypeAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::UNDERLINE_ATTRIBUTES::DASH_GAP, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessDashGapAttribute(attribute, underlinedCharacterRun);
-    }
-    else if(TokenComparison(MARKUP::UNDERLINE_ATTRIBUTES::DASH_WIDTH, attribute.nameBuffer, attribute.nameLength))
-    {
-      ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
+      case UnderlineAttribute::COLOR:
+      {
+        ProcessColorAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case UnderlineAttribute::HEIGHT:
+      {
+        ProcessHeightAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case UnderlineAttribute::TYPE:
+      {
+        ProcessTypeAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case UnderlineAttribute::DASH_GAP:
+      {
+        ProcessDashGapAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case UnderlineAttribute::DASH_WIDTH:
+      {
+        ProcessDashWidthAttribute(attribute, underlinedCharacterRun);
+        break;
+      }
+      case UnderlineAttribute::UNKNOWN:
+      {
+        break;
+      }
     }
   }
 }
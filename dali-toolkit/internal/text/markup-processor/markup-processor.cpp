@@ -21,7 +21,6 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <climits> // for ULONG_MAX
-#include <functional>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-set-conversion.h>
@@ -35,6 +34,7 @@
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-paragraph.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-span.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-strikethrough.h>
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
 #include <dali-toolkit/internal/text/markup-processor/markup-processor-underline.h>
 #include <dali-toolkit/internal/text/markup-tags-and-attributes.h>
 #include <dali-toolkit/internal/text/xhtml-entities.h>
@@ -68,9 +68,50 @@ const char NEW_LINE    = 0x0A; // ASCII value of the newline.
 const unsigned long XHTML_DECIMAL_ENTITY_RANGE[] = {0x0u, 0xD7FFu, 0xE000u, 0xFFFDu, 0x10000u, 0x10FFFFu};
 
 // The MAX_NUM_OF_ATTRIBUTES is the number of attributes in span tag "markup-processor-span.cpp". Because it contains the maximum number of attributes in  all tags.
-const unsigned int MAX_NUM_OF_ATTRIBUTES = 14u; ///< The span tag has the 'font-family', 'font-size' 'font-weight', 'font-width', 'font-slant','text-color', 'u-color', 'u-height','u-type','u-dash-gap', 'u-dash-width', 's-color', 's-height' and 'char-space-value' attrubutes.
+// The attributes of every tag are parsed into the same vector, which is reserved once with this capacity.
+const unsigned int MAX_NUM_OF_ATTRIBUTES = 15u; ///< The span tag has the 'font-family', 'font-size' 'font-weight', 'font-width', 'font-slant','text-color', 'background-color', 'u-color', 'u-height','u-type','u-dash-gap', 'u-dash-width', 's-color', 's-height' and 'char-space-value' attrubutes.
 const unsigned int DEFAULT_VECTOR_SIZE   = 16u; ///< Default size of run vectors.
 
+/**
+ * @brief The tags known by the markup processor.
+ */
+enum class TagType
+{
+  UNKNOWN,
+  COLOR,
+  ITALIC,
+  UNDERLINE,
+  BOLD,
+  FONT,
+  ANCHOR,
+  SHADOW,
+  GLOW,
+  OUTLINE,
+  EMBEDDED_ITEM,
+  BACKGROUND,
+  SPAN,
+  STRIKETHROUGH,
+  PARAGRAPH,
+  CHARACTER_SPACING
+};
+
+constexpr auto TAG_TABLE = MakeTokenTable<TagType>({{MARKUP::TAG::COLOR, TagType::COLOR},
+                                                    {MARKUP::TAG::ITALIC, TagType::ITALIC},
+                                                    {MARKUP::TAG::UNDERLINE, TagType::UNDERLINE},
+                                                    {MARKUP::TAG::BOLD, TagType::BOLD},
+                                                    {MARKUP::TAG::FONT, TagType::FONT},
+                                                    {MARKUP::TAG::ANCHOR, TagType::ANCHOR},
+                                                    {MARKUP::TAG::SHADOW, TagType::SHADOW},
+                                                    {MARKUP::TAG::GLOW, TagType::GLOW},
+                                                    {MARKUP::TAG::OUTLINE, TagType::OUTLINE},
+                                                    {MARKUP::TAG::EMBEDDED_ITEM, TagType::EMBEDDED_ITEM},
+                                                    {MARKUP::TAG::BACKGROUND, TagType::BACKGROUND},
+                                                    {MARKUP::TAG::SPAN, TagType::SPAN},
+                                                    {MARKUP::TAG::STRIKETHROUGH, TagType::STRIKETHROUGH},
+                                                    {MARKUP::TAG::PARAGRAPH, TagType::PARAGRAPH},
+                                                    {MARKUP::TAG::CHARACTER_SPACING, TagType::CHARACTER_SPACING}});
+static_assert(TAG_TABLE.GetMaxProbeLength() == 1u, "Every tag should be found with a single comparison");
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_MARKUP_PROCESSOR");
 #endif
@@ -278,8 +319,6 @@ void ParseAttributes(Tag& tag)
     return;
   }
 
-  tag.attributes.Resize(MAX_NUM_OF_ATTRIBUTES);
-
   // Find first the tag name.
   bool isQuotationOpen = false;
 
@@ -303,11 +342,10 @@ void ParseAttributes(Tag& tag)
   SkipWhiteSpace(tagBuffer, tagEndBuffer);
 
   // Find the attributes.
-  unsigned int attributeIndex = 0u;
-  const char*  nameBuffer     = NULL;
-  const char*  valueBuffer    = NULL;
-  Length       nameLength     = 0u;
-  Length       valueLength    = 0u;
+  const char* nameBuffer  = NULL;
+  const char* valueBuffer = NULL;
+  Length      nameLength  = 0u;
+  Length      valueLength = 0u;
 
   bool   addToNameValue     = true;
   Length numberOfWhiteSpace = 0u;
@@ -325,13 +363,7 @@ void ParseAttributes(Tag& tag)
       if((NULL != nameBuffer) && (NULL != valueBuffer))
       {
         // Every time a white space is found, a new attribute is created and stored in the attributes vector.
-        Attribute& attribute = *(tag.attributes.Begin() + attributeIndex);
-        ++attributeIndex;
-
-        attribute.nameBuffer  = nameBuffer;
-        attribute.valueBuffer = valueBuffer;
-        attribute.nameLength  = nameLength;
-        attribute.valueLength = valueLength;
+        tag.attributes.PushBack(Attribute{nameBuffer, valueBuffer, nameLength, valueLength});
 
         nameBuffer  = NULL;
         valueBuffer = NULL;
@@ -407,17 +439,8 @@ void ParseAttributes(Tag& tag)
   if((NULL != nameBuffer) && (NULL != valueBuffer))
   {
     // Checks if the last attribute needs to be added.
-    Attribute& attribute = *(tag.attributes.Begin() + attributeIndex);
-    ++attributeIndex;
-
-    attribute.nameBuffer  = nameBuffer;
-    attribute.valueBuffer = valueBuffer;
-    attribute.nameLength  = nameLength;
-    attribute.valueLength = valueLength;
+    tag.attributes.PushBack(Attribute{nameBuffer, valueBuffer, nameLength, valueLength});
   }
-
-  // Resize the vector of attributes.
-  tag.attributes.Resize(attributeIndex);
 }
 
 /**
@@ -617,6 +640,7 @@ bool XHTMLNumericEntityToUtf8(const char* markupText, char* utf8)
  * @brief Processes a particular tag for the required run (color-run, font-run or underlined-character-run).
  *
  * @tparam RunType Whether ColorRun , FontDescriptionRun or UnderlinedCharacterRun
+ * @tparam ParameterSettingFunction A callable taking the tag and the run, so it's inlined rather than wrapped in a std::function
  *
  * @param[in/out] runsContainer The container containing all the runs
  * @param[in/out] styleStack The style stack
@@ -626,15 +650,15 @@ bool XHTMLNumericEntityToUtf8(const char* markupText, char* utf8)
  * @param[in/out] tagReference The tagReference we should increment/decrement
  * @param[in] parameterSettingFunction This function will be called to set run specific parameters
  */
-template<typename RunType>
+template<typename RunType, typename ParameterSettingFunction>
 void ProcessTagForRun(
-  Vector<RunType>&                          runsContainer,
-  StyleStack<RunIndex>&                     styleStack,
-  const Tag&                                tag,
-  const CharacterIndex                      characterIndex,
-  RunIndex&                                 runIndex,
-  int&                                      tagReference,
-  std::function<void(const Tag&, RunType&)> parameterSettingFunction)
+  Vector<RunType>&                runsContainer,
+  StyleStack<RunIndex>&           styleStack,
+  const Tag&                      tag,
+  const CharacterIndex            characterIndex,
+  RunIndex&                       runIndex,
+  int&                            tagReference,
+  const ParameterSettingFunction& parameterSettingFunction)
 {
   if(!tag.isEndTag)
   {
@@ -679,7 +703,7 @@ void ProcessTagForRun(
  */
 void ProcessItemTag(
   MarkupProcessData& markupProcessData,
-  const Tag          tag,
+  const Tag&         tag,
   CharacterIndex&    characterIndex)
 {
   if(tag.isEndTag)
@@ -707,7 +731,7 @@ void ProcessItemTag(
  */
 void ProcessParagraphTag(
   MarkupProcessData& markupProcessData,
-  const Tag          tag,
+  const Tag&         tag,
   bool               isEndBuffer,
   CharacterIndex&    characterIndex)
 {
@@ -1193,7 +1217,10 @@ void ProcessMarkupString(const std::string& markupString, MarkupPropertyData& ma
   const char*       markupStringBuffer    = markupString.c_str();
   const char* const markupStringEndBuffer = markupStringBuffer + markupStringSize;
 
-  Tag            tag;
+  // The tag is reused, so parsing the tags doesn't allocate.
+  Tag tag;
+  tag.attributes.Reserve(MAX_NUM_OF_ATTRIBUTES);
+
   CharacterIndex characterIndex = 0u;
   for(; markupStringBuffer < markupStringEndBuffer;)
   {
@@ -1202,109 +1229,131 @@ void ProcessMarkupString(const std::string& markupString, MarkupPropertyData& ma
              markupStringEndBuffer,
              tag))
     {
-      if(TokenComparison(MARKUP::TAG::COLOR, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<ColorRun>(
-          markupProcessData.colorRuns, styleStack, tag, characterIndex, colorRunIndex, colorTagReference, [](const Tag& tag, ColorRun& run) { ProcessColorTag(tag, run); });
-      } // <color></color>
-      else if(TokenComparison(MARKUP::TAG::ITALIC, tag.buffer, tag.length))
+      switch(TAG_TABLE.Find(tag.buffer, tag.length, TagType::UNKNOWN))
       {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, iTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
-            fontRun.slant        = TextAbstraction::FontSlant::ITALIC;
-            fontRun.slantDefined = true;
-          });
-      } // <i></i>
-      else if(TokenComparison(MARKUP::TAG::UNDERLINE, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<UnderlinedCharacterRun>(
-          markupProcessData.underlinedCharacterRuns, styleStack, tag, characterIndex, underlinedCharacterRunIndex, uTagReference, [](const Tag& tag, UnderlinedCharacterRun& run) { ProcessUnderlineTag(tag, run); });
-      } // <u></u>
-      else if(TokenComparison(MARKUP::TAG::BOLD, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, bTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
-            fontRun.weight        = TextAbstraction::FontWeight::BOLD;
-            fontRun.weightDefined = true;
-          });
-      } // <b></b>
-      else if(TokenComparison(MARKUP::TAG::FONT, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<FontDescriptionRun>(
-          markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, fontTagReference, [](const Tag& tag, FontDescriptionRun& fontRun) { ProcessFontTag(tag, fontRun); });
-      } // <font></font>
-      else if(TokenComparison(MARKUP::TAG::ANCHOR, tag.buffer, tag.length))
-      {
-        ProcessAnchorForRun(markupProcessData,
-                            markupPropertyData,
-                            tag,
-                            anchorStack,
+        case TagType::COLOR:
+        {
+          ProcessTagForRun<ColorRun>(
+            markupProcessData.colorRuns, styleStack, tag, characterIndex, colorRunIndex, colorTagReference, [](const Tag& tag, ColorRun& run) { ProcessColorTag(tag, run); });
+          break;
+        } // <color></color>
+        case TagType::ITALIC:
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, iTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
+              fontRun.slant        = TextAbstraction::FontSlant::ITALIC;
+              fontRun.slantDefined = true;
+            });
+          break;
+        } // <i></i>
+        case TagType::UNDERLINE:
+        {
+          ProcessTagForRun<UnderlinedCharacterRun>(
+            markupProcessData.underlinedCharacterRuns, styleStack, tag, characterIndex, underlinedCharacterRunIndex, uTagReference, [](const Tag& tag, UnderlinedCharacterRun& run) { ProcessUnderlineTag(tag, run); });
+          break;
+        } // <u></u>
+        case TagType::BOLD:
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, bTagReference, [](const Tag&, FontDescriptionRun& fontRun) {
+              fontRun.weight        = TextAbstraction::FontWeight::BOLD;
+              fontRun.weightDefined = true;
+            });
+          break;
+        } // <b></b>
+        case TagType::FONT:
+        {
+          ProcessTagForRun<FontDescriptionRun>(
+            markupProcessData.fontRuns, styleStack, tag, characterIndex, fontRunIndex, fontTagReference, [](const Tag& tag, FontDescriptionRun& fontRun) { ProcessFontTag(tag, fontRun); });
+          break;
+        } // <font></font>
+        case TagType::ANCHOR:
+        {
+          ProcessAnchorForRun(markupProcessData,
+                              markupPropertyData,
+                              tag,
+                              anchorStack,
+                              markupProcessData.colorRuns,
+                              markupProcessData.underlinedCharacterRuns,
+                              colorRunIndex,
+                              underlinedCharacterRunIndex,
+                              characterIndex,
+                              aTagReference);
+          break;
+        } // <a href=https://www.tizen.org>tizen</a>
+        case TagType::SHADOW:
+        {
+          // TODO: If !tag.isEndTag, then create a new shadow run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        } // <shadow></shadow>
+        case TagType::GLOW:
+        {
+          // TODO: If !tag.isEndTag, then create a new glow run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        } // <glow></glow>
+        case TagType::OUTLINE:
+        {
+          // TODO: If !tag.isEndTag, then create a new outline run.
+          //       else Pop the top of the stack and set the number of characters of the run.
+          break;
+        } // <outline></outline>
+        case TagType::EMBEDDED_ITEM:
+        {
+          ProcessItemTag(markupProcessData, tag, characterIndex);
+          break;
+        }
+        case TagType::BACKGROUND:
+        {
+          ProcessTagForRun<ColorRun>(
+            markupProcessData.backgroundColorRuns, styleStack, tag, characterIndex, backgroundRunIndex, backgroundTagReference, [](const Tag& tag, ColorRun& run) { ProcessBackground(tag, run); });
+          break;
+        }
+        case TagType::SPAN:
+        {
+          ProcessSpanForRun(tag,
+                            spanStack,
                             markupProcessData.colorRuns,
+                            markupProcessData.fontRuns,
                             markupProcessData.underlinedCharacterRuns,
+                            markupProcessData.backgroundColorRuns,
+                            markupProcessData.strikethroughCharacterRuns,
+                            markupProcessData.characterSpacingCharacterRuns,
                             colorRunIndex,
+                            fontRunIndex,
                             underlinedCharacterRunIndex,
+                            backgroundRunIndex,
+                            strikethroughCharacterRunIndex,
+                            characterSpacingCharacterRunIndex,
                             characterIndex,
-                            aTagReference);
-      } // <a href=https://www.tizen.org>tizen</a>
-      else if(TokenComparison(MARKUP::TAG::SHADOW, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new shadow run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <shadow></shadow>
-      else if(TokenComparison(MARKUP::TAG::GLOW, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new glow run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <glow></glow>
-      else if(TokenComparison(MARKUP::TAG::OUTLINE, tag.buffer, tag.length))
-      {
-        // TODO: If !tag.isEndTag, then create a new outline run.
-        //       else Pop the top of the stack and set the number of characters of the run.
-      } // <outline></outline>
-      else if(TokenComparison(MARKUP::TAG::EMBEDDED_ITEM, tag.buffer, tag.length))
-      {
-        ProcessItemTag(markupProcessData, tag, characterIndex);
-      }
-      else if(TokenComparison(MARKUP::TAG::BACKGROUND, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<ColorRun>(
-          markupProcessData.backgroundColorRuns, styleStack, tag, characterIndex, backgroundRunIndex, backgroundTagReference, [](const Tag& tag, ColorRun& run) { ProcessBackground(tag, run); });
-      }
-      else if(TokenComparison(MARKUP::TAG::SPAN, tag.buffer, tag.length))
-      {
-        ProcessSpanForRun(tag,
-                          spanStack,
-                          markupProcessData.colorRuns,
-                          markupProcessData.fontRuns,
-                          markupProcessData.underlinedCharacterRuns,
-                          markupProcessData.backgroundColorRuns,
-                          markupProcessData.strikethroughCharacterRuns,
-                          markupProcessData.characterSpacingCharacterRuns,
-                          colorRunIndex,
-                          fontRunIndex,
-                          underlinedCharacterRunIndex,
-                          backgroundRunIndex,
-                          strikethroughCharacterRunIndex,
-                          characterSpacingCharacterRunIndex,
-                          characterIndex,
-                          spanTagReference);
+                            spanTagReference);
+          break;
+        }
+        case TagType::STRIKETHROUGH:
+        {
+          ProcessTagForRun<StrikethroughCharacterRun>(
+            markupProcessData.strikethroughCharacterRuns, styleStack, tag, characterIndex, strikethroughCharacterRunIndex, sTagReference, [](const Tag& tag, StrikethroughCharacterRun& run) { ProcessStrikethroughTag(tag, run); });
+          break;
+        } // <s></s>
+        case TagType::PARAGRAPH:
+        {
+          ProcessParagraphTag(markupProcessData, tag, (markupStringBuffer == markupStringEndBuffer), characterIndex);
+          ProcessTagForRun<BoundedParagraphRun>(
+            markupProcessData.boundedParagraphRuns, styleStack, tag, characterIndex, boundedParagraphRunIndex, pTagReference, [](const Tag& tag, BoundedParagraphRun& run) { ProcessAttributesOfParagraphTag(tag, run); });
+          break;
+        } // <p></p>
+        case TagType::CHARACTER_SPACING:
+        {
+          ProcessTagForRun<CharacterSpacingCharacterRun>(
+            markupProcessData.characterSpacingCharacterRuns, styleStack, tag, characterIndex, characterSpacingCharacterRunIndex, characterSpacingTagReference, [](const Tag& tag, CharacterSpacingCharacterRun& run) { ProcessCharacterSpacingTag(tag, run); });
+          break;
+        } // <char-spacing></char-spacing>
+        case TagType::UNKNOWN:
+        {
+          break;
+        }
       }
-      else if(TokenComparison(MARKUP::TAG::STRIKETHROUGH, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<StrikethroughCharacterRun>(
-          markupProcessData.strikethroughCharacterRuns, styleStack, tag, characterIndex, strikethroughCharacterRunIndex, sTagReference, [](const Tag& tag, StrikethroughCharacterRun& run) { ProcessStrikethroughTag(tag, run); });
-      } // <s></s>
-      else if(TokenComparison(MARKUP::TAG::PARAGRAPH, tag.buffer, tag.length))
-      {
-        ProcessParagraphTag(markupProcessData, tag, (markupStringBuffer == markupStringEndBuffer), characterIndex);
-        ProcessTagForRun<BoundedParagraphRun>(
-          markupProcessData.boundedParagraphRuns, styleStack, tag, characterIndex, boundedParagraphRunIndex, pTagReference, [](const Tag& tag, BoundedParagraphRun& run) { ProcessAttributesOfParagraphTag(tag, run); });
-      } // <p></p>
-      else if(TokenComparison(MARKUP::TAG::CHARACTER_SPACING, tag.buffer, tag.length))
-      {
-        ProcessTagForRun<CharacterSpacingCharacterRun>(
-          markupProcessData.characterSpacingCharacterRuns, styleStack, tag, characterIndex, characterSpacingCharacterRunIndex, characterSpacingTagReference, [](const Tag& tag, CharacterSpacingCharacterRun& run) { ProcessCharacterSpacingTag(tag, run); });
-      } // <char-spacing></char-spacing>
     }   // end if( IsTag() )
     else if(markupStringBuffer < markupStringEndBuffer)
     {
@@ -19,7 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
-#include <string>
+#include <string_view>
 
 namespace Dali
 {
@@ -58,7 +58,7 @@ namespace TAG
  * @see COLOR_ATTRIBUTES
  *
  */
-static const std::string COLOR("color");
+static constexpr std::string_view COLOR("color");
 
 /**
  * @brief Sets the font values for the characters inside the element.
@@ -72,7 +72,7 @@ static const std::string COLOR("color");
  *
  * @see FONT_ATTRIBUTES
  */
-static const std::string FONT("font");
+static constexpr std::string_view FONT("font");
 
 /**
  * @brief Sets Bold decoration for the characters inside the element.
@@ -86,7 +86,7 @@ static const std::string FONT("font");
  *
  * @see
  */
-static const std::string BOLD("b");
+static constexpr std::string_view BOLD("b");
 
 /**
  * @brief Sets Italic decoration for the characters inside the element.
@@ -99,7 +99,7 @@ static const std::string BOLD("b");
  * @endcode
  *
  */
-static const std::string ITALIC("i");
+static constexpr std::string_view ITALIC("i");
 
 /**
  * @brief Sets the underlined values for the characters inside the element.
@@ -113,25 +113,25 @@ static const std::string ITALIC("i");
  *
  * @see UNDERLINE_ATTRIBUTES
  */
-static const std::string UNDERLINE("u");
+static constexpr std::string_view UNDERLINE("u");
 
 /**
  * @todo Sets the shadow for the characters inside the element.
  *
  */
-static const std::string SHADOW("shadow"); ///< This tag under construction.
+static constexpr std::string_view SHADOW("shadow"); ///< This tag under construction.
 
 /**
  * @todo Sets the glow for the characters inside the element.
  *
  */
-static const std::string GLOW("glow"); ///< This tag under construction.
+static constexpr std::string_view GLOW("glow"); ///< This tag under construction.
 
 /**
  * @todo Sets the outline for the characters inside the element.
  *
  */
-static const std::string OUTLINE("outline"); ///< This tag under construction.
+static constexpr std::string_view OUTLINE("outline"); ///< This tag under construction.
 
 /**
  * @brief Defines an embedded item within the text.
@@ -145,7 +145,7 @@ static const std::string OUTLINE("outline"); ///< This tag under construction.
  *
  * @see EMBEDDED_ITEM_ATTRIBUTES
  */
-static const std::string EMBEDDED_ITEM("item");
+static constexpr std::string_view EMBEDDED_ITEM("item");
 
 /**
  * @brief Defines a hyperlink for the text inside the element.
@@ -159,7 +159,7 @@ static const std::string EMBEDDED_ITEM("item");
  *
  * @see ANCHOR_ATTRIBUTES
  */
-static const std::string ANCHOR("a");
+static constexpr std::string_view ANCHOR("a");
 
 /**
  * @brief Sets the background color for the characters inside the element.
@@ -173,7 +173,7 @@ static const std::string ANCHOR("a");
  *
  * @see BACKGROUND_ATTRIBUTES
  */
-static const std::string BACKGROUND("background");
+static constexpr std::string_view BACKGROUND("background");
 
 /**
  * @brief Use span tag to set many styles on character's level for the characters inside the element.
@@ -187,7 +187,7 @@ static const std::string BACKGROUND("background");
  *
  * @see SPAN_ATTRIBUTES
  */
-static const std::string SPAN("span");
+static constexpr std::string_view SPAN("span");
 
 /**
  * @brief Sets the strikethrough values for the characters inside the element.
@@ -201,7 +201,7 @@ static const std::string SPAN("span");
  *
  * @see STRIKETHROUGH_ATTRIBUTES
  */
-static const std::string STRIKETHROUGH("s");
+static constexpr std::string_view STRIKETHROUGH("s");
 
 /**
  * @brief Use paragraph tag to set many styles on paragraph's level for the lines inside the element.
@@ -215,7 +215,7 @@ static const std::string STRIKETHROUGH("s");
  *
  * @see PARAGRAPH_ATTRIBUTES
  */
-static const std::string PARAGRAPH("p");
+static constexpr std::string_view PARAGRAPH("p");
 
 /**
  * @brief Sets the character spacing values for the characters inside the element.
@@ -229,7 +229,7 @@ static const std::string PARAGRAPH("p");
  *
  * @see CHARACTER_SPACING_ATTRIBUTES
  */
-static const std::string CHARACTER_SPACING("char-spacing");
+static constexpr std::string_view CHARACTER_SPACING("char-spacing");
 } // namespace TAG
 
 namespace COLOR_ATTRIBUTES
@@ -252,7 +252,7 @@ namespace COLOR_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string VALUE("value");
+static constexpr std::string_view VALUE("value");
 } // namespace COLOR_ATTRIBUTES
 
 namespace FONT_ATTRIBUTES
@@ -268,7 +268,7 @@ namespace FONT_ATTRIBUTES
  * @endcode
  *
  */
-static const std::string FAMILY("family");
+static constexpr std::string_view FAMILY("family");
 
 /**
  * @brief Use the size attribute to define the font size in points.
@@ -281,7 +281,7 @@ static const std::string FAMILY("family");
  * @endcode
  *
  */
-static const std::string SIZE("size");
+static constexpr std::string_view SIZE("size");
 
 /**
  * @brief Use the weight attribute to define the font weight.
@@ -294,7 +294,7 @@ static const std::string SIZE("size");
  * @endcode
  *
  */
-static const std::string WEIGHT("weight");
+static constexpr std::string_view WEIGHT("weight");
 
 /**
  * @brief Use the width attribute to define the font width.
@@ -307,7 +307,7 @@ static const std::string WEIGHT("weight");
  * @endcode
  *
  */
-static const std::string WIDTH("width");
+static constexpr std::string_view WIDTH("width");
 
 /**
  * @brief Use the slant attribute to define the font slant.
@@ -320,7 +320,7 @@ static const std::string WIDTH("width");
  * @endcode
  *
  */
-static const std::string SLANT("slant");
+static constexpr std::string_view SLANT("slant");
 } // namespace FONT_ATTRIBUTES
 
 namespace UNDERLINE_ATTRIBUTES
@@ -337,7 +337,7 @@ namespace UNDERLINE_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string COLOR("color");
+static constexpr std::string_view COLOR("color");
 
 /**
  * @brief Use the height attribute to define the height of underline.
@@ -350,7 +350,7 @@ static const std::string COLOR("color");
  *
  * @endcode
  */
-static const std::string HEIGHT("height");
+static constexpr std::string_view HEIGHT("height");
 
 /**
  * @brief Use the type attribute to define the type of underline.
@@ -364,7 +364,7 @@ static const std::string HEIGHT("height");
  *
  * @endcode
  */
-static const std::string TYPE("type");
+static constexpr std::string_view TYPE("type");
 
 /**
  * @brief Use the dash-gap attribute to define the dash-gap of underline.
@@ -380,7 +380,7 @@ static const std::string TYPE("type");
  *
  * @endcode
  */
-static const std::string DASH_GAP("dash-gap");
+static constexpr std::string_view DASH_GAP("dash-gap");
 
 /**
  * @brief Use the dash-width attribute to define the dash-width of underline.
@@ -395,7 +395,7 @@ static const std::string DASH_GAP("dash-gap");
  *
  * @endcode
  */
-static const std::string DASH_WIDTH("dash-width");
+static constexpr std::string_view DASH_WIDTH("dash-width");
 
 } // namespace UNDERLINE_ATTRIBUTES
 
@@ -412,7 +412,7 @@ namespace SPAN_ATTRIBUTES
  * @endcode
  * @see FONT_ATTRIBUTES::FAMILY
  */
-static const std::string FONT_FAMILY("font-family");
+static constexpr std::string_view FONT_FAMILY("font-family");
 
 /**
  * @brief The font size attribute.
@@ -423,7 +423,7 @@ static const std::string FONT_FAMILY("font-family");
  * @endcode
  * @see FONT_ATTRIBUTES::SIZE
  */
-static const std::string FONT_SIZE("font-size");
+static constexpr std::string_view FONT_SIZE("font-size");
 
 /**
  * @brief The font weight attribute.
@@ -434,7 +434,7 @@ static const std::string FONT_SIZE("font-size");
  * @endcode
  * @see FONT_ATTRIBUTES::WEIGHT
  */
-static const std::string FONT_WEIGHT("font-weight");
+static constexpr std::string_view FONT_WEIGHT("font-weight");
 
 /**
  * @brief The font width attribute.
@@ -445,7 +445,7 @@ static const std::string FONT_WEIGHT("font-weight");
  * @endcode
  * @see FONT_ATTRIBUTES::WIDTH
  */
-static const std::string FONT_WIDTH("font-width");
+static constexpr std::string_view FONT_WIDTH("font-width");
 
 /**
  * @brief The font slant attribute.
@@ -456,7 +456,7 @@ static const std::string FONT_WIDTH("font-width");
  * @endcode
  * @see FONT_ATTRIBUTES::SLANT
  */
-static const std::string FONT_SLANT("font-slant");
+static constexpr std::string_view FONT_SLANT("font-slant");
 
 /**
  * @brief The color value attribute.
@@ -467,7 +467,7 @@ static const std::string FONT_SLANT("font-slant");
  * @endcode
  * @see COLOR_ATTRIBUTES::VALUE
  */
-static const std::string TEXT_COLOR("text-color");
+static constexpr std::string_view TEXT_COLOR("text-color");
 
 /**
  * @brief The background color attribute.
@@ -478,7 +478,7 @@ static const std::string TEXT_COLOR("text-color");
  * @endcode
  * @see BACKGROUND_ATTRIBUTES::COLOR
  */
-static const std::string BACKGROUND_COLOR("background-color");
+static constexpr std::string_view BACKGROUND_COLOR("background-color");
 
 /**
  * @brief The undeline color attribute.
@@ -489,7 +489,7 @@ static const std::string BACKGROUND_COLOR("background-color");
  * @endcode
  * @see UNDERLINE_ATTRIBUTES::COLOR
  */
-static const std::string UNDERLINE_COLOR("u-color");
+static constexpr std::string_view UNDERLINE_COLOR("u-color");
 
 /**
  * @brief The undeline height attribute.
@@ -500,7 +500,7 @@ static const std::string UNDERLINE_COLOR("u-color");
  * @endcode
  * @see UNDERLINE_ATTRIBUTES::HEIGHT
  */
-static const std::string UNDERLINE_HEIGHT("u-height");
+static constexpr std::string_view UNDERLINE_HEIGHT("u-height");
 
 /**
  * @brief The undeline type attribute.
@@ -511,7 +511,7 @@ static const std::string UNDERLINE_HEIGHT("u-height");
  * @endcode
  * @see UNDERLINE_ATTRIBUTES::TYPE
  */
-static const std::string UNDERLINE_TYPE("u-type");
+static constexpr std::string_view UNDERLINE_TYPE("u-type");
 
 /**
  * @brief The undeline dash-gap attribute.
@@ -522,7 +522,7 @@ static const std::string UNDERLINE_TYPE("u-type");
  * @endcode
  * @see UNDERLINE_ATTRIBUTES::DASH_GAP
  */
-static const std::string UNDERLINE_DASH_GAP("u-dash-gap");
+static constexpr std::string_view UNDERLINE_DASH_GAP("u-dash-gap");
 
 /**
  * @brief The undeline dash-width attribute.
@@ -533,7 +533,7 @@ static const std::string UNDERLINE_DASH_GAP("u-dash-gap");
  * @endcode
  * @see UNDERLINE_ATTRIBUTES::DASH_WIDTH
  */
-static const std::string UNDERLINE_DASH_WIDTH("u-dash-width");
+static constexpr std::string_view UNDERLINE_DASH_WIDTH("u-dash-width");
 
 /**
  * @brief The strikethrough color attribute.
@@ -544,7 +544,7 @@ static const std::string UNDERLINE_DASH_WIDTH("u-dash-width");
  * @endcode
  * @see STRIKETHROUGH_ATTRIBUTES::COLOR
  */
-static const std::string STRIKETHROUGH_COLOR("s-color");
+static constexpr std::string_view STRIKETHROUGH_COLOR("s-color");
 
 /**
  * @brief The strikethrough height attribute.
@@ -555,7 +555,7 @@ static const std::string STRIKETHROUGH_COLOR("s-color");
  * @endcode
  * @see STRIKETHROUGH_ATTRIBUTES::HEIGHT
  */
-static const std::string STRIKETHROUGH_HEIGHT("s-height");
+static constexpr std::string_view STRIKETHROUGH_HEIGHT("s-height");
 
 /**
  * @brief The character-spacing value attribute.
@@ -566,7 +566,7 @@ static const std::string STRIKETHROUGH_HEIGHT("s-height");
  * @endcode
  * @see CHARACTER_SPACING_ATTRIBUTES::VALUE
  */
-static const std::string CHARACTER_SPACING_VALUE("char-space-value");
+static constexpr std::string_view CHARACTER_SPACING_VALUE("char-space-value");
 } // namespace SPAN_ATTRIBUTES
 
 namespace STRIKETHROUGH_ATTRIBUTES
@@ -583,7 +583,7 @@ namespace STRIKETHROUGH_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string COLOR("color");
+static constexpr std::string_view COLOR("color");
 
 /**
  * @brief Use the height attribute to define the height of strikethrough.
@@ -596,7 +596,7 @@ static const std::string COLOR("color");
  *
  * @endcode
  */
-static const std::string HEIGHT("height");
+static constexpr std::string_view HEIGHT("height");
 } // namespace STRIKETHROUGH_ATTRIBUTES
 
 namespace PARAGRAPH_ATTRIBUTES
@@ -612,7 +612,7 @@ namespace PARAGRAPH_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string ALIGN("align");
+static constexpr std::string_view ALIGN("align");
 
 /**
  * @brief Use the rrel-line-height attribute to define the relative height of the line (a factor that will be multiplied by text height).
@@ -626,7 +626,7 @@ static const std::string ALIGN("align");
  * @endcode
  * @note If the value is less than 1, the lines could to be overlapped.
  */
-static const std::string RELATIVE_LINE_HEIGHT("rel-line-height");
+static constexpr std::string_view RELATIVE_LINE_HEIGHT("rel-line-height");
 
 } // namespace PARAGRAPH_ATTRIBUTES
 
@@ -649,7 +649,7 @@ namespace CHARACTER_SPACING_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string VALUE("value");
+static constexpr std::string_view VALUE("value");
 } // namespace CHARACTER_SPACING_ATTRIBUTES
 namespace BACKGROUND_ATTRIBUTES
 {
@@ -665,7 +665,7 @@ namespace BACKGROUND_ATTRIBUTES
  *
  * @endcode
  */
-static const std::string COLOR("color");
+static constexpr std::string_view COLOR("color");
 
 } // namespace BACKGROUND_ATTRIBUTES
 
@@ -678,17 +678,17 @@ namespace EMBEDDED_ITEM_ATTRIBUTES
  * the layout engine will use the width and height to
  * create a space inside the text. This gap can be filled later.
  */
-static const std::string URL("url");
+static constexpr std::string_view URL("url");
 
 /**
  * @brief Use the width attribute to define the width of the item.
  */
-static const std::string WIDTH("width");
+static constexpr std::string_view WIDTH("width");
 
 /**
  * @brief Use the height attribute to define the height of the item.
  */
-static const std::string HEIGHT("height");
+static constexpr std::string_view HEIGHT("height");
 
 /**
  * @brief Use the color-blending attribute to define whether the color of the image is multiplied by the color of the text.
@@ -696,7 +696,7 @@ static const std::string HEIGHT("height");
  * @note A color blending mode can be set. The default is NONE, the image will use its own color. If MULTIPLY is set, the color
  * of the image will be multiplied by the color of the text.
  */
-static const std::string COLOR_BLENDING("color-blending");
+static constexpr std::string_view COLOR_BLENDING("color-blending");
 } // namespace EMBEDDED_ITEM_ATTRIBUTES
 
 namespace ANCHOR_ATTRIBUTES
@@ -704,17 +704,17 @@ namespace ANCHOR_ATTRIBUTES
 /**
  * @brief Use the href attribute to define the url of hyperlink.
  */
-static const std::string HREF("href");
+static constexpr std::string_view HREF("href");
 
 /**
  * @brief Sets the color for the characters and underlines inside the element.
  */
-static const std::string COLOR("color");
+static constexpr std::string_view COLOR("color");
 
 /**
  * @brief Sets the clicked color for the characters and underlines inside the element.
  */
-static const std::string CLICKED_COLOR("clicked-color");
+static constexpr std::string_view CLICKED_COLOR("clicked-color");
 
 } // namespace ANCHOR_ATTRIBUTES
 
@@ -36,6 +36,7 @@
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-mesh-factory.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 #include <dali-toolkit/internal/text/text-view.h>
 
 using namespace Dali;
@@ -173,6 +174,8 @@ struct AtlasRenderer::Impl
 
     if(glyphNotCached)
     {
+      ProfilerScope profilerScope(TextProfiler::Stage::GLYPH_CACHE_MISS);
+
       MaxBlockSize& blockSize = mBlockSizes[0u];
 
       if(lastFontId != glyph.fontId)
@@ -280,6 +283,7 @@ struct AtlasRenderer::Impl
                                         blockSize.mNeededBlockHeight);
 
           // Locate a new slot for our glyph
+          ProfilerScope profilerScope(TextProfiler::Stage::ATLAS_UPLOAD);
           mGlyphManager.Add(glyph, style, bitmap, slot); // slot will be 0 is glyph not added
         }
       }
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include <dali-toolkit/internal/text/rendering/styles/blur-helper-functions.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+constexpr uint32_t BOX_COUNT         = 3u;                             ///< Three box blurs are within a few percent of a gaussian blur.
+constexpr uint32_t FIXED_POINT_SHIFT = 16u;                            ///< The precision of the reciprocal of the box size.
+constexpr uint32_t FIXED_POINT_HALF  = 1u << (FIXED_POINT_SHIFT - 1u); ///< Rounds to the nearest value.
+constexpr uint32_t PARALLEL_PIXELS   = 256u * 256u;                    ///< Regions smaller than this are blurred in the calling thread.
+constexpr uint32_t MAX_WORKER_COUNT  = 4u;                             ///< The maximum number of threads that blur a region.
+constexpr uint32_t COLUMN_ALIGNMENT  = 16u;                            ///< The columns of a vertical band start on a multiple of this many bytes.
+
+/**
+ * @brief The rectangle of the buffer to blur, [left, right) x [top, bottom).
+ */
+struct BlurRegion
+{
+  uint32_t left;
+  uint32_t top;
+  uint32_t right;
+  uint32_t bottom;
+};
+
+Dali::ThreadPool& GetThreadPool()
+{
+  static std::unique_ptr<Dali::ThreadPool> gThreadPool{nullptr};
+  static std::once_flag                    onceFlag;
+
+  std::call_once(onceFlag, [&threadPool = gThreadPool] {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    threadPool                     = std::make_unique<Dali::ThreadPool>();
+    threadPool->Initialize(std::clamp(hardwareThreads, 1u, MAX_WORKER_COUNT));
+  });
+
+  return *gThreadPool;
+}
+
+/**
+ * @brief Calls the task for bands of [0, count), in parallel when there is more than one band.
+ */
+void RunInBands(uint32_t count, uint32_t bandCount, uint32_t alignment, const std::function<void(uint32_t, uint32_t)>& task)
+{
+  if(bandCount <= 1u)
+  {
+    task(0u, count);
+    return;
+  }
+
+  const uint32_t bandSize = ((count / bandCount + alignment - 1u) / alignment) * alignment;
+
+  std::vector<Dali::Task> tasks;
+  tasks.reserve(bandCount);
+  for(uint32_t begin = 0u; begin < count; begin += bandSize)
+  {
+    const uint32_t end = std::min(begin + bandSize, count);
+    tasks.emplace_back([&task, begin, end](uint32_t) { task(begin, end); });
+  }
+
+  auto future = GetThreadPool().SubmitTasks(tasks, 0);
+  future->Wait();
+}
+
+/**
+ * @brief Calculates the radii of the box blurs which approximate a gaussian blur.
+ *
+ * The sizes of the boxes are the two odd numbers around the ideal size, so that the
+ * variance of the boxes is as close as possible to the variance of the gaussian.
+ */
+void GetBoxRadii(float blurRadius, uint32_t (&radii)[BOX_COUNT])
+{
+  // The same kernel as Devel::PixelBuffer::ApplyGaussianBlur(), which is cut at the blur radius.
+  // The boxes match the variance of the cut kernel, which is smaller than sigma squared.
+  const float sigma        = blurRadius * 0.4f + 0.6f;
+  const int   kernelRadius = static_cast<int>(ceilf(blurRadius));
+
+  float weightSum   = 0.f;
+  float varianceSum = 0.f;
+  for(int offset = -kernelRadius; offset <= kernelRadius; ++offset)
+  {
+    const float weight = expf(-static_cast<float>(offset * offset) / (2.f * sigma * sigma));
+    weightSum += weight;
+    varianceSum += weight * static_cast<float>(offset * offset);
+  }
+  const float variance = 12.f * varianceSum / weightSum;
+
+  const float idealSize = sqrtf(variance / static_cast<float>(BOX_COUNT) + 1.f);
+  int         lowerSize = static_cast<int>(floorf(idealSize));
+  if(lowerSize % 2 == 0)
+  {
+    --lowerSize;
+  }
+
+  const float lowerSizeF      = static_cast<float>(lowerSize);
+  const float boxCountF       = static_cast<float>(BOX_COUNT);
+  const float idealLowerCount = (variance - boxCountF * lowerSizeF * lowerSizeF - 4.f * boxCountF * lowerSizeF - 3.f * boxCountF) / (-4.f * lowerSizeF - 4.f);
+  const int   lowerCount      = static_cast<int>(roundf(idealLowerCount));
+
+  for(int index = 0; index < static_cast<int>(BOX_COUNT); ++index)
+  {
+    const int size = (index < lowerCount) ? lowerSize : lowerSize + 2;
+    radii[index]   = static_cast<uint32_t>(std::max(size - 1, 0) / 2);
+  }
+}
+
+/**
+ * @brief Finds the pixels that aren't transparent, and grows the rectangle around them by the margin.
+ *
+ * @return false if every pixel is transparent.
+ */
+bool GetBlurRegion(const uint8_t* buffer, uint32_t width, uint32_t height, uint32_t bytesPerPixel, uint32_t margin, BlurRegion& region)
+{
+  const uint32_t rowBytes = width * bytesPerPixel;
+
+  uint32_t left   = rowBytes;
+  uint32_t right  = 0u;
+  uint32_t top    = height;
+  uint32_t bottom = 0u;
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    const uint8_t* const row   = buffer + y * rowBytes;
+    const uint8_t* const first = std::find_if(row, row + rowBytes, [](uint8_t value) { return value != 0u; });
+    if(first == row + rowBytes)
+    {
+      continue;
+    }
+
+    const uint8_t* last = row + rowBytes - 1u;
+    while(*last == 0u)
+    {
+      --last;
+    }
+
+    left   = std::min(left, static_cast<uint32_t>(first - row));
+    right  = std::max(right, static_cast<uint32_t>(last - row) + 1u);
+    top    = std::min(top, y);
+    bottom = y + 1u;
+  }
+
+  if(top >= bottom)
+  {
+    return false;
+  }
+
+  left  = left / bytesPerPixel;
+  right = (right + bytesPerPixel - 1u) / bytesPerPixel;
+
+  region.left   = (left > margin) ? left - margin : 0u;
+  region.top    = (top > margin) ? top - margin : 0u;
+  region.right  = std::min(right + margin, width);
+  region.bottom = std::min(bottom + margin, height);
+  return true;
+}
+
+/**
+ * @brief Box blurs a row, repeating its first and last pixels beyond its ends.
+ */
+template<uint32_t Channels>
+void BlurRow(const uint8_t* source, uint8_t* destination, uint32_t count, uint32_t radius)
+{
+  const uint32_t diameter = 2u * radius + 1u;
+  const uint32_t scale    = ((1u << FIXED_POINT_SHIFT) + diameter / 2u) / diameter;
+  const uint32_t last     = count - 1u;
+
+  uint32_t sums[Channels];
+  for(uint32_t channel = 0u; channel < Channels; ++channel)
+  {
+    sums[channel] = (radius + 1u) * source[channel];
+  }
+  for(uint32_t index = 1u; index <= radius; ++index)
+  {
+    const uint8_t* const pixel = source + std::min(index, last) * Channels;
+    for(uint32_t channel = 0u; channel < Channels; ++channel)
+    {
+      sums[channel] += pixel[channel];
+    }
+  }
+
+  for(uint32_t x = 0u; x < count; ++x)
+  {
+    const uint8_t* const added   = source + std::min(x + radius + 1u, last) * Channels;
+    const uint8_t* const removed = source + ((x > radius) ? x - radius : 0u) * Channels;
+    for(uint32_t channel = 0u; channel < Channels; ++channel)
+    {
+      destination[x * Channels + channel] = static_cast<uint8_t>(std::min((sums[channel] * scale + FIXED_POINT_HALF) >> FIXED_POINT_SHIFT, 255u));
+      sums[channel]                       = sums[channel] + added[channel] - removed[channel];
+    }
+  }
+}
+
+/**
+ * @brief Box blurs a band of columns, repeating their first and last rows beyond their ends.
+ *
+ * The rows are processed whole, with a running sum per byte, so the inner loops vectorize.
+ */
+void BlurColumns(const uint8_t* source, uint32_t sourceStride, uint8_t* destination, uint32_t destinationStride, uint32_t byteCount, uint32_t count, uint32_t radius, uint32_t* sums)
+{
+  const uint32_t diameter = 2u * radius + 1u;
+  const uint32_t scale    = ((1u << FIXED_POINT_SHIFT) + diameter / 2u) / diameter;
+  const uint32_t last     = count - 1u;
+
+  for(uint32_t index = 0u; index < byteCount; ++index)
+  {
+    sums[index] = (radius + 1u) * source[index];
+  }
+  for(uint32_t row = 1u; row <= radius; ++row)
+  {
+    const uint8_t* const pixels = source + std::min(row, last) * sourceStride;
+    for(uint32_t index = 0u; index < byteCount; ++index)
+    {
+      sums[index] += pixels[index];
+    }
+  }
+
+  for(uint32_t y = 0u; y < count; ++y)
+  {
+    const uint8_t* const added   = source + std::min(y + radius + 1u, last) * sourceStride;
+    const uint8_t* const removed = source + ((y > radius) ? y - radius : 0u) * sourceStride;
+    uint8_t* const       output  = destination + y * destinationStride;
+    for(uint32_t index = 0u; index < byteCount; ++index)
+    {
+      output[index] = static_cast<uint8_t>(std::min((sums[index] * scale + FIXED_POINT_HALF) >> FIXED_POINT_SHIFT, 255u));
+      sums[index]   = sums[index] + added[index] - removed[index];
+    }
+  }
+}
+
+template<uint32_t Channels>
+void BlurRegionRows(const uint8_t* buffer, uint32_t width, const BlurRegion& region, const uint32_t (&radii)[BOX_COUNT], uint8_t* output, uint32_t begin, uint32_t end)
+{
+  const uint32_t regionWidth = region.right - region.left;
+  const uint32_t rowBytes    = regionWidth * Channels;
+
+  std::vector<uint8_t> rows(2u * rowBytes);
+  uint8_t* const       firstRow  = rows.data();
+  uint8_t* const       secondRow = rows.data() + rowBytes;
+
+  for(uint32_t y = begin; y < end; ++y)
+  {
+    const uint8_t* const source = buffer + ((region.top + y) * width + region.left) * Channels;
+
+    BlurRow<Channels>(source, firstRow, regionWidth, radii[0u]);
+    BlurRow<Channels>(firstRow, secondRow, regionWidth, radii[1u]);
+    BlurRow<Channels>(secondRow, output + y * rowBytes, regionWidth, radii[2u]);
+  }
+}
+
+} // namespace
+
+void ApplyBoxBlur(uint8_t* buffer, uint32_t width, uint32_t height, uint32_t bytesPerPixel, float blurRadius)
+{
+  if(!buffer || width == 0u || height == 0u || blurRadius <= 0.f || (bytesPerPixel != 1u && bytesPerPixel != 4u))
+  {
+    return;
+  }
+
+  uint32_t radii[BOX_COUNT];
+  GetBoxRadii(blurRadius, radii);
+
+  // Beyond the sum of the radii from the glyphs, the pixels stay transparent.
+  // The extra pixel keeps the edge of the region transparent, so repeating it is the same as reading the pixels beyond it.
+  const uint32_t margin = radii[0u] + radii[1u] + radii[2u] + 1u;
+
+  BlurRegion region;
+  if(!GetBlurRegion(buffer, width, height, bytesPerPixel, margin, region))
+  {
+    return;
+  }
+
+  const uint32_t regionWidth  = region.right - region.left;
+  const uint32_t regionHeight = region.bottom - region.top;
+  const uint32_t regionBytes  = regionWidth * bytesPerPixel;
+  const uint32_t stride       = width * bytesPerPixel;
+
+  const bool     parallel  = (regionWidth * regionHeight >= PARALLEL_PIXELS);
+  const uint32_t bandCount = parallel ? GetThreadPool().GetWorkerCount() : 1u;
+
+  std::vector<uint8_t> blurredRows(static_cast<std::size_t>(regionBytes) * regionHeight);
+
+  // Blurs the rows of the region into blurredRows.
+  RunInBands(regionHeight, bandCount, 1u, [&](uint32_t begin, uint32_t end) {
+    if(bytesPerPixel == 4u)
+    {
+      BlurRegionRows<4u>(buffer, width, region, radii, blurredRows.data(), begin, end);
+    }
+    else
+    {
+      BlurRegionRows<1u>(buffer, width, region, radii, blurredRows.data(), begin, end);
+    }
+  });
+
+  // Blurs the columns of the region back and forth between the buffer and blurredRows, ending in the buffer.
+  uint8_t* const regionBuffer = buffer + region.top * stride + region.left * bytesPerPixel;
+  RunInBands(regionBytes, bandCount, COLUMN_ALIGNMENT, [&](uint32_t begin, uint32_t end) {
+    const uint32_t        byteCount = end - begin;
+    std::vector<uint32_t> sums(byteCount);
+
+    BlurColumns(blurredRows.data() + begin, regionBytes, regionBuffer + begin, stride, byteCount, regionHeight, radii[0u], sums.data());
+    BlurColumns(regionBuffer + begin, stride, blurredRows.data() + begin, regionBytes, byteCount, regionHeight, radii[1u], sums.data());
+    BlurColumns(blurredRows.data() + begin, regionBytes, regionBuffer + begin, stride, byteCount, regionHeight, radii[2u], sums.data());
+  });
+}
+
+void ApplyBoxBlur(Devel::PixelBuffer& pixelBuffer, float blurRadius)
+{
+  const Pixel::Format pixelFormat   = pixelBuffer.GetPixelFormat();
+  const uint32_t      bytesPerPixel = Pixel::GetBytesPerPixel(pixelFormat);
+  if(pixelFormat != Pixel::RGBA8888 && bytesPerPixel != 1u)
+  {
+    pixelBuffer.ApplyGaussianBlur(blurRadius);
+    return;
+  }
+
+  ApplyBoxBlur(pixelBuffer.GetBuffer(), pixelBuffer.GetWidth(), pixelBuffer.GetHeight(), bytesPerPixel, blurRadius);
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
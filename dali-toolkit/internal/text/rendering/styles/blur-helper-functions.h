@@ -0,0 +1,65 @@
+#ifndef DALI_TOOLKIT_TEXT_RENDERING_STYLES_BLUR_HELPER_FUNCTIONS_H
+#define DALI_TOOLKIT_TEXT_RENDERING_STYLES_BLUR_HELPER_FUNCTIONS_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <cstdint>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Blurs the pixels of a text style, like the outline or the shadow.
+ *
+ * The gaussian blur of Devel::PixelBuffer::ApplyGaussianBlur() is approximated with three box blurs
+ * in each direction. Each box blur keeps a running sum of its window, so the cost per pixel doesn't
+ * depend on the radius. Only the pixels near the glyphs are blurred, as the rest stay transparent,
+ * and big buffers are blurred in parallel bands.
+ *
+ * @note Buffers of other formats than RGBA8888 or a single byte per pixel are blurred by Devel::PixelBuffer::ApplyGaussianBlur().
+ *
+ * @param[in,out] pixelBuffer The pixel buffer to blur.
+ * @param[in] blurRadius The radius of the blur, as given to Devel::PixelBuffer::ApplyGaussianBlur().
+ */
+void ApplyBoxBlur(Devel::PixelBuffer& pixelBuffer, float blurRadius);
+
+/**
+ * @brief Blurs the pixels of a buffer with three box blurs in each direction.
+ *
+ * @see ApplyBoxBlur(Devel::PixelBuffer&, float)
+ *
+ * @param[in,out] buffer The pixels, with no padding between rows.
+ * @param[in] width The width of the buffer in pixels.
+ * @param[in] height The height of the buffer in pixels.
+ * @param[in] bytesPerPixel The number of channels of a pixel, one byte each. It must be 1 or 4.
+ * @param[in] blurRadius The radius of the blur.
+ */
+void ApplyBoxBlur(uint8_t* buffer, uint32_t width, uint32_t height, uint32_t bytesPerPixel, float blurRadius);
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_RENDERING_STYLES_BLUR_HELPER_FUNCTIONS_H
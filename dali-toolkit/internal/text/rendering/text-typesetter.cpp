@@ -31,10 +31,12 @@
 #include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
 #include <dali-toolkit/internal/text/glyph-metrics-helper.h>
 #include <dali-toolkit/internal/text/line-helper-functions.h>
+#include <dali-toolkit/internal/text/rendering/styles/blur-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 
 namespace Dali
 {
@@ -961,7 +963,10 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
   // @todo. This initial implementation for a TextLabel has only one visible page.
 
   // Elides the text if needed.
-  mModel->ElideGlyphs();
+  {
+    ProfilerScope profilerScope(TextProfiler::Stage::ELLIPSIS);
+    mModel->ElideGlyphs();
+  }
 
   // Retrieves the layout size.
   const Size& layoutSize = mModel->GetLayoutSize();
@@ -1067,7 +1072,7 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
 
       if(blurRadius > Math::MACHINE_EPSILON_1)
       {
-        outlineImageBuffer.ApplyGaussianBlur(blurRadius);
+        ApplyBoxBlur(outlineImageBuffer, blurRadius);
       }
 
       // Combine the two buffers
@@ -1089,7 +1094,7 @@ Devel::PixelBuffer Typesetter::RenderWithPixelBuffer(const Vector2& size, Toolki
 
       if(blurRadius > Math::MACHINE_EPSILON_1)
       {
-        shadowImageBuffer.ApplyGaussianBlur(blurRadius);
+        ApplyBoxBlur(shadowImageBuffer, blurRadius);
       }
 
       // Combine the two buffers
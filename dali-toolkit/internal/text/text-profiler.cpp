@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include <dali-toolkit/internal/text/text-profiler.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/object/property-array.h>
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+using StageStatistics = ProfilerStatistics::StageStatistics;
+
+constexpr uint32_t HISTOGRAM_BUCKET_COUNT         = ProfilerStatistics::HISTOGRAM_BUCKET_COUNT;
+constexpr uint64_t FIRST_BUCKET_BOUND_NANOSECONDS = 16000u; ///< The runs shorter than 16us are in the first bucket.
+constexpr double   NANOSECONDS_TO_MILLISECONDS    = 1.0e-6;
+constexpr uint32_t MAX_DUMP_LINE_LENGTH           = 256u;
+
+constexpr const char* STAGE_NAMES[TextProfiler::Stage::COUNT] =
+  {
+    "segmentation",
+    "bidi",
+    "fontValidation",
+    "shaping",
+    "layout",
+    "ellipsis",
+    "typesetting",
+    "atlasUpload",
+    "glyphCacheMiss",
+};
+
+/**
+ * @brief The statistics of a stage shared by every thread of the process.
+ */
+struct AtomicStageStatistics
+{
+  std::atomic<uint64_t> count{0u};
+  std::atomic<uint64_t> totalNanoseconds{0u};
+  std::atomic<uint64_t> maxNanoseconds{0u};
+  std::atomic<uint32_t> histogram[HISTOGRAM_BUCKET_COUNT]{};
+};
+
+AtomicStageStatistics gProcessStatistics[TextProfiler::Stage::COUNT];
+
+void AddRun(StageStatistics& statistics, uint64_t nanoseconds)
+{
+  ++statistics.count;
+  statistics.totalNanoseconds += nanoseconds;
+  statistics.maxNanoseconds = std::max(statistics.maxNanoseconds, nanoseconds);
+  ++statistics.histogram[ProfilerStatistics::GetHistogramBucket(nanoseconds)];
+}
+
+void AddRun(AtomicStageStatistics& statistics, uint64_t nanoseconds)
+{
+  statistics.count.fetch_add(1u, std::memory_order_relaxed);
+  statistics.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+  statistics.histogram[ProfilerStatistics::GetHistogramBucket(nanoseconds)].fetch_add(1u, std::memory_order_relaxed);
+
+  uint64_t maxNanoseconds = statistics.maxNanoseconds.load(std::memory_order_relaxed);
+  while(nanoseconds > maxNanoseconds && !statistics.maxNanoseconds.compare_exchange_weak(maxNanoseconds, nanoseconds, std::memory_order_relaxed))
+  {
+  }
+}
+
+StageStatistics Load(const AtomicStageStatistics& statistics)
+{
+  StageStatistics snapshot;
+  snapshot.count            = statistics.count.load(std::memory_order_relaxed);
+  snapshot.totalNanoseconds = statistics.totalNanoseconds.load(std::memory_order_relaxed);
+  snapshot.maxNanoseconds   = statistics.maxNanoseconds.load(std::memory_order_relaxed);
+  for(uint32_t bucket = 0u; bucket < HISTOGRAM_BUCKET_COUNT; ++bucket)
+  {
+    snapshot.histogram[bucket] = statistics.histogram[bucket].load(std::memory_order_relaxed);
+  }
+  return snapshot;
+}
+
+Property::Map CreateStatisticsMap(const StageStatistics (&stages)[TextProfiler::Stage::COUNT])
+{
+  Property::Map map;
+  for(uint32_t stage = 0u; stage < TextProfiler::Stage::COUNT; ++stage)
+  {
+    const StageStatistics& statistics = stages[stage];
+
+    Property::Array histogram;
+    histogram.Reserve(HISTOGRAM_BUCKET_COUNT);
+    for(uint32_t bucket = 0u; bucket < HISTOGRAM_BUCKET_COUNT; ++bucket)
+    {
+      histogram.PushBack(static_cast<int32_t>(statistics.histogram[bucket]));
+    }
+
+    Property::Map stageMap;
+    stageMap.Insert("count", static_cast<int32_t>(statistics.count));
+    stageMap.Insert("totalTime", static_cast<float>(statistics.totalNanoseconds * NANOSECONDS_TO_MILLISECONDS));
+    stageMap.Insert("maxTime", static_cast<float>(statistics.maxNanoseconds * NANOSECONDS_TO_MILLISECONDS));
+    stageMap.Insert("histogram", histogram);
+    map.Insert(STAGE_NAMES[stage], stageMap);
+  }
+
+  Property::Array histogramBounds;
+  histogramBounds.Reserve(HISTOGRAM_BUCKET_COUNT - 1u);
+  for(uint32_t bucket = 0u; bucket + 1u < HISTOGRAM_BUCKET_COUNT; ++bucket)
+  {
+    histogramBounds.PushBack(static_cast<float>((FIRST_BUCKET_BOUND_NANOSECONDS << bucket) * NANOSECONDS_TO_MILLISECONDS));
+  }
+  map.Insert("histogramBounds", histogramBounds);
+
+  return map;
+}
+
+} // namespace
+
+void ProfilerStatistics::Record(TextProfiler::Stage::Type stage, uint64_t nanoseconds)
+{
+  AddRun(mStages[stage], nanoseconds);
+}
+
+void ProfilerStatistics::Reset()
+{
+  for(auto& statistics : mStages)
+  {
+    statistics = StageStatistics();
+  }
+}
+
+Property::Map ProfilerStatistics::GetStatistics() const
+{
+  return CreateStatisticsMap(mStages);
+}
+
+uint32_t ProfilerStatistics::GetHistogramBucket(uint64_t nanoseconds)
+{
+  // Each bucket is twice as long as the previous one.
+  uint32_t bucket = 0u;
+  for(uint64_t bound = FIRST_BUCKET_BOUND_NANOSECONDS; (nanoseconds >= bound) && (bucket + 1u < HISTOGRAM_BUCKET_COUNT); bound <<= 1u)
+  {
+    ++bucket;
+  }
+  return bucket;
+}
+
+namespace Profiler
+{
+void Record(TextProfiler::Stage::Type stage, uint64_t nanoseconds, ProfilerStatistics* controllerStatistics)
+{
+  AddRun(gProcessStatistics[stage], nanoseconds);
+  if(controllerStatistics)
+  {
+    controllerStatistics->Record(stage, nanoseconds);
+  }
+}
+
+Property::Map GetProcessStatistics()
+{
+  StageStatistics stages[TextProfiler::Stage::COUNT];
+  for(uint32_t stage = 0u; stage < TextProfiler::Stage::COUNT; ++stage)
+  {
+    stages[stage] = Load(gProcessStatistics[stage]);
+  }
+  return CreateStatisticsMap(stages);
+}
+
+void ResetProcessStatistics()
+{
+  for(auto& statistics : gProcessStatistics)
+  {
+    statistics.count.store(0u, std::memory_order_relaxed);
+    statistics.totalNanoseconds.store(0u, std::memory_order_relaxed);
+    statistics.maxNanoseconds.store(0u, std::memory_order_relaxed);
+    for(auto& bucket : statistics.histogram)
+    {
+      bucket.store(0u, std::memory_order_relaxed);
+    }
+  }
+}
+
+std::string DumpProcessStatistics()
+{
+  std::string dump;
+  char        line[MAX_DUMP_LINE_LENGTH];
+  for(uint32_t stage = 0u; stage < TextProfiler::Stage::COUNT; ++stage)
+  {
+    const StageStatistics statistics = Load(gProcessStatistics[stage]);
+
+    int length = snprintf(line, sizeof(line), "%s count:%" PRIu64 " total:%.3fms max:%.3fms histogram:", STAGE_NAMES[stage], statistics.count, statistics.totalNanoseconds * NANOSECONDS_TO_MILLISECONDS, statistics.maxNanoseconds * NANOSECONDS_TO_MILLISECONDS);
+    for(uint32_t bucket = 0u; (bucket < HISTOGRAM_BUCKET_COUNT) && (length > 0) && (static_cast<uint32_t>(length) < sizeof(line)); ++bucket)
+    {
+      length += snprintf(line + length, sizeof(line) - length, "%c%u", (bucket == 0u) ? '[' : ',', statistics.histogram[bucket]);
+    }
+
+    DALI_LOG_RELEASE_INFO("TextProfiler %s]\n", line);
+    dump.append(line).append("]\n");
+  }
+  return dump;
+}
+
+} // namespace Profiler
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,167 @@
+#ifndef DALI_TOOLKIT_TEXT_PROFILER_H
+#define DALI_TOOLKIT_TEXT_PROFILER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/text/text-profiler-devel.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief The statistics of the stages of the text pipeline run by a single text controller.
+ *
+ * It's only used in the event thread, so it isn't synchronized.
+ */
+class ProfilerStatistics
+{
+public:
+  static constexpr uint32_t HISTOGRAM_BUCKET_COUNT = 12u; ///< Buckets of 16us, 32us, ... 16.4ms, and the longer runs.
+
+  /**
+   * @brief The statistics of a stage.
+   */
+  struct StageStatistics
+  {
+    uint64_t count{0u};                             ///< The number of runs.
+    uint64_t totalNanoseconds{0u};                  ///< The time of all the runs.
+    uint64_t maxNanoseconds{0u};                    ///< The time of the longest run.
+    uint32_t histogram[HISTOGRAM_BUCKET_COUNT]{0u}; ///< The number of runs by duration.
+  };
+
+  /**
+   * @brief Adds a run of a stage.
+   *
+   * @param[in] stage The stage.
+   * @param[in] nanoseconds The duration of the run.
+   */
+  void Record(TextProfiler::Stage::Type stage, uint64_t nanoseconds);
+
+  /**
+   * @brief Clears the statistics of every stage.
+   */
+  void Reset();
+
+  /**
+   * @brief Retrieves the statistics as described in TextProfiler.
+   *
+   * @return The statistics of each stage.
+   */
+  Property::Map GetStatistics() const;
+
+  /**
+   * @brief Retrieves the bucket of the histogram for a duration.
+   *
+   * @param[in] nanoseconds The duration.
+   * @return The index of the bucket.
+   */
+  static uint32_t GetHistogramBucket(uint64_t nanoseconds);
+
+private:
+  StageStatistics mStages[TextProfiler::Stage::COUNT];
+};
+
+namespace Profiler
+{
+/**
+ * @brief Adds a run of a stage to the process-wide statistics, and to the statistics of a controller.
+ *
+ * @param[in] stage The stage.
+ * @param[in] nanoseconds The duration of the run.
+ * @param[in,out] controllerStatistics The statistics of the controller which ran the stage, or nullptr.
+ */
+void Record(TextProfiler::Stage::Type stage, uint64_t nanoseconds, ProfilerStatistics* controllerStatistics);
+
+/**
+ * @copydoc Dali::Toolkit::Text::TextProfiler::GetStatistics()
+ */
+Property::Map GetProcessStatistics();
+
+/**
+ * @copydoc Dali::Toolkit::Text::TextProfiler::ResetStatistics()
+ */
+void ResetProcessStatistics();
+
+/**
+ * @copydoc Dali::Toolkit::Text::TextProfiler::DumpStatistics()
+ */
+std::string DumpProcessStatistics();
+
+} // namespace Profiler
+
+/**
+ * @brief Measures a run of a stage, from its construction to its destruction.
+ *
+ * @code
+ * {
+ *   ProfilerScope profilerScope(TextProfiler::Stage::SHAPING, &impl.mProfilerStatistics);
+ *   ShapeText(...);
+ * }
+ * @endcode
+ */
+class ProfilerScope
+{
+public:
+  /**
+   * @brief Starts measuring the stage.
+   *
+   * @param[in] stage The stage.
+   * @param[in,out] controllerStatistics The statistics of the controller which runs the stage, or nullptr.
+   */
+  ProfilerScope(TextProfiler::Stage::Type stage, ProfilerStatistics* controllerStatistics = nullptr)
+  : mStart(std::chrono::steady_clock::now()),
+    mControllerStatistics(controllerStatistics),
+    mStage(stage)
+  {
+  }
+
+  /**
+   * @brief Records the run of the stage.
+   */
+  ~ProfilerScope()
+  {
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart);
+    Profiler::Record(mStage, static_cast<uint64_t>(duration.count()), mControllerStatistics);
+  }
+
+  ProfilerScope(const ProfilerScope&) = delete;
+  ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+  std::chrono::steady_clock::time_point mStart;
+  ProfilerStatistics*                   mControllerStatistics;
+  TextProfiler::Stage::Type             mStage;
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_PROFILER_H
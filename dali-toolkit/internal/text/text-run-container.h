@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-run.h>
 
@@ -117,6 +120,51 @@ void ClearCharacterRuns(CharacterIndex startIndex,
   runs.Erase(runBuffer + startRemoveIndex, runBuffer + endRemoveIndex);
 }
 
+/**
+ * @brief Updates the number of characters and the character index of the text's style runs when characters are inserted.
+ *
+ * It doesn't need the text nor the total number of characters. The runs that end before the @p index are left as they are.
+ *
+ * @param[in] index Index to the first inserted character.
+ * @param[in] numberOfCharacters The number of inserted characters.
+ * @param[in,out] runs The text's style runs.
+ */
+template<typename T>
+void InsertCharacterRuns(CharacterIndex index,
+                         Length         numberOfCharacters,
+                         Vector<T>&     runs)
+{
+  for(typename Vector<T>::Iterator it    = runs.Begin(),
+                                   endIt = runs.End();
+      it != endIt;
+      ++it)
+  {
+    CharacterRun& characterRun = it->characterRun;
+
+    if((0u == characterRun.numberOfCharacters) ||
+       (characterRun.characterIndex + characterRun.numberOfCharacters < index))
+    {
+      // Runs without characters, and runs before the inserted characters, don't change.
+      continue;
+    }
+
+    if((0u == index) && (0u == characterRun.characterIndex))
+    {
+      // Characters inserted at the beginning of the text extend the first run.
+      characterRun.numberOfCharacters += numberOfCharacters;
+    }
+    else if(index <= characterRun.characterIndex)
+    {
+      characterRun.characterIndex += numberOfCharacters;
+    }
+    else
+    {
+      // Characters inserted within the run, or right after it, extend it.
+      characterRun.numberOfCharacters += numberOfCharacters;
+    }
+  }
+}
+
 /**
  * @brief Updates the number of characters and the character index of the text's style runs.
  *
@@ -137,6 +185,12 @@ void UpdateCharacterRuns(CharacterIndex index,
                          Vector<T>&     runs,
                          Vector<T>&     removedRuns)
 {
+  if(runs.Empty())
+  {
+    // Nothing to update.
+    return;
+  }
+
   if(0 > numberOfCharacters)
   {
     // Remove characters.
@@ -154,21 +208,21 @@ void UpdateCharacterRuns(CharacterIndex index,
       return;
     }
 
-    const VectorBase::SizeType size = runs.Count();
-    // Temporary vector used to remove runs.
-    Vector<T> tempRuns;
-    // Reserve some space for the temporary vector.
-    tempRuns.Reserve(size);
-    removedRuns.Reserve(size);
+    // The runs are compacted in place, so no temporary vector is needed to remove runs.
+    T* const runsBuffer = runs.Begin();
+    T*       keptRun    = runsBuffer;
 
     // Whether any run has to be removed.
     bool runsRemoved = false;
 
+    // Whether there are runs without characters.
+    bool emptyRunsKept = false;
+
     // Index to the last character added/removed.
     const CharacterIndex lastIndex = index + numberOfRemovedCharacters - 1u;
 
     // Update the style runs
-    for(typename Vector<T>::Iterator it    = runs.Begin(),
+    for(typename Vector<T>::Iterator it    = runsBuffer,
                                      endIt = runs.End();
         it != endIt;
         ++it)
@@ -176,14 +230,19 @@ void UpdateCharacterRuns(CharacterIndex index,
       T& run = *it;
 
       if(run.characterRun.numberOfCharacters == 0)
+      {
+        // Kept only if no run is removed.
+        *keptRun++    = run;
+        emptyRunsKept = true;
         continue;
+      }
 
       const CharacterIndex lastRunIndex = run.characterRun.characterIndex + run.characterRun.numberOfCharacters - 1u;
 
       if(lastRunIndex < index)
       {
         // The style run is not affected by the removed text.
-        tempRuns.PushBack(run);
+        *keptRun++ = run;
         continue;
       }
 
@@ -218,46 +277,24 @@ void UpdateCharacterRuns(CharacterIndex index,
           }
         }
 
-        tempRuns.PushBack(run);
+        *keptRun++ = run;
       }
     }
 
-    // Copy the temporary vector if there are runs removed.
     if(runsRemoved)
     {
-      runs = tempRuns;
+      if(emptyRunsKept)
+      {
+        // The runs without characters are removed as well when other runs are removed.
+        keptRun = std::remove_if(runsBuffer, keptRun, [](const T& run) { return run.characterRun.numberOfCharacters == 0; });
+      }
+
+      runs.Resize(static_cast<VectorBase::SizeType>(keptRun - runsBuffer));
     }
   }
   else
   {
-    // Add characters.
-
-    // Update the style runs
-    for(typename Vector<T>::Iterator it    = runs.Begin(),
-                                     endIt = runs.End();
-        it != endIt;
-        ++it)
-    {
-      T& run = *it;
-
-      if(run.characterRun.numberOfCharacters == 0)
-        continue;
-
-      // Update the number of characters of the style run.
-
-      if((0u == index) && (0u == run.characterRun.characterIndex))
-      {
-        run.characterRun.numberOfCharacters += numberOfCharacters;
-      }
-      else if(index <= run.characterRun.characterIndex)
-      {
-        run.characterRun.characterIndex += numberOfCharacters;
-      }
-      else if(index <= run.characterRun.characterIndex + run.characterRun.numberOfCharacters)
-      {
-        run.characterRun.numberOfCharacters += numberOfCharacters;
-      }
-    }
+    InsertCharacterRuns(index, static_cast<Length>(numberOfCharacters), runs);
   }
 }
 
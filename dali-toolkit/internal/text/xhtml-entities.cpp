@@ -16,11 +16,15 @@
  */
 
 // EXTERNAL INCLUDES
-#include <cstring> // for strlen()
+#include <string_view>
+#include <utility>
 
 // FILE HEADER
 #include "xhtml-entities.h"
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/markup-processor/markup-processor-token-table.h>
+
 namespace Dali
 {
 namespace Toolkit
@@ -31,12 +35,10 @@ namespace
 {
 /**
  * Implementation of the XHTML Entity matching
+ *
+ * The XHTML Named Entity string and its corresponding UTF-8.
  */
-struct XHTMLEntityLookup
-{
-  const char* const entityName; // XHTML Named Entity string
-  const char* const entityCode; // Corresponding UTF-8
-};
+using XHTMLEntityLookup = std::pair<std::string_view, const char*>;
 
 /* table of html name entities supported in DALi
  *
@@ -44,7 +46,7 @@ struct XHTMLEntityLookup
  * its utf 8 as value
  */
 // clang-format off
-const XHTMLEntityLookup XHTMLEntityLookupTable[] =
+constexpr XHTMLEntityLookup XHTMLEntityLookupTable[] =
 {
   {"&quot;\0"    ,"\x22\0"         },
   {"&amp;\0"     ,"\x26\0"         },
@@ -302,25 +304,15 @@ const XHTMLEntityLookup XHTMLEntityLookupTable[] =
 };
 // clang-format on
 
-const std::size_t XHTMLENTITY_LOOKUP_COUNT = (sizeof(XHTMLEntityLookupTable)) / (sizeof(XHTMLEntityLookup));
+// Named entities are case sensitive, i.e. &Alpha; and &alpha; are different characters.
+constexpr auto XHTML_ENTITY_TABLE = MakeTokenTable<const char*, true>(XHTMLEntityLookupTable);
 
 } // unnamed namespace
 
 const char* const NamedEntityToUtf8(const char* const markupText, unsigned int len)
 {
   // finding if given XHTML named entity is supported or not
-  for(size_t i = 0; i < XHTMLENTITY_LOOKUP_COUNT; ++i)
-  {
-    unsigned int entityLen = strlen(XHTMLEntityLookupTable[i].entityName);
-    if(len == entityLen)
-    {
-      if(strncmp(markupText, XHTMLEntityLookupTable[i].entityName, len) == 0) // if named Entity found in table
-      {
-        return XHTMLEntityLookupTable[i].entityCode;
-      }
-    }
-  }
-  return NULL;
+  return XHTML_ENTITY_TABLE.Find(markupText, len, NULL);
 }
 
 } // namespace  Text
@@ -52,6 +52,9 @@ const int CUSTOM_PROPERTY_COUNT(1); // pixel area,
 
 const Dali::Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 
+constexpr uint32_t LOW_PRIORITY_MAXIMUM_AREA  = 128u * 128u; ///< The smaller animations, e.g. icons, are degraded first under load.
+constexpr uint32_t HIGH_PRIORITY_MINIMUM_AREA = 512u * 512u; ///< The larger animations are never degraded.
+
 // stop behavior
 DALI_ENUM_TO_STRING_TABLE_BEGIN(STOP_BEHAVIOR)
   DALI_ENUM_TO_STRING_WITH_SCOPE(Dali::Toolkit::DevelImageVisual::StopBehavior, CURRENT_FRAME)
@@ -101,6 +104,7 @@ AnimatedVectorImageVisual::AnimatedVectorImageVisual(VisualFactoryCache& factory
   mLastSentPlayStateId(0u),
   mLoadFailed(false),
   mRendererAdded(false),
+  mCulled(false),
   mRedrawInScalingDown(true),
   mEnableFrameCache(false),
   mUseNativeImage(false),
@@ -481,6 +485,11 @@ void AnimatedVectorImageVisual::DoSetOnScene(Actor& actor)
     mSizeNotification = actor.AddPropertyNotification(Actor::Property::SIZE, StepCondition(3.0f));
     mSizeNotification.NotifySignal().Connect(this, &AnimatedVectorImageVisual::OnSizeNotification);
 
+    // Add property notification for culling, to lower the priority of the rasterization while the actor is not shown
+    mCulledNotification = actor.AddPropertyNotification(DevelActor::Property::CULLED, LessThanCondition(0.5f));
+    mCulledNotification.SetNotifyMode(PropertyNotification::NOTIFY_ON_CHANGED);
+    mCulledNotification.NotifySignal().Connect(this, &AnimatedVectorImageVisual::OnCulledNotification);
+
     actor.InheritedVisibilityChangedSignal().Connect(this, &AnimatedVectorImageVisual::OnControlInheritedVisibilityChanged);
 
     Window window = DevelWindow::Get(actor);
@@ -517,6 +526,7 @@ void AnimatedVectorImageVisual::DoSetOffScene(Actor& actor)
   // Remove property notification
   actor.RemovePropertyNotification(mScaleNotification);
   actor.RemovePropertyNotification(mSizeNotification);
+  actor.RemovePropertyNotification(mCulledNotification);
 
   actor.InheritedVisibilityChangedSignal().Disconnect(this, &AnimatedVectorImageVisual::OnControlInheritedVisibilityChanged);
 
@@ -534,6 +544,7 @@ void AnimatedVectorImageVisual::DoSetOffScene(Actor& actor)
   mVisualScale          = Vector2::ONE;
   mAnimationData.width  = 0;
   mAnimationData.height = 0;
+  mCulled               = false;
 
   DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::DoSetOffScene [%p]\n", this);
 }
@@ -789,6 +800,33 @@ void AnimatedVectorImageVisual::SetVectorImageSize()
     mAnimationData.height = height;
     mAnimationData.resendFlag |= VectorAnimationTask::RESEND_SIZE;
   }
+
+  UpdateRasterizationPriority();
+}
+
+void AnimatedVectorImageVisual::UpdateRasterizationPriority()
+{
+  const uint32_t area = mAnimationData.width * mAnimationData.height;
+
+  VectorAnimationTask::RasterizationPriority priority = VectorAnimationTask::RasterizationPriority::NORMAL;
+  if(mCulled)
+  {
+    priority = VectorAnimationTask::RasterizationPriority::OFFSCREEN;
+  }
+  else if(area < LOW_PRIORITY_MAXIMUM_AREA)
+  {
+    priority = VectorAnimationTask::RasterizationPriority::LOW;
+  }
+  else if(area >= HIGH_PRIORITY_MINIMUM_AREA)
+  {
+    priority = VectorAnimationTask::RasterizationPriority::HIGH;
+  }
+
+  if(mAnimationData.priority != priority)
+  {
+    mAnimationData.priority = priority;
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PRIORITY;
+  }
 }
 
 void AnimatedVectorImageVisual::StopAnimation()
@@ -857,6 +895,20 @@ void AnimatedVectorImageVisual::OnSizeNotification(PropertyNotification& source)
   }
 }
 
+void AnimatedVectorImageVisual::OnCulledNotification(PropertyNotification& source)
+{
+  Actor actor = mPlacementActor.GetHandle();
+  if(actor)
+  {
+    mCulled = actor.GetCurrentProperty<bool>(DevelActor::Property::CULLED);
+
+    DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::OnCulledNotification: culled = %d [%p]\n", mCulled, this);
+
+    UpdateRasterizationPriority();
+    SendAnimationData();
+  }
+}
+
 void AnimatedVectorImageVisual::OnControlInheritedVisibilityChanged(Actor actor, bool visible)
 {
   if(!visible)
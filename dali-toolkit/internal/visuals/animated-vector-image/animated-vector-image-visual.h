@@ -196,6 +196,11 @@ private:
    */
   void StopAnimation();
 
+  /**
+   * @brief Update the priority of the rasterization from the size and the culling of the visual.
+   */
+  void UpdateRasterizationPriority();
+
   /**
    * @brief Trigger rasterization of the vector content.
    */
@@ -211,6 +216,11 @@ private:
    */
   void OnSizeNotification(PropertyNotification& source);
 
+  /**
+   * @brief Callback when the actor is culled or shown again.
+   */
+  void OnCulledNotification(PropertyNotification& source);
+
   /**
    * @brief Callback when the visibility of the actor is changed.
    */
@@ -240,6 +250,7 @@ private:
   ImageVisualShaderFactory&          mImageVisualShaderFactory;
   PropertyNotification               mScaleNotification;
   PropertyNotification               mSizeNotification;
+  PropertyNotification               mCulledNotification;
   Vector2                            mVisualSize;
   Vector2                            mVisualScale;
   Dali::ImageDimensions              mDesiredSize{};
@@ -251,6 +262,7 @@ private:
 
   bool mLoadFailed : 1;
   bool mRendererAdded : 1;
+  bool mCulled : 1;
   bool mRedrawInScalingDown : 1;
   bool mEnableFrameCache : 1;
   bool mUseNativeImage : 1;
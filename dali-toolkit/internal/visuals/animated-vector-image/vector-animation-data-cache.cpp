@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-data-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <iterator>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_ANIMATION");
+#endif
+
+constexpr std::chrono::minutes DATA_LIFETIME{10};    ///< The data is downloaded again after this, in case it changed.
+constexpr std::chrono::seconds FAILURE_LIFETIME{10}; ///< A failed url is downloaded again after this.
+
+} // unnamed namespace
+
+VectorAnimationDataCache::VectorAnimationDataCache(uint32_t maximumSize)
+: mConditionalWait(),
+  mEntries(),
+  mEntryIterators(),
+  mFailedUrls(),
+  mDownloadingUrls(),
+  mOversizedUrls(),
+  mSize(0u),
+  mMaximumSize(maximumSize)
+{
+}
+
+VectorAnimationDataCache::~VectorAnimationDataCache()
+{
+}
+
+VectorAnimationDataCache::Result VectorAnimationDataCache::Acquire(const std::string& url, bool wait, DataPtr& data)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  while(true)
+  {
+    const Clock::time_point now = Clock::now();
+
+    auto iter = mEntryIterators.find(url);
+    if(iter != mEntryIterators.end())
+    {
+      if(now - iter->second->downloadTime < DATA_LIFETIME)
+      {
+        // Move the entry to the front, as the most recently used.
+        mEntries.splice(mEntries.begin(), mEntries, iter->second);
+
+        DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationDataCache::Acquire: Cached [%s]\n", url.c_str());
+        data = iter->second->data;
+        return Result::CACHED;
+      }
+      RemoveEntry(iter->second);
+    }
+
+    auto failedIter = mFailedUrls.find(url);
+    if(failedIter != mFailedUrls.end())
+    {
+      if(now - failedIter->second < FAILURE_LIFETIME)
+      {
+        DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationDataCache::Acquire: Failed [%s]\n", url.c_str());
+        return Result::FAILED;
+      }
+      mFailedUrls.erase(failedIter);
+    }
+
+    if(mOversizedUrls.find(url) != mOversizedUrls.end())
+    {
+      // It's never cached. Don't wait for the other tasks downloading it.
+      return Result::MISS;
+    }
+
+    if(mDownloadingUrls.find(url) == mDownloadingUrls.end())
+    {
+      // Nobody is downloading it. The caller does.
+      mDownloadingUrls.insert(url);
+      return Result::DOWNLOAD;
+    }
+
+    if(!wait)
+    {
+      return Result::MISS;
+    }
+
+    // Wait for the task downloading it.
+    mConditionalWait.Wait(lock);
+  }
+}
+
+void VectorAnimationDataCache::Add(const std::string& url, DataPtr data)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  mDownloadingUrls.erase(url);
+
+  const uint32_t dataSize = data ? static_cast<uint32_t>(data->Count()) : 0u;
+  if(dataSize > mMaximumSize)
+  {
+    mOversizedUrls.insert(url);
+  }
+  else if(data && mEntryIterators.find(url) == mEntryIterators.end())
+  {
+    mEntries.push_front(Entry{url, data, Clock::now()});
+    mEntryIterators[url] = mEntries.begin();
+    mSize += dataSize;
+
+    // Remove the least recently used data.
+    while(mSize > mMaximumSize)
+    {
+      RemoveEntry(std::prev(mEntries.end()));
+    }
+  }
+
+  mConditionalWait.Notify(lock);
+}
+
+void VectorAnimationDataCache::Cancel(const std::string& url)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  // The waiting tasks fail too.
+  mDownloadingUrls.erase(url);
+  mFailedUrls[url] = Clock::now();
+  mConditionalWait.Notify(lock);
+}
+
+void VectorAnimationDataCache::Invalidate(const std::string& url)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  auto iter = mEntryIterators.find(url);
+  if(iter != mEntryIterators.end())
+  {
+    RemoveEntry(iter->second);
+  }
+  mFailedUrls.erase(url);
+  mOversizedUrls.erase(url);
+}
+
+uint32_t VectorAnimationDataCache::GetSize() const
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  return mSize;
+}
+
+void VectorAnimationDataCache::RemoveEntry(EntryList::iterator iter)
+{
+  DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationDataCache::RemoveEntry: Remove [%s]\n", iter->url.c_str());
+
+  mSize -= static_cast<uint32_t>(iter->data->Count());
+  mEntryIterators.erase(iter->url);
+  mEntries.erase(iter);
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,167 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_DATA_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_DATA_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Shares the downloaded data of remote vector animations between the tasks playing them.
+ *
+ * Every task used to download its own copy of a remote animation, so a spinner shown
+ * dozens of times was downloaded dozens of times, often at the same time by several workers.
+ * The first task to load a url downloads it while the other worker tasks wait for its data.
+ * The synchronous loading in the event thread never waits: it downloads by itself instead.
+ *
+ * The data is kept after loading so that animations created again, e.g. in a scrolled list,
+ * don't download it again. The least recently used data is removed when the cache
+ * exceeds its maximum size, and any data is downloaded again after a while, in case it changed.
+ * The data larger than the maximum size is never kept, and the tasks loading it download it
+ * in parallel as before.
+ *
+ * A failed download is remembered for a short while, so that the waiting tasks and the tasks
+ * created meanwhile fail too rather than downloading it again.
+ */
+class VectorAnimationDataCache
+{
+public:
+  using DataPtr = std::shared_ptr<const Dali::Vector<uint8_t>>;
+
+  /**
+   * @brief The result of Acquire().
+   */
+  enum class Result
+  {
+    CACHED,   ///< The data is cached.
+    DOWNLOAD, ///< The caller downloads the url, then calls either Add() or Cancel().
+    MISS,     ///< The caller downloads the url by itself, and doesn't tell the cache.
+    FAILED    ///< The url failed to download a moment ago.
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] maximumSize The maximum size in bytes of the kept data.
+   */
+  explicit VectorAnimationDataCache(uint32_t maximumSize);
+
+  /**
+   * @brief Destructor.
+   */
+  ~VectorAnimationDataCache();
+
+  /**
+   * @brief Retrieves the data of a url.
+   *
+   * If another task is downloading the url, it waits for it when allowed, or returns Result::MISS otherwise.
+   *
+   * @param[in] url The url of the animation.
+   * @param[in] wait Whether it may wait for another task. It must be false in the event thread.
+   * @param[out] data The data if it's cached.
+   * @return What the caller has to do.
+   */
+  Result Acquire(const std::string& url, bool wait, DataPtr& data);
+
+  /**
+   * @brief Adds the data downloaded after Acquire() returned Result::DOWNLOAD, and wakes the tasks waiting for it.
+   *
+   * @param[in] url The url of the animation.
+   * @param[in] data The data.
+   */
+  void Add(const std::string& url, DataPtr data);
+
+  /**
+   * @brief Records that the download after Acquire() returned Result::DOWNLOAD failed, and wakes the tasks waiting for it.
+   *
+   * @param[in] url The url of the animation.
+   */
+  void Cancel(const std::string& url);
+
+  /**
+   * @brief Forgets the data and the failures of a url, e.g. when the cached data turned out not to load.
+   *
+   * @param[in] url The url of the animation.
+   */
+  void Invalidate(const std::string& url);
+
+  /**
+   * @brief Retrieves the size of the kept data.
+   *
+   * @return The size in bytes.
+   */
+  uint32_t GetSize() const;
+
+private:
+  // Undefined
+  VectorAnimationDataCache(const VectorAnimationDataCache& cache) = delete;
+
+  // Undefined
+  VectorAnimationDataCache& operator=(const VectorAnimationDataCache& cache) = delete;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry
+  {
+    std::string       url;
+    DataPtr           data;
+    Clock::time_point downloadTime;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  /**
+   * @brief Removes an entry. The lock must be held.
+   *
+   * @param[in] iter The entry.
+   */
+  void RemoveEntry(EntryList::iterator iter);
+
+private:
+  mutable ConditionalWait                              mConditionalWait;
+  EntryList                                            mEntries;         ///< The data, the most recently used first.
+  std::unordered_map<std::string, EntryList::iterator> mEntryIterators;  ///< The entries by url.
+  std::unordered_map<std::string, Clock::time_point>   mFailedUrls;      ///< The time of the last failed download by url.
+  std::unordered_set<std::string>                      mDownloadingUrls; ///< The urls being downloaded.
+  std::unordered_set<std::string>                      mOversizedUrls;   ///< The urls whose data exceeds the maximum size.
+  uint32_t                                             mSize;            ///< The size of the data in bytes.
+  const uint32_t                                       mMaximumSize;     ///< The maximum size of the data in bytes.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_DATA_CACHE_H
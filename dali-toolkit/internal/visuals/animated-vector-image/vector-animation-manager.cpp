@@ -40,11 +40,14 @@ Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging,
 
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_IMAGE_PERFORMANCE_MARKER, false);
 
+constexpr uint32_t MAXIMUM_DATA_CACHE_SIZE = 4u * 1024u * 1024u; ///< The downloaded animations kept for the new tasks, in bytes.
+
 } // unnamed namespace
 
 VectorAnimationManager::VectorAnimationManager()
 : mEventCallbacks(),
   mVectorAnimationThread(nullptr),
+  mDataCache(MAXIMUM_DATA_CACHE_SIZE),
   mProcessorRegistered(false)
 {
 }
@@ -69,6 +72,17 @@ VectorAnimationThread& VectorAnimationManager::GetVectorAnimationThread()
   return *mVectorAnimationThread;
 }
 
+VectorAnimationDataCache& VectorAnimationManager::GetDataCache()
+{
+  return mDataCache;
+}
+
+Property::Map VectorAnimationManager::GetSchedulerStatistics()
+{
+  // Don't start the thread only to retrieve the statistics.
+  return mVectorAnimationThread ? mVectorAnimationThread->GetSchedulerStatistics() : Property::Map();
+}
+
 void VectorAnimationManager::RegisterEventCallback(CallbackBase* callback)
 {
   mEventCallbacks.PushBack(callback); ///< Take ownership of callback.
@@ -22,10 +22,12 @@
 #include <dali/integration-api/ordered-set.h>
 #include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/object/property-map.h>
 #include <dali/public-api/signals/callback.h>
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-data-cache.h>
 
 namespace Dali
 {
@@ -57,6 +59,18 @@ public:
    */
   VectorAnimationThread& GetVectorAnimationThread();
 
+  /**
+   * Get the cache of the downloaded vector animation data.
+   * @return The data cache.
+   */
+  VectorAnimationDataCache& GetDataCache();
+
+  /**
+   * Get the statistics of the load-adaptive scheduling of the animations.
+   * @return The scheduling statistics, or an empty map if no animation has been rasterized yet.
+   */
+  Property::Map GetSchedulerStatistics();
+
   /**
    * @brief Register a callback.
    *
@@ -97,6 +111,7 @@ private:
   Dali::Integration::OrderedSet<CallbackBase> mEventCallbacks; ///< Event triggered callback lists (owned)
 
   std::unique_ptr<VectorAnimationThread> mVectorAnimationThread;
+  VectorAnimationDataCache               mDataCache;
   bool                                   mProcessorRegistered : 1;
 };
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <cstdlib>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_ANIMATION");
+#endif
+
+constexpr auto RASTERIZATION_BUDGET_ENV = "DALI_VECTOR_ANIMATION_RASTERIZATION_BUDGET";
+
+constexpr int64_t  DEFAULT_BUDGET_MICROSECONDS = 8000;  ///< Half of the vsync interval, to leave the workers to the other tasks.
+constexpr int64_t  VSYNC_INTERVAL_MICROSECONDS = 16667; ///< The vsync interval of 60Hz.
+constexpr int64_t  WINDOW_MICROSECONDS         = VSYNC_INTERVAL_MICROSECONDS * 6;
+constexpr float    LOAD_DECREASE_UTILIZATION   = 0.5f; ///< Degrading a level roughly halves the load, so it goes back only below a half.
+constexpr uint32_t LOAD_LEVEL_COUNT            = 3u;
+constexpr uint32_t PRIORITY_COUNT              = 4u;
+constexpr uint32_t FROZEN                      = 0u;
+
+/**
+ * @brief The frame intervals by load level and priority (OFFSCREEN, LOW, NORMAL, HIGH).
+ */
+constexpr uint32_t FRAME_INTERVALS[LOAD_LEVEL_COUNT][PRIORITY_COUNT] =
+  {
+    {1u, 1u, 1u, 1u},     // Within the budget
+    {FROZEN, 2u, 1u, 1u}, // Over the budget
+    {FROZEN, 4u, 2u, 1u}, // Still over the budget after degrading the small animations
+};
+
+int64_t GetBudgetFromEnvironment()
+{
+  auto budgetString = Dali::EnvironmentVariable::GetEnvironmentVariable(RASTERIZATION_BUDGET_ENV);
+  return budgetString ? static_cast<int64_t>(std::atof(budgetString) * 1000.0) : DEFAULT_BUDGET_MICROSECONDS;
+}
+
+} // unnamed namespace
+
+VectorAnimationScheduler::VectorAnimationScheduler()
+: VectorAnimationScheduler(GetBudgetFromEnvironment())
+{
+}
+
+VectorAnimationScheduler::VectorAnimationScheduler(int64_t budgetMicroseconds)
+: mWindowStartTime(std::chrono::steady_clock::now()),
+  mBudgetMicroseconds(budgetMicroseconds > 0 ? budgetMicroseconds : 0),
+  mWindowRasterizationTime(0),
+  mUtilization(0.0f),
+  mSkippedFrames(0u),
+  mLoadLevel(0u)
+{
+}
+
+VectorAnimationScheduler::~VectorAnimationScheduler()
+{
+}
+
+void VectorAnimationScheduler::AddRasterizationTime(int64_t microseconds)
+{
+  mWindowRasterizationTime += microseconds;
+}
+
+void VectorAnimationScheduler::AddSkippedFrames(uint32_t count)
+{
+  mSkippedFrames += count;
+}
+
+void VectorAnimationScheduler::Update(TimePoint currentTime)
+{
+  const int64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - mWindowStartTime).count();
+  if(elapsed < WINDOW_MICROSECONDS || mBudgetMicroseconds == 0)
+  {
+    return;
+  }
+
+  // The budget of the window is the budget of every vsync interval in it.
+  mUtilization = static_cast<float>(static_cast<double>(mWindowRasterizationTime) * VSYNC_INTERVAL_MICROSECONDS / (static_cast<double>(mBudgetMicroseconds) * elapsed));
+
+  if(mUtilization > 1.0f && mLoadLevel + 1u < LOAD_LEVEL_COUNT)
+  {
+    ++mLoadLevel;
+    DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::General, "VectorAnimationScheduler::Update: Load level up [%u, utilization = %f]\n", mLoadLevel, mUtilization);
+  }
+  else if(mUtilization < LOAD_DECREASE_UTILIZATION && mLoadLevel > 0u)
+  {
+    --mLoadLevel;
+    DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::General, "VectorAnimationScheduler::Update: Load level down [%u, utilization = %f]\n", mLoadLevel, mUtilization);
+  }
+
+  mWindowStartTime         = currentTime;
+  mWindowRasterizationTime = 0;
+}
+
+VectorAnimationScheduler::TimePoint VectorAnimationScheduler::GetNextUpdateTime() const
+{
+  return std::chrono::time_point_cast<TimePoint::duration>(mWindowStartTime + std::chrono::microseconds(WINDOW_MICROSECONDS));
+}
+
+uint32_t VectorAnimationScheduler::GetFrameInterval(VectorAnimationTask::RasterizationPriority priority) const
+{
+  const uint32_t interval = FRAME_INTERVALS[mLoadLevel][static_cast<uint32_t>(priority)];
+  return (interval == FROZEN) ? 1u : interval;
+}
+
+bool VectorAnimationScheduler::IsFrozen(VectorAnimationTask::RasterizationPriority priority) const
+{
+  return FRAME_INTERVALS[mLoadLevel][static_cast<uint32_t>(priority)] == FROZEN;
+}
+
+bool VectorAnimationScheduler::IsOverloaded() const
+{
+  return mLoadLevel > 0u;
+}
+
+Property::Map VectorAnimationScheduler::GetStatistics() const
+{
+  Property::Map map;
+  map.Insert("budget", static_cast<float>(mBudgetMicroseconds) / 1000.0f);
+  map.Insert("utilization", mUtilization);
+  map.Insert("loadLevel", static_cast<int32_t>(mLoadLevel));
+  map.Insert("skippedFrames", static_cast<int32_t>(mSkippedFrames));
+  return map;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
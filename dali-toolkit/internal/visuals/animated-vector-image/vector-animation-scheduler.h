@@ -0,0 +1,154 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_SCHEDULER_H
+#define DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_SCHEDULER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+#include <chrono>
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Adapts the frame rate of the vector animations to the load of the rasterization.
+ *
+ * Every animation used to be rasterized at its own frame rate whatever the cost, so dozens of
+ * animations on a screen delayed each other and the image loading sharing the worker threads.
+ * The rasterization time is measured against a budget per vsync interval. When it's exceeded,
+ * the animations of low priority are rasterized at 1/2 or 1/4 of their frame rate and
+ * the animations not shown are frozen until the load goes down.
+ *
+ * The load is evaluated once per window of a few vsync intervals. It goes down only when
+ * the utilization is well below the budget, so that it doesn't oscillate.
+ *
+ * It's used by the vector animation thread, which serializes the calls.
+ */
+class VectorAnimationScheduler
+{
+public:
+  using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+  /**
+   * @brief Constructor.
+   *
+   * The budget is read from the DALI_VECTOR_ANIMATION_RASTERIZATION_BUDGET environment variable
+   * in milliseconds per vsync interval. 0 disables the scheduling.
+   */
+  VectorAnimationScheduler();
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] budgetMicroseconds The rasterization time budget per vsync interval in microseconds. 0 disables the scheduling.
+   */
+  explicit VectorAnimationScheduler(int64_t budgetMicroseconds);
+
+  /**
+   * @brief Destructor.
+   */
+  ~VectorAnimationScheduler();
+
+  /**
+   * @brief Adds the time a rasterization took.
+   *
+   * @param[in] microseconds The rasterization time in microseconds
+   */
+  void AddRasterizationTime(int64_t microseconds);
+
+  /**
+   * @brief Adds the frames skipped to reduce the load.
+   *
+   * @param[in] count The number of the skipped frames
+   */
+  void AddSkippedFrames(uint32_t count);
+
+  /**
+   * @brief Evaluates the load when the current window is over.
+   *
+   * @param[in] currentTime The current time
+   */
+  void Update(TimePoint currentTime);
+
+  /**
+   * @brief Retrieves the time when the current window is over.
+   *
+   * @return The time of the next evaluation of the load
+   */
+  TimePoint GetNextUpdateTime() const;
+
+  /**
+   * @brief Retrieves the number of frames to advance for the next rasterization of an animation.
+   *
+   * @param[in] priority The priority of the animation
+   * @return The frame interval, 1 to rasterize every frame
+   */
+  uint32_t GetFrameInterval(VectorAnimationTask::RasterizationPriority priority) const;
+
+  /**
+   * @brief Queries whether the animations of a priority should not be rasterized until the load goes down.
+   *
+   * @param[in] priority The priority of the animation
+   * @return True if the animation is frozen
+   */
+  bool IsFrozen(VectorAnimationTask::RasterizationPriority priority) const;
+
+  /**
+   * @brief Queries whether any animation is degraded.
+   *
+   * @return True if the rasterization exceeded the budget
+   */
+  bool IsOverloaded() const;
+
+  /**
+   * @brief Retrieves the statistics of the scheduling.
+   *
+   * @return The map of the budget, the utilization of the last window, the load level and the skipped frames
+   */
+  Property::Map GetStatistics() const;
+
+private:
+  // Undefined
+  VectorAnimationScheduler(const VectorAnimationScheduler& scheduler) = delete;
+
+  // Undefined
+  VectorAnimationScheduler& operator=(const VectorAnimationScheduler& scheduler) = delete;
+
+private:
+  TimePoint mWindowStartTime;         ///< The start time of the current window.
+  int64_t   mBudgetMicroseconds;      ///< The rasterization time budget per vsync interval.
+  int64_t   mWindowRasterizationTime; ///< The rasterization time of the current window in microseconds.
+  float     mUtilization;             ///< The ratio of the rasterization time to the budget in the last window.
+  uint64_t  mSkippedFrames;           ///< The number of the skipped frames.
+  uint32_t  mLoadLevel;               ///< The level of the degradation.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VECTOR_ANIMATION_SCHEDULER_H
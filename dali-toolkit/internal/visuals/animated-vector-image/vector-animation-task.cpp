@@ -26,6 +26,7 @@
 #include <dali/public-api/object/property-array.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-data-cache.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-manager.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-thread.h>
 #include <dali-toolkit/internal/visuals/image/image-visual-shader-factory.h>
@@ -73,6 +74,7 @@ VectorAnimationTask::VectorAnimationTask(VisualFactoryCache& factoryCache)
   mVectorRenderer(VectorAnimationRenderer::New()),
   mAnimationData(),
   mVectorAnimationThread(factoryCache.GetVectorAnimationManager().GetVectorAnimationThread()),
+  mDataCache(factoryCache.GetVectorAnimationManager().GetDataCache()),
   mMutex(),
   mResourceReadySignal(),
   mLoadCompletedCallback(MakeCallback(this, &VectorAnimationTask::OnLoadCompleted)),
@@ -83,6 +85,8 @@ VectorAnimationTask::VectorAnimationTask(VisualFactoryCache& factoryCache)
   mLoopingMode(DevelImageVisual::LoopingMode::RESTART),
   mNextFrameStartTime(),
   mFrameDurationMicroSeconds(MICROSECONDS_PER_SECOND / 60.0f),
+  mRasterizationDurationMicroSeconds(0),
+  mRasterizationPriority(RasterizationPriority::NORMAL),
   mFrameRate(60.0f),
   mCurrentFrame(0),
   mTotalFrame(0),
@@ -149,6 +153,9 @@ void VectorAnimationTask::Finalize()
     mDestroyTask = true;
   }
 
+  // Release the references the thread keeps, e.g. of a frozen animation
+  mVectorAnimationThread.RemoveTask(this);
+
   mVectorRenderer.Finalize();
 }
 
@@ -167,6 +174,16 @@ bool VectorAnimationTask::IsAnimating()
   return mKeepAnimation;
 }
 
+VectorAnimationTask::RasterizationPriority VectorAnimationTask::GetRasterizationPriority() const
+{
+  return mRasterizationPriority.load(std::memory_order_relaxed);
+}
+
+int64_t VectorAnimationTask::GetRasterizationDuration() const
+{
+  return mRasterizationDurationMicroSeconds.load(std::memory_order_relaxed);
+}
+
 bool VectorAnimationTask::Load(bool synchronousLoading)
 {
 #ifdef TRACE_ENABLED
@@ -201,11 +218,45 @@ bool VectorAnimationTask::Load(bool synchronousLoading)
   }
   else
   {
-    Dali::Vector<uint8_t> remoteData;
-    if(!Dali::FileLoader::DownloadFileSynchronously(mImageUrl.GetUrl(), remoteData) || // Failed if we fail to download json file,
-       !mVectorRenderer.Load(remoteData))                                              // or download data is not valid vector animation file.
+    // The tasks playing the same remote animation share a single download. The event thread doesn't wait for the other tasks.
+    const std::string&                url = mImageUrl.GetUrl();
+    VectorAnimationDataCache::DataPtr remoteData;
+    const auto                        result = mDataCache.Acquire(url, !synchronousLoading, remoteData);
+    switch(result)
     {
-      mLoadFailed = true;
+      case VectorAnimationDataCache::Result::CACHED:
+      {
+        if(!mVectorRenderer.Load(*remoteData))
+        {
+          mLoadFailed = true;
+          mDataCache.Invalidate(url);
+        }
+        break;
+      }
+      case VectorAnimationDataCache::Result::FAILED:
+      {
+        mLoadFailed = true;
+        break;
+      }
+      case VectorAnimationDataCache::Result::DOWNLOAD:
+      case VectorAnimationDataCache::Result::MISS:
+      {
+        auto downloadedData = std::make_shared<Dali::Vector<uint8_t>>();
+        if(!Dali::FileLoader::DownloadFileSynchronously(url, *downloadedData) || // Failed if we fail to download json file,
+           !mVectorRenderer.Load(*downloadedData))                               // or download data is not valid vector animation file.
+        {
+          mLoadFailed = true;
+          if(result == VectorAnimationDataCache::Result::DOWNLOAD)
+          {
+            mDataCache.Cancel(url);
+          }
+        }
+        else if(result == VectorAnimationDataCache::Result::DOWNLOAD)
+        {
+          mDataCache.Add(url, downloadedData);
+        }
+        break;
+      }
     }
   }
 
@@ -319,6 +370,12 @@ void VectorAnimationTask::SetAnimationData(const AnimationData& data)
     SetSize(data.width, data.height);
   }
 
+  if(data.resendFlag & VectorAnimationTask::RESEND_PRIORITY)
+  {
+    // The vector animation thread schedules the task with the new priority from now on.
+    mRasterizationPriority.store(data.priority, std::memory_order_relaxed);
+  }
+
   mVectorAnimationThread.AddTask(this);
 }
 
@@ -601,7 +658,8 @@ bool VectorAnimationTask::Rasterize()
 {
   bool     stopped = false;
   uint32_t currentFrame;
-  mKeepAnimation = false;
+  mKeepAnimation                     = false;
+  mRasterizationDurationMicroSeconds.store(0, std::memory_order_relaxed);
 
   {
     Mutex::ScopedLock lock(mMutex);
@@ -702,7 +760,11 @@ bool VectorAnimationTask::Rasterize()
   bool renderSuccess = false;
   if(mVectorRenderer)
   {
+    auto renderStartTime = std::chrono::steady_clock::now();
+
     renderSuccess = mVectorRenderer.Render(currentFrame);
+
+    mRasterizationDurationMicroSeconds.store(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - renderStartTime).count(), std::memory_order_relaxed);
     if(!renderSuccess)
     {
       DALI_LOG_INFO(gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::Rasterize: Rendering failed. Try again later.[%d] [%p]\n", currentFrame, this);
@@ -797,12 +859,15 @@ uint32_t VectorAnimationTask::GetStoppedFrame(uint32_t startFrame, uint32_t endF
   return frame;
 }
 
-VectorAnimationTask::TimePoint VectorAnimationTask::CalculateNextFrameTime(bool renderNow)
+VectorAnimationTask::TimePoint VectorAnimationTask::CalculateNextFrameTime(bool renderNow, uint32_t frameInterval)
 {
+  // The frames skipped by the scheduler are dropped as well.
+  const uint32_t skippedFrames = (frameInterval > 1u) ? frameInterval - 1u : 0u;
+
   // std::chrono::time_point template has second parameter duration which defaults to the std::chrono::steady_clock supported
   // duration. In some C++11 implementations it is a milliseconds duration, so it fails to compile unless mNextFrameStartTime
   // is casted to use the default duration.
-  mNextFrameStartTime = std::chrono::time_point_cast<TimePoint::duration>(mNextFrameStartTime + std::chrono::microseconds(mFrameDurationMicroSeconds));
+  mNextFrameStartTime = std::chrono::time_point_cast<TimePoint::duration>(mNextFrameStartTime + std::chrono::microseconds(mFrameDurationMicroSeconds * (skippedFrames + 1u)));
   auto current        = std::chrono::steady_clock::now();
   mDroppedFrames      = 0;
 
@@ -812,7 +877,7 @@ VectorAnimationTask::TimePoint VectorAnimationTask::CalculateNextFrameTime(bool
   }
   else if(mNextFrameStartTime < current)
   {
-    uint32_t droppedFrames = 0;
+    uint32_t droppedFrames = skippedFrames;
 
     while(current > std::chrono::time_point_cast<TimePoint::duration>(mNextFrameStartTime + std::chrono::microseconds(mFrameDurationMicroSeconds)) && droppedFrames < mTotalFrame)
     {
@@ -823,6 +888,10 @@ VectorAnimationTask::TimePoint VectorAnimationTask::CalculateNextFrameTime(bool
     mNextFrameStartTime = current;
     mDroppedFrames      = droppedFrames;
   }
+  else
+  {
+    mDroppedFrames = skippedFrames;
+  }
 
   return mNextFrameStartTime;
 }
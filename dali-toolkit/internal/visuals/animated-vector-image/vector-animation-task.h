@@ -25,6 +25,7 @@
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/property-array.h>
+#include <atomic>
 #include <chrono>
 #include <memory>
 
@@ -40,6 +41,7 @@ namespace Toolkit
 namespace Internal
 {
 class VisualFactoryCache;
+class VectorAnimationDataCache;
 class VectorAnimationThread;
 class VectorAnimationTask;
 typedef IntrusivePtr<VectorAnimationTask> VectorAnimationTaskPtr;
@@ -77,6 +79,18 @@ public:
     RESEND_NEED_RESOURCE_READY        = 1 << 7,
     RESEND_DYNAMIC_PROPERTY           = 1 << 8,
     RESEND_NOTIFY_AFTER_RASTERIZATION = 1 << 9,
+    RESEND_PRIORITY                   = 1 << 10,
+  };
+
+  /**
+   * @brief The priority of the rasterization when the vector animation thread is overloaded.
+   */
+  enum class RasterizationPriority
+  {
+    OFFSCREEN, ///< The animation is not shown. It's frozen under load.
+    LOW,       ///< The animation is small. It's degraded first under load.
+    NORMAL,    ///< The animation is degraded under heavy load.
+    HIGH       ///< The animation has the focus. It's never degraded.
   };
 
   /**
@@ -96,6 +110,7 @@ public:
       height(0),
       loopCount(-1),
       playStateId(0),
+      priority(RasterizationPriority::NORMAL),
       notifyAfterRasterization(false)
     {
     }
@@ -112,6 +127,7 @@ public:
       height                   = rhs.height;
       loopCount                = rhs.loopCount;
       playStateId              = rhs.playStateId;
+      priority                 = rhs.priority;
       notifyAfterRasterization = rhs.notifyAfterRasterization;
       dynamicProperties.insert(dynamicProperties.end(), rhs.dynamicProperties.begin(), rhs.dynamicProperties.end());
       return *this;
@@ -128,6 +144,7 @@ public:
     uint32_t                             height;
     int32_t                              loopCount;
     uint32_t                             playStateId;
+    RasterizationPriority                priority;
     bool                                 notifyAfterRasterization;
   };
 
@@ -233,9 +250,11 @@ public:
 
   /**
    * @brief Calculates the time for the next frame rasterization.
+   * @param[in] renderNow True to rasterize the next frame as soon as possible
+   * @param[in] frameInterval The number of frames to advance. The frames in between are skipped.
    * @return The time for the next frame rasterization.
    */
-  TimePoint CalculateNextFrameTime(bool renderNow);
+  TimePoint CalculateNextFrameTime(bool renderNow, uint32_t frameInterval = 1u);
 
   /**
    * @brief Gets the time for the next frame rasterization.
@@ -261,6 +280,18 @@ public:
    */
   bool IsAnimating();
 
+  /**
+   * @brief Gets the priority of the rasterization.
+   * @return The priority
+   */
+  RasterizationPriority GetRasterizationPriority() const;
+
+  /**
+   * @brief Gets the time the last rasterization took.
+   * @return The time in microseconds
+   */
+  int64_t GetRasterizationDuration() const;
+
   void KeepRasterizedBuffer(bool enableFrameCache)
   {
     mEnableFrameCache = enableFrameCache;
@@ -394,6 +425,7 @@ private:
   VectorAnimationRenderer              mVectorRenderer;
   std::vector<AnimationData>           mAnimationData[2];
   VectorAnimationThread&               mVectorAnimationThread;
+  VectorAnimationDataCache&            mDataCache;
   Mutex                                mMutex;
   ResourceReadySignalType              mResourceReadySignal;
   std::unique_ptr<CallbackBase>        mAnimationFinishedCallback{};
@@ -405,6 +437,8 @@ private:
   DevelImageVisual::LoopingMode::Type  mLoopingMode;
   TimePoint                            mNextFrameStartTime;
   int64_t                              mFrameDurationMicroSeconds;
+  std::atomic<int64_t>                 mRasterizationDurationMicroSeconds;
+  std::atomic<RasterizationPriority>   mRasterizationPriority;
   float                                mFrameRate;
   uint32_t                             mCurrentFrame;
   uint32_t                             mTotalFrame;
@@ -23,6 +23,7 @@
 #include <dali/devel-api/adaptor-framework/thread-settings.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 #include <thread>
 
 namespace Dali
@@ -43,11 +44,13 @@ VectorAnimationThread::VectorAnimationThread()
 : mAnimationTasks(),
   mCompletedTasks(),
   mWorkingTasks(),
+  mFrozenTasks(),
   mSleepThread(MakeCallback(this, &VectorAnimationThread::OnAwakeFromSleep)),
   mConditionalWait(),
   mEventTriggerMutex(),
   mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
   mTraceFactory(Dali::Adaptor::Get().GetTraceFactory()),
+  mScheduler(),
   mNeedToSleep(false),
   mDestroyThread(false),
   mEventTriggered(false),
@@ -89,6 +92,13 @@ void VectorAnimationThread::AddTask(VectorAnimationTaskPtr task)
   auto iter = std::find_if(mAnimationTasks.begin(), mAnimationTasks.end(), [task](VectorAnimationTaskPtr& element) { return (element == task && !element->IsLoadRequested()); });
   if(iter == mAnimationTasks.end())
   {
+    // The animation data or the priority is changed. Resume it if it was frozen.
+    auto frozenTask = std::find(mFrozenTasks.begin(), mFrozenTasks.end(), task);
+    if(frozenTask != mFrozenTasks.end())
+    {
+      mFrozenTasks.erase(frozenTask);
+    }
+
     auto currentTime = task->CalculateNextFrameTime(true); // Rasterize as soon as possible
 
     bool inserted = false;
@@ -114,6 +124,17 @@ void VectorAnimationThread::AddTask(VectorAnimationTaskPtr task)
   }
 }
 
+void VectorAnimationThread::RemoveTask(VectorAnimationTaskPtr task)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  // The frozen list holds the only reference of a hidden animation, so it would never be released
+  mAnimationTasks.erase(std::remove(mAnimationTasks.begin(), mAnimationTasks.end(), task), mAnimationTasks.end());
+  mCompletedTasks.erase(std::remove(mCompletedTasks.begin(), mCompletedTasks.end(), task), mCompletedTasks.end());
+  mFrozenTasks.erase(std::remove(mFrozenTasks.begin(), mFrozenTasks.end(), task), mFrozenTasks.end());
+  mWorkingTasks.erase(std::remove(mWorkingTasks.begin(), mWorkingTasks.end(), task), mWorkingTasks.end());
+}
+
 void VectorAnimationThread::OnTaskCompleted(VectorAnimationTaskPtr task, bool success, bool keepAnimation)
 {
   if(!mDestroyThread)
@@ -122,10 +143,14 @@ void VectorAnimationThread::OnTaskCompleted(VectorAnimationTaskPtr task, bool su
     bool                        needRasterize = false;
 
     auto workingTask = std::find(mWorkingTasks.begin(), mWorkingTasks.end(), task);
-    if(workingTask != mWorkingTasks.end())
+    if(workingTask == mWorkingTasks.end())
     {
-      mWorkingTasks.erase(workingTask);
+      // The task was removed while rasterizing
+      return;
     }
+    mWorkingTasks.erase(workingTask);
+
+    mScheduler.AddRasterizationTime(task->GetRasterizationDuration());
 
     // Check pending task
     if(mAnimationTasks.end() != std::find(mAnimationTasks.begin(), mAnimationTasks.end(), task))
@@ -201,6 +226,15 @@ void VectorAnimationThread::RequestForceRenderOnce()
   }
 }
 
+Property::Map VectorAnimationThread::GetSchedulerStatistics()
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  Property::Map map = mScheduler.GetStatistics();
+  map.Insert("frozenAnimations", static_cast<int32_t>(mFrozenTasks.size()));
+  return map;
+}
+
 void VectorAnimationThread::Run()
 {
   SetThreadName("VectorAnimationThread");
@@ -226,13 +260,36 @@ void VectorAnimationThread::Rasterize()
 
   mNeedToSleep = true;
 
+  mScheduler.Update(std::chrono::steady_clock::now());
+
+  // Resume the frozen tasks when the load goes down
+  if(!mFrozenTasks.empty() && !mScheduler.IsOverloaded())
+  {
+    mCompletedTasks.insert(mCompletedTasks.end(), mFrozenTasks.begin(), mFrozenTasks.end());
+    mFrozenTasks.clear();
+  }
+
   // Process completed tasks
   for(auto&& task : mCompletedTasks)
   {
     if(mAnimationTasks.end() == std::find(mAnimationTasks.begin(), mAnimationTasks.end(), task))
     {
-      // Should use the frame rate of the animation file
-      auto nextFrameTime = task->CalculateNextFrameTime(false);
+      const auto priority = task->GetRasterizationPriority();
+      if(mScheduler.IsFrozen(priority))
+      {
+        // Don't rasterize the animation until the load goes down or it is shown again
+        if(mFrozenTasks.end() == std::find(mFrozenTasks.begin(), mFrozenTasks.end(), task))
+        {
+          mFrozenTasks.push_back(task);
+        }
+        continue;
+      }
+
+      // Should use the frame rate of the animation file, reduced under load
+      const uint32_t frameInterval = mScheduler.GetFrameInterval(priority);
+      mScheduler.AddSkippedFrames(frameInterval - 1u);
+
+      auto nextFrameTime = task->CalculateNextFrameTime(false, frameInterval);
 
       bool inserted = false;
       for(auto iter = mAnimationTasks.begin(); iter != mAnimationTasks.end(); ++iter)
@@ -289,6 +346,12 @@ void VectorAnimationThread::Rasterize()
       break;
     }
   }
+
+  if(mAnimationTasks.empty() && !mFrozenTasks.empty())
+  {
+    // Wake up to check whether the load goes down
+    mSleepThread.SleepUntil(mScheduler.GetNextUpdateTime());
+  }
 }
 
 void VectorAnimationThread::OnEventCallbackTriggered()
@@ -28,6 +28,7 @@
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-scheduler.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
 
 namespace Dali
@@ -59,6 +60,14 @@ public:
    */
   void AddTask(VectorAnimationTaskPtr task);
 
+  /**
+   * @brief Removes a finalized animation task from every list of the thread.
+   *
+   * @param[in] task The task to remove
+   * @note A rasterization in progress is not re-scheduled when it completes.
+   */
+  void RemoveTask(VectorAnimationTaskPtr task);
+
   /**
    * @brief Called when the rasterization is completed from the rasterize thread.
    *
@@ -95,6 +104,13 @@ public:
    */
   void RequestForceRenderOnce();
 
+  /**
+   * @brief Retrieves the statistics of the load-adaptive scheduling of the animations.
+   *
+   * @return The map of the scheduling statistics
+   */
+  Property::Map GetSchedulerStatistics();
+
 protected:
   /**
    * @brief The entry function of the animation thread.
@@ -170,6 +186,7 @@ private:
   std::vector<VectorAnimationTaskPtr>             mAnimationTasks;
   std::vector<VectorAnimationTaskPtr>             mCompletedTasks;
   std::vector<VectorAnimationTaskPtr>             mWorkingTasks;
+  std::vector<VectorAnimationTaskPtr>             mFrozenTasks; ///< The tasks not shown, which are not rasterized under load
   std::vector<std::pair<CallbackBase*, uint32_t>> mTriggerEventCallbacks{}; // Callbacks are not owned
   SleepThread                                     mSleepThread;
   ConditionalWait                                 mConditionalWait;
@@ -178,6 +195,7 @@ private:
   const Dali::LogFactoryInterface&                mLogFactory;
   const Dali::TraceFactoryInterface&              mTraceFactory;
   Dali::AsyncTaskManager                          mAsyncTaskManager;
+  VectorAnimationScheduler                        mScheduler;
 
   bool mNeedToSleep : 1;
   bool mDestroyThread : 1;
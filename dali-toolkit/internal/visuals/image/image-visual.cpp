@@ -131,6 +131,15 @@ const NameIndexMatch NAME_INDEX_MATCH_TABLE[] =
 };
 const int NAME_INDEX_MATCH_TABLE_SIZE = sizeof(NAME_INDEX_MATCH_TABLE) / sizeof(NAME_INDEX_MATCH_TABLE[0]);
 
+void CompileEnumerationProperty(Property::Value& value, const Scripting::StringEnum* table, uint32_t tableCount)
+{
+  int enumValue = 0;
+  if(value.GetType() == Property::STRING && Scripting::GetEnumerationProperty(value, table, tableCount, enumValue))
+  {
+    value = enumValue;
+  }
+}
+
 Geometry CreateGeometry(VisualFactoryCache& factoryCache, ImageDimensions gridSize)
 {
   Geometry geometry;
@@ -238,6 +247,51 @@ ImageVisual::~ImageVisual()
   }
 }
 
+void ImageVisual::CompileProperty(const Property::Key& key, Property::Index& index, Property::Value& value)
+{
+  if(index == Property::INVALID_INDEX)
+  {
+    for(int i = 0; i < NAME_INDEX_MATCH_TABLE_SIZE; ++i)
+    {
+      if(key == NAME_INDEX_MATCH_TABLE[i].name)
+      {
+        index = NAME_INDEX_MATCH_TABLE[i].index;
+        break;
+      }
+    }
+  }
+
+  switch(index)
+  {
+    case Toolkit::ImageVisual::Property::FITTING_MODE:
+    {
+      CompileEnumerationProperty(value, FITTING_MODE_TABLE, FITTING_MODE_TABLE_COUNT);
+      break;
+    }
+    case Toolkit::ImageVisual::Property::SAMPLING_MODE:
+    {
+      CompileEnumerationProperty(value, SAMPLING_MODE_TABLE, SAMPLING_MODE_TABLE_COUNT);
+      break;
+    }
+    case Toolkit::ImageVisual::Property::WRAP_MODE_U:
+    case Toolkit::ImageVisual::Property::WRAP_MODE_V:
+    {
+      CompileEnumerationProperty(value, WRAP_MODE_TABLE, WRAP_MODE_TABLE_COUNT);
+      break;
+    }
+    case Toolkit::ImageVisual::Property::RELEASE_POLICY:
+    {
+      CompileEnumerationProperty(value, RELEASE_POLICY_TABLE, RELEASE_POLICY_TABLE_COUNT);
+      break;
+    }
+    case Toolkit::ImageVisual::Property::LOAD_POLICY:
+    {
+      CompileEnumerationProperty(value, LOAD_POLICY_TABLE, LOAD_POLICY_TABLE_COUNT);
+      break;
+    }
+  }
+}
+
 void ImageVisual::DoSetProperties(const Property::Map& propertyMap)
 {
   // Url is already received in constructor
@@ -154,6 +154,13 @@ public:
                             FittingMode::Type         fittingMode  = FittingMode::VISUAL_FITTING,
                             Dali::SamplingMode::Type  samplingMode = SamplingMode::BOX_THEN_LINEAR);
 
+  /**
+   * @brief Converts a string key and an enumeration name of a property of the image visual.
+   *
+   * @see Visual::Base::PropertyCompiler
+   */
+  static void CompileProperty(const Property::Key& key, Property::Index& index, Property::Value& value);
+
 public: // from Visual
   /**
    * @copydoc Visual::Base::GetNaturalSize
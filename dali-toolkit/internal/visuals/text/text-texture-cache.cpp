@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/text/text-texture-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/character-spacing-glyph-run.h>
+#include <dali-toolkit/internal/text/line-run.h>
+#include <dali-toolkit/internal/text/strikethrough-glyph-run.h>
+#include <dali-toolkit/internal/text/underlined-glyph-run.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+constexpr auto TEXT_TEXTURE_CACHE_ENV = "DALI_TEXT_TEXTURE_CACHE";
+
+bool IsTextTextureCacheEnabled()
+{
+  auto textTextureCacheString = Dali::EnvironmentVariable::GetEnvironmentVariable(TEXT_TEXTURE_CACHE_ENV);
+  return textTextureCacheString ? (std::atoi(textTextureCacheString) != 0) : false;
+}
+
+template<typename T>
+void Append(std::string& key, T value)
+{
+  static_assert(std::is_arithmetic<T>::value, "Only numbers are appended byte by byte");
+  key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void Append(std::string& key, const Vector2& value)
+{
+  Append(key, value.x);
+  Append(key, value.y);
+}
+
+void Append(std::string& key, const Vector4& value)
+{
+  Append(key, value.r);
+  Append(key, value.g);
+  Append(key, value.b);
+  Append(key, value.a);
+}
+
+void Append(std::string& key, const Text::GlyphRun& glyphRun)
+{
+  Append(key, glyphRun.glyphIndex);
+  Append(key, glyphRun.numberOfGlyphs);
+}
+
+template<typename T>
+void AppendArray(std::string& key, const T* values, Text::Length count)
+{
+  Append(key, count);
+  if(values)
+  {
+    for(Text::Length index = 0u; index < count; ++index)
+    {
+      Append(key, values[index]);
+    }
+  }
+}
+
+void AppendGlyphs(std::string& key, const Text::GlyphInfo* glyphs, Text::Length count)
+{
+  Append(key, count);
+  for(Text::Length index = 0u; glyphs && (index < count); ++index)
+  {
+    const Text::GlyphInfo& glyph = glyphs[index];
+    Append(key, glyph.fontId);
+    Append(key, glyph.index);
+    Append(key, glyph.width);
+    Append(key, glyph.height);
+    Append(key, glyph.xBearing);
+    Append(key, glyph.yBearing);
+    Append(key, glyph.advance);
+    Append(key, static_cast<uint8_t>((glyph.isItalicRequired ? 1u : 0u) | (glyph.isBoldRequired ? 2u : 0u)));
+  }
+}
+
+/**
+ * The colors of the glyphs, rather than the indices and the colors, as the number of colors isn't known.
+ * The index 0 is the default color, or no color for the background.
+ */
+void AppendGlyphColors(std::string& key, const Vector4* colors, const Text::ColorIndex* colorIndices, Text::Length count)
+{
+  const bool hasColors = (colors != nullptr) && (colorIndices != nullptr);
+  Append(key, static_cast<uint8_t>(hasColors ? 1u : 0u));
+  for(Text::Length index = 0u; hasColors && (index < count); ++index)
+  {
+    const Text::ColorIndex colorIndex = colorIndices[index];
+    Append(key, colorIndex);
+    if(colorIndex != 0u)
+    {
+      Append(key, colors[colorIndex - 1u]);
+    }
+  }
+}
+
+void AppendLines(std::string& key, const Text::LineRun* lines, Text::Length count)
+{
+  Append(key, count);
+  for(Text::Length index = 0u; lines && (index < count); ++index)
+  {
+    const Text::LineRun& line = lines[index];
+    Append(key, line.glyphRun);
+    Append(key, line.width);
+    Append(key, line.ascender);
+    Append(key, line.descender);
+    Append(key, line.extraLength);
+    Append(key, line.alignmentOffset);
+    Append(key, line.lineSpacing);
+    Append(key, static_cast<uint8_t>((line.direction ? 1u : 0u) | (line.ellipsis ? 2u : 0u) | (line.isSplitToTwoHalves ? 4u : 0u)));
+    Append(key, line.glyphRunSecondHalf);
+  }
+}
+
+void AppendUnderlineRuns(std::string& key, const Text::ModelInterface& model)
+{
+  const Text::Length numberOfRuns = model.GetNumberOfUnderlineRuns();
+  Append(key, numberOfRuns);
+  if(numberOfRuns == 0u)
+  {
+    return;
+  }
+
+  std::vector<Text::UnderlinedGlyphRun> runs(numberOfRuns);
+  model.GetUnderlineRuns(runs.data(), 0u, numberOfRuns);
+  for(const auto& run : runs)
+  {
+    const Text::UnderlineStyleProperties& properties = run.properties;
+    Append(key, run.glyphRun);
+    Append(key, static_cast<uint32_t>(properties.type));
+    Append(key, properties.color);
+    Append(key, properties.height);
+    Append(key, properties.dashGap);
+    Append(key, properties.dashWidth);
+    Append(key, static_cast<uint8_t>((properties.typeDefined ? 1u : 0u) | (properties.colorDefined ? 2u : 0u) | (properties.heightDefined ? 4u : 0u) | (properties.dashGapDefined ? 8u : 0u) | (properties.dashWidthDefined ? 16u : 0u)));
+  }
+}
+
+void AppendStrikethroughRuns(std::string& key, const Text::ModelInterface& model)
+{
+  const Text::Length numberOfRuns = model.GetNumberOfStrikethroughRuns();
+  Append(key, numberOfRuns);
+  if(numberOfRuns == 0u)
+  {
+    return;
+  }
+
+  std::vector<Text::StrikethroughGlyphRun> runs(numberOfRuns);
+  model.GetStrikethroughRuns(runs.data(), 0u, numberOfRuns);
+  for(const auto& run : runs)
+  {
+    const Text::StrikethroughStyleProperties& properties = run.properties;
+    Append(key, run.glyphRun);
+    Append(key, properties.color);
+    Append(key, properties.height);
+    Append(key, static_cast<uint8_t>((properties.colorDefined ? 1u : 0u) | (properties.heightDefined ? 2u : 0u)));
+  }
+}
+
+} // unnamed namespace
+
+TextTextureCache::TextTextureCache()
+: mTextureSets(),
+  mEnabled(IsTextTextureCacheEnabled())
+{
+}
+
+TextTextureCache::~TextTextureCache()
+{
+}
+
+std::string TextTextureCache::CreateKey(const Text::ModelInterface& model, const Vector2& size, DevelText::TextDirection::Type textDirection, uint32_t shaderFeatures)
+{
+  std::string key;
+
+  // Where and how the text is rendered.
+  Append(key, size);
+  Append(key, static_cast<uint32_t>(textDirection));
+  Append(key, shaderFeatures);
+  Append(key, model.GetControlSize());
+  Append(key, model.GetLayoutSize());
+  Append(key, model.GetScrollPosition());
+  Append(key, static_cast<uint32_t>(model.GetHorizontalAlignment()));
+  Append(key, static_cast<uint32_t>(model.GetVerticalAlignment()));
+  Append(key, static_cast<uint32_t>(model.GetVerticalLineAlignment()));
+  Append(key, static_cast<uint32_t>(model.GetEllipsisPosition()));
+  Append(key, static_cast<uint8_t>((model.IsTextElideEnabled() ? 1u : 0u) | (model.IsRemoveFrontInset() ? 2u : 0u) | (model.IsRemoveBackInset() ? 4u : 0u)));
+
+  // The laid-out text.
+  AppendArray(key, model.GetTextBuffer(), model.GetNumberOfCharacters());
+  AppendGlyphs(key, model.GetGlyphs(), model.GetNumberOfGlyphs());
+  AppendArray(key, model.GetLayout(), model.GetNumberOfGlyphs());
+  AppendLines(key, model.GetLines(), model.GetNumberOfLines());
+  Append(key, model.GetStartIndexOfElidedGlyphs());
+  Append(key, model.GetEndIndexOfElidedGlyphs());
+  Append(key, model.GetFirstMiddleIndexOfElidedGlyphs());
+  Append(key, model.GetSecondMiddleIndexOfElidedGlyphs());
+  AppendGlyphs(key, model.GetHyphens(), model.GetHyphensCount());
+  AppendArray(key, model.GetHyphenIndices(), model.GetHyphensCount());
+
+  // The colors.
+  Append(key, model.GetDefaultColor());
+  AppendGlyphColors(key, model.GetColors(), model.GetColorIndices(), model.GetNumberOfGlyphs());
+  AppendGlyphColors(key, model.GetBackgroundColors(), model.GetBackgroundColorIndices(), model.GetNumberOfGlyphs());
+
+  // The styles.
+  Append(key, model.GetShadowOffset());
+  Append(key, model.GetShadowColor());
+  Append(key, model.GetShadowBlurRadius());
+  Append(key, model.GetOutlineOffset());
+  Append(key, model.GetOutlineColor());
+  Append(key, model.GetOutlineWidth());
+  Append(key, model.GetOutlineBlurRadius());
+  Append(key, model.GetBackgroundColor());
+  Append(key, model.GetUnderlineColor());
+  Append(key, model.GetUnderlineHeight());
+  Append(key, static_cast<uint32_t>(model.GetUnderlineType()));
+  Append(key, model.GetDashedUnderlineWidth());
+  Append(key, model.GetDashedUnderlineGap());
+  Append(key, model.GetStrikethroughColor());
+  Append(key, model.GetStrikethroughHeight());
+  Append(key, model.GetCharacterSpacing());
+  Append(key, static_cast<uint8_t>((model.IsBackgroundEnabled() ? 1u : 0u) | (model.IsUnderlineEnabled() ? 2u : 0u) | (model.IsStrikethroughEnabled() ? 4u : 0u) | (model.IsMarkupProcessorEnabled() ? 8u : 0u) | (model.IsSpannedTextPlaced() ? 16u : 0u)));
+  Append(key, static_cast<uint8_t>((model.IsMarkupUnderlineSet() ? 1u : 0u) | (model.IsMarkupStrikethroughSet() ? 2u : 0u) | (model.IsMarkupBackgroundColorSet() ? 4u : 0u)));
+  AppendUnderlineRuns(key, model);
+  AppendStrikethroughRuns(key, model);
+
+  const Vector<Text::CharacterSpacingGlyphRun>& characterSpacingRuns = model.GetCharacterSpacingGlyphRuns();
+  Append(key, characterSpacingRuns.Count());
+  for(const auto& run : characterSpacingRuns)
+  {
+    Append(key, run.glyphRun);
+    Append(key, run.value);
+  }
+
+  return key;
+}
+
+TextureSet TextTextureCache::Acquire(const std::string& key)
+{
+  auto iter = mTextureSets.find(key);
+  if(iter == mTextureSets.end())
+  {
+    return TextureSet();
+  }
+
+  ++iter->second.referenceCount;
+  return iter->second.textureSet;
+}
+
+void TextTextureCache::Add(const std::string& key, TextureSet textureSet)
+{
+  DALI_ASSERT_DEBUG(mTextureSets.find(key) == mTextureSets.end() && "Texture set already cached");
+  mTextureSets.emplace(key, Entry{textureSet, 1u});
+}
+
+void TextTextureCache::Release(const std::string& key)
+{
+  auto iter = mTextureSets.find(key);
+  if(iter == mTextureSets.end())
+  {
+    return;
+  }
+
+  if(--iter->second.referenceCount == 0u)
+  {
+    mTextureSets.erase(iter);
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,145 @@
+#ifndef DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/rendering/texture-set.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
+#include <dali-toolkit/internal/text/text-model-interface.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Shares the textures of text visuals which render the same content.
+ *
+ * Many labels of a UI show the same text with the same style, like the captions of repeated buttons.
+ * The texture set of a text visual is stored with a key which describes everything the typesetter
+ * reads from the laid-out text model: the glyphs and their positions, the colors, the styles,
+ * the alignment and the size. A text visual with the same key uses the same texture set instead
+ * of rendering its own.
+ *
+ * The texture sets are reference counted by the text visuals using them, and removed from the cache
+ * when the last one releases them.
+ *
+ * The cache is disabled unless the DALI_TEXT_TEXTURE_CACHE environment variable is set to 1.
+ * Owned by VisualFactoryCache.
+ */
+class TextTextureCache
+{
+public:
+  /**
+   * @brief Constructor.
+   */
+  TextTextureCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~TextTextureCache();
+
+  /**
+   * @brief Whether the text visuals should share their textures.
+   *
+   * @return true if the cache is enabled.
+   */
+  bool IsEnabled() const
+  {
+    return mEnabled;
+  }
+
+  /**
+   * @brief Creates the key of a texture set.
+   *
+   * @param[in] model The laid-out text model.
+   * @param[in] size The size of the texture.
+   * @param[in] textDirection The direction of the text.
+   * @param[in] shaderFeatures The features of the text visual shader, which decide the textures of the set.
+   *
+   * @return The key.
+   */
+  static std::string CreateKey(const Text::ModelInterface& model, const Vector2& size, DevelText::TextDirection::Type textDirection, uint32_t shaderFeatures);
+
+  /**
+   * @brief Retrieves a texture set and adds a reference to it.
+   *
+   * @param[in] key The key of the texture set.
+   *
+   * @return The texture set, or an empty handle if there is none with this key.
+   */
+  TextureSet Acquire(const std::string& key);
+
+  /**
+   * @brief Adds a texture set with a single reference.
+   *
+   * @param[in] key The key of the texture set. There must not be a texture set with this key already.
+   * @param[in] textureSet The texture set.
+   */
+  void Add(const std::string& key, TextureSet textureSet);
+
+  /**
+   * @brief Removes a reference to a texture set, and the texture set itself when it was the last one.
+   *
+   * @param[in] key The key of the texture set.
+   */
+  void Release(const std::string& key);
+
+  /**
+   * @brief Retrieves the number of texture sets in the cache.
+   *
+   * @return The number of texture sets.
+   */
+  std::size_t GetCount() const
+  {
+    return mTextureSets.size();
+  }
+
+private:
+  // Undefined
+  TextTextureCache(const TextTextureCache&) = delete;
+
+  // Undefined
+  TextTextureCache& operator=(const TextTextureCache&) = delete;
+
+private:
+  struct Entry
+  {
+    TextureSet textureSet;
+    uint32_t   referenceCount;
+  };
+
+  std::unordered_map<std::string, Entry> mTextureSets; ///< The texture sets by their keys.
+  bool                                   mEnabled;     ///< Whether the cache is enabled.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
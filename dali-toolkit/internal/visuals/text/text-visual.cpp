@@ -36,7 +36,9 @@
 #include <dali-toolkit/internal/text/text-effects-style.h>
 #include <dali-toolkit/internal/text/text-enumerations-impl.h>
 #include <dali-toolkit/internal/text/text-font-style.h>
+#include <dali-toolkit/internal/text/text-profiler.h>
 #include <dali-toolkit/internal/visuals/image/image-atlas-manager.h>
+#include <dali-toolkit/internal/visuals/text/text-texture-cache.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
@@ -269,6 +271,7 @@ TextVisual::TextVisual(VisualFactoryCache& factoryCache, TextVisualShaderFactory
 
 TextVisual::~TextVisual()
 {
+  ReleaseSharedTexture();
 }
 
 void TextVisual::OnInitialize()
@@ -714,6 +717,10 @@ void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultiple
   // If the pixel data exceeds the maximum size, tiling is required.
   else
   {
+    ReleaseSharedTexture();
+
+    Text::ProfilerScope profilerScope(Text::TextProfiler::Stage::TYPESETTING, &mController->GetProfilerStatistics());
+
     // Filter mode needs to be set to linear to produce better quality while scaling.
     Sampler sampler = Sampler::New();
     sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
@@ -830,6 +837,48 @@ void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultiple
 
 TextureSet TextVisual::GetTextTexture(const Vector2& size)
 {
+  TextTextureCache& textureCache = mFactoryCache.GetTextTextureCache();
+  if(!textureCache.IsEnabled() || mController->IsTextCutout())
+  {
+    ReleaseSharedTexture();
+    return RenderTextTexture(size);
+  }
+
+  // Labels with the same content and style share a single texture.
+  const uint32_t shaderFeatures = (mTextShaderFeatureCache.IsEnabledMultiColor() ? 1u : 0u) |
+                                  (mTextShaderFeatureCache.IsEnabledEmoji() ? 2u : 0u) |
+                                  (mTextShaderFeatureCache.IsEnabledStyle() ? 4u : 0u) |
+                                  (mTextShaderFeatureCache.IsEnabledOverlay() ? 8u : 0u);
+
+  std::string textureCacheKey = TextTextureCache::CreateKey(*mController->GetTextModel(), size, mController->GetTextDirection(), shaderFeatures);
+
+  TextureSet textureSet = textureCache.Acquire(textureCacheKey);
+  if(!textureSet)
+  {
+    textureSet = RenderTextTexture(size);
+    textureCache.Add(textureCacheKey, textureSet);
+  }
+
+  // Release the previous texture after acquiring the new one, so an unchanged texture isn't removed from the cache.
+  ReleaseSharedTexture();
+  mTextureCacheKey = std::move(textureCacheKey);
+
+  return textureSet;
+}
+
+void TextVisual::ReleaseSharedTexture()
+{
+  if(!mTextureCacheKey.empty())
+  {
+    mFactoryCache.GetTextTextureCache().Release(mTextureCacheKey);
+    mTextureCacheKey.clear();
+  }
+}
+
+TextureSet TextVisual::RenderTextTexture(const Vector2& size)
+{
+  Text::ProfilerScope profilerScope(Text::TextProfiler::Stage::TYPESETTING, &mController->GetProfilerStatistics());
+
   const bool cutoutEnabled = mController->IsTextCutout();
 
   // Filter mode needs to be set to linear to produce better quality while scaling.
@@ -23,6 +23,7 @@
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
 #include <dali/public-api/rendering/visual-renderer.h>
+#include <string>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/controller/text-controller.h>
@@ -295,6 +296,17 @@ private:
    */
   TextureSet GetTextTexture(const Vector2& size);
 
+  /**
+   * Render the texture of the text. It will use cached shader feature for text visual.
+   * @param[in] size The texture size.
+   */
+  TextureSet RenderTextTexture(const Vector2& size);
+
+  /**
+   * Release the texture shared through the text texture cache, if any.
+   */
+  void ReleaseSharedTexture();
+
   /**
    * Get the text rendering shader.
    * @param[in] factoryCache A pointer pointing to the VisualFactoryCache object
@@ -338,6 +350,7 @@ private:
   bool              mRendererUpdateNeeded : 1;         ///< The flag to indicate whether the renderer needs to be updated.
   bool              mTextRequireRender : 1;            ///< The flag to indicate whether the text needs to be rendered.
   RendererContainer mRendererList;
+  std::string       mTextureCacheKey; ///< The key of the texture shared through the text texture cache, or empty.
 };
 
 } // namespace Internal
@@ -215,6 +215,41 @@ void Visual::Base::SetCustomShader(const Property::Map& shaderMap)
   UpdateShader();
 }
 
+Property::Map Visual::Base::CompileProperties(const Property::Map& propertyMap, PropertyCompiler compileProperty)
+{
+  Property::Map compiledMap;
+  for(size_t i = 0; i < propertyMap.Count(); ++i)
+  {
+    const KeyValuePair&  pair  = propertyMap.GetKeyValue(i);
+    const Property::Key& key   = pair.first;
+    Property::Value      value = pair.second;
+    Property::Index      index = GetVisualPropertyIndex(key);
+
+    if(index == Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE)
+    {
+      int fittingMode = 0;
+      if(value.GetType() == Property::STRING && Scripting::GetEnumerationProperty(value, VISUAL_FITTING_MODE_TABLE, VISUAL_FITTING_MODE_TABLE_COUNT, fittingMode))
+      {
+        value = fittingMode;
+      }
+    }
+    else if(compileProperty)
+    {
+      compileProperty(key, index, value);
+    }
+
+    if(index != Property::INVALID_INDEX)
+    {
+      compiledMap.Insert(index, value);
+    }
+    else
+    {
+      compiledMap.Insert(key.stringKey, value);
+    }
+  }
+  return compiledMap;
+}
+
 void Visual::Base::SetProperties(const Property::Map& propertyMap)
 {
   bool needUpdateShader = false;
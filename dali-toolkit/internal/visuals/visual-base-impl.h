@@ -76,6 +76,25 @@ public:
    */
   void SetProperties(const Property::Map& propertyMap);
 
+  /**
+   * @brief Converts a string key and an enumeration name of a property specific to a visual type.
+   *
+   * @param[in] key The key of the property
+   * @param[in,out] index The index of the key, or INVALID_INDEX if it's a string key not known yet
+   * @param[in,out] value The value of the property
+   */
+  using PropertyCompiler = void (*)(const Property::Key& key, Property::Index& index, Property::Value& value);
+
+  /**
+   * Converts the string keys and the enumeration names of the properties to the indices and the integers,
+   * so that the visuals created with the converted map don't compare the strings.
+   * The keys unknown to the visual type are kept as they are.
+   * @param[in] propertyMap The properties for the requested Visual object.
+   * @param[in] compileProperty The converter of the properties specific to the visual type, or nullptr
+   * @return The converted properties
+   */
+  static Property::Map CompileProperties(const Property::Map& propertyMap, PropertyCompiler compileProperty);
+
   /**
    * @copydoc Toolkit::Visual::Base::SetName
    */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/scripting/scripting.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/image/image-visual.h>
+#include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+VisualDescriptorPtr VisualDescriptor::New(const Property::Map& propertyMap)
+{
+  return VisualDescriptorPtr(new VisualDescriptor(propertyMap));
+}
+
+VisualDescriptor::VisualDescriptor(const Property::Map& propertyMap)
+: mPropertyMap(),
+  mUrlArray(),
+  mUrl(),
+  mVisualType(Toolkit::DevelVisual::IMAGE) // Default to IMAGE type.
+{
+  Property::Value* typeValue = propertyMap.Find(Toolkit::Visual::Property::TYPE, VISUAL_TYPE);
+  if(typeValue)
+  {
+    Scripting::GetEnumerationProperty(*typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, mVisualType);
+  }
+
+  Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
+  if(imageURLValue)
+  {
+    std::string imageUrl;
+    if(imageURLValue->Get(imageUrl))
+    {
+      if(!imageUrl.empty())
+      {
+        mUrl = VisualUrl(imageUrl);
+      }
+    }
+    else
+    {
+      Property::Array* array = imageURLValue->GetArray();
+      if(array)
+      {
+        mUrlArray = *array;
+      }
+    }
+  }
+
+  // The other visuals recognize different subsets of the image property names,
+  // so only the common properties are converted for them.
+  Visual::Base::PropertyCompiler compileProperty = nullptr;
+  if(mVisualType == Toolkit::DevelVisual::IMAGE && mUrl.IsValid() && mUrl.GetType() == VisualUrl::REGULAR_IMAGE)
+  {
+    compileProperty = &ImageVisual::CompileProperty;
+  }
+  mPropertyMap = Visual::Base::CompileProperties(propertyMap, compileProperty);
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,131 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/property-array.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class VisualDescriptor;
+typedef IntrusivePtr<VisualDescriptor> VisualDescriptorPtr;
+
+/**
+ * VisualDescriptor holds the result of parsing the property map of a visual.
+ */
+class VisualDescriptor : public BaseObject
+{
+public:
+  /**
+   * @copydoc Toolkit::VisualDescriptor::New()
+   */
+  static VisualDescriptorPtr New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Retrieves the visual type.
+   * @return The visual type, IMAGE if the map doesn't have it
+   */
+  Toolkit::DevelVisual::Type GetVisualType() const
+  {
+    return mVisualType;
+  }
+
+  /**
+   * @brief Retrieves the parsed url.
+   * @return The url, invalid if the map doesn't have a non-empty url string
+   */
+  const VisualUrl& GetUrl() const
+  {
+    return mUrl;
+  }
+
+  /**
+   * @brief Retrieves the array of the urls of the animated image.
+   * @return The urls, empty if the map doesn't have an url array
+   */
+  const Property::Array& GetUrlArray() const
+  {
+    return mUrlArray;
+  }
+
+  /**
+   * @copydoc Toolkit::VisualDescriptor::GetPropertyMap()
+   */
+  const Property::Map& GetPropertyMap() const
+  {
+    return mPropertyMap;
+  }
+
+private:
+  /**
+   * @brief Constructor.
+   * @param[in] propertyMap The properties of the visual
+   */
+  explicit VisualDescriptor(const Property::Map& propertyMap);
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  ~VisualDescriptor() override = default;
+
+  // Undefined
+  VisualDescriptor(const VisualDescriptor&) = delete;
+
+  // Undefined
+  VisualDescriptor& operator=(const VisualDescriptor&) = delete;
+
+private:
+  Property::Map              mPropertyMap; ///< The properties with the converted keys and values
+  Property::Array            mUrlArray;    ///< The urls of the animated image
+  VisualUrl                  mUrl;         ///< The parsed url
+  Toolkit::DevelVisual::Type mVisualType;  ///< The visual type
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::VisualDescriptor& GetImplementation(Dali::Toolkit::VisualDescriptor& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::VisualDescriptor&>(object);
+}
+
+inline const Internal::VisualDescriptor& GetImplementation(const Dali::Toolkit::VisualDescriptor& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::VisualDescriptor&>(object);
+}
+
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
@@ -33,6 +33,7 @@
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
 #include <dali-toolkit/internal/visuals/image/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/text/text-texture-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 
 namespace Dali
@@ -60,6 +61,7 @@ VisualFactoryCache::VisualFactoryCache(bool preMultiplyOnLoad)
 : mLoadYuvPlanes(NeedToLoadYuvPlanes()),
   mTextureManager(mLoadYuvPlanes),
   mVectorAnimationManager(nullptr),
+  mTextTextureCache(nullptr),
   mPreMultiplyOnLoad(preMultiplyOnLoad),
   mBrokenImageInfoContainer(),
   mDefaultBrokenImageUrl(""),
@@ -156,6 +158,15 @@ VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
   return *mVectorAnimationManager;
 }
 
+TextTextureCache& VisualFactoryCache::GetTextTextureCache()
+{
+  if(!mTextTextureCache)
+  {
+    mTextTextureCache = std::unique_ptr<TextTextureCache>(new TextTextureCache());
+  }
+  return *mTextTextureCache;
+}
+
 Geometry VisualFactoryCache::CreateGridGeometry(Uint16Pair gridSize)
 {
   uint16_t gridWidth  = gridSize.GetWidth();
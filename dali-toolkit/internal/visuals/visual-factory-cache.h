@@ -38,6 +38,7 @@ namespace Internal
 {
 class ImageAtlasManager;
 class NPatchLoader;
+class TextTextureCache;
 class TextureManager;
 class VectorAnimationManager;
 
@@ -263,6 +264,12 @@ public:
    */
   VectorAnimationManager& GetVectorAnimationManager();
 
+  /**
+   * Get the cache of the textures shared by text visuals.
+   * @return A reference to the text texture cache.
+   */
+  TextTextureCache& GetTextTextureCache();
+
 protected:
   /**
    * Undefined copy constructor.
@@ -358,6 +365,7 @@ private:
   NPatchLoader         mNPatchLoader;
 
   std::unique_ptr<VectorAnimationManager> mVectorAnimationManager;
+  std::unique_ptr<TextTextureCache>       mTextTextureCache;
   bool                                    mPreMultiplyOnLoad;
   std::vector<BrokenImageInfo>            mBrokenImageInfoContainer;
   std::string                             mDefaultBrokenImageUrl;
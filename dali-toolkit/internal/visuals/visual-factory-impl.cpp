@@ -45,6 +45,7 @@
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 #include <dali-toolkit/internal/visuals/text/text-visual-shader-factory.h>
 #include <dali-toolkit/internal/visuals/text/text-visual.h>
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
@@ -136,8 +137,6 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
 Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyMap, Toolkit::VisualFactory::CreationOptions creationOptions)
 {
-  Visual::BasePtr visualPtr;
-
   Property::Value*           typeValue  = propertyMap.Find(Toolkit::Visual::Property::TYPE, VISUAL_TYPE);
   Toolkit::DevelVisual::Type visualType = Toolkit::DevelVisual::IMAGE; // Default to IMAGE type.
   if(typeValue)
@@ -145,6 +144,49 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
     Scripting::GetEnumerationProperty(*typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType);
   }
 
+  VisualUrl        visualUrl;
+  Property::Array  urlArray;
+  Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
+  if(imageURLValue)
+  {
+    std::string imageUrl;
+    if(imageURLValue->Get(imageUrl))
+    {
+      if(!imageUrl.empty())
+      {
+        visualUrl = VisualUrl(imageUrl);
+      }
+    }
+    else
+    {
+      Property::Array* array = imageURLValue->GetArray();
+      if(array)
+      {
+        urlArray = *array;
+      }
+    }
+  }
+
+  return CreateVisualInternal(visualType, visualUrl, urlArray, propertyMap, creationOptions);
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual(const Toolkit::VisualDescriptor& descriptor)
+{
+  return CreateVisual(descriptor, mDefaultCreationOptions);
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual(const Toolkit::VisualDescriptor& descriptor, Toolkit::VisualFactory::CreationOptions creationOptions)
+{
+  // The type, the url and the keys are already parsed by the descriptor.
+  const Internal::VisualDescriptor& descriptorImpl = GetImplementation(descriptor);
+
+  return CreateVisualInternal(descriptorImpl.GetVisualType(), descriptorImpl.GetUrl(), descriptorImpl.GetUrlArray(), descriptorImpl.GetPropertyMap(), creationOptions);
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisualInternal(Toolkit::DevelVisual::Type visualType, const VisualUrl& visualUrl, const Property::Array& urlArray, const Property::Map& propertyMap, Toolkit::VisualFactory::CreationOptions creationOptions)
+{
+  Visual::BasePtr visualPtr;
+
   switch(visualType)
   {
     case Toolkit::Visual::BORDER:
@@ -168,61 +210,47 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
     case Toolkit::Visual::IMAGE:
     case Toolkit::Visual::ANIMATED_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue)
+      if(visualUrl.IsValid())
       {
-        if(imageURLValue->Get(imageUrl))
+        switch(visualUrl.GetType())
         {
-          if(!imageUrl.empty())
+          case VisualUrl::N_PATCH:
           {
-            VisualUrl visualUrl(imageUrl);
-
-            switch(visualUrl.GetType())
+            visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::TVG:
+          case VisualUrl::SVG:
+          {
+            visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::JSON:
+          {
+            visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::GIF:
+          case VisualUrl::WEBP:
+          {
+            if(visualType == Toolkit::DevelVisual::ANIMATED_IMAGE || !(creationOptions & Toolkit::VisualFactory::CreationOptions::IMAGE_VISUAL_LOAD_STATIC_IMAGES_ONLY))
             {
-              case VisualUrl::N_PATCH:
-              {
-                visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::TVG:
-              case VisualUrl::SVG:
-              {
-                visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::JSON:
-              {
-                visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::GIF:
-              case VisualUrl::WEBP:
-              {
-                if(visualType == Toolkit::DevelVisual::ANIMATED_IMAGE || !(creationOptions & Toolkit::VisualFactory::CreationOptions::IMAGE_VISUAL_LOAD_STATIC_IMAGES_ONLY))
-                {
-                  visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                  break;
-                }
-                DALI_FALLTHROUGH;
-              }
-              case VisualUrl::REGULAR_IMAGE:
-              {
-                visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
+              visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+              break;
             }
+            DALI_FALLTHROUGH;
           }
-        }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if(array && array->Count() > 0)
+          case VisualUrl::REGULAR_IMAGE:
           {
-            visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap);
+            visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
           }
         }
       }
+      else if(urlArray.Count() > 0)
+      {
+        visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), urlArray, propertyMap);
+      }
       break;
     }
 
@@ -252,28 +280,18 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
     case Toolkit::Visual::N_PATCH:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
 
     case Toolkit::Visual::SVG:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
@@ -286,14 +304,9 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
     case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
@@ -305,12 +318,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
     }
   }
 
-  DALI_LOG_INFO(gLogFilter, Debug::Concise, "VisualFactory::CreateVisual( VisualType:%s %s%s)\n", Scripting::GetEnumerationName<Toolkit::DevelVisual::Type>(visualType, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT), (visualType == Toolkit::DevelVisual::IMAGE) ? "url:" : "", (visualType == Toolkit::DevelVisual::IMAGE) ? (([&]() {
-                  // Return URL if present in PropertyMap else return "not found message"
-                  Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-                  return (imageURLValue) ? imageURLValue->Get<std::string>().c_str() : "url not found in PropertyMap";
-                })())
-                                                                                                                                                                                                                                                                                                                            : "");
+  DALI_LOG_INFO(gLogFilter, Debug::Concise, "VisualFactory::CreateVisual( VisualType:%s url:%s)\n", Scripting::GetEnumerationName<Toolkit::DevelVisual::Type>(visualType, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT), visualUrl.GetUrl().c_str());
 
   if(!visualPtr)
   {
@@ -450,6 +458,11 @@ Internal::TextureManager& VisualFactory::GetTextureManager()
   return GetFactoryCache().GetTextureManager();
 }
 
+Internal::VectorAnimationManager& VisualFactory::GetVectorAnimationManager()
+{
+  return GetFactoryCache().GetVectorAnimationManager();
+}
+
 void VisualFactory::SetBrokenImageUrl(Toolkit::StyleManager& styleManager)
 {
   const std::string        imageDirPath   = AssetManager::GetDaliImagePath();
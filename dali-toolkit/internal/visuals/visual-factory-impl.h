@@ -26,6 +26,7 @@
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
 
 namespace Dali
@@ -37,6 +38,7 @@ namespace Internal
 class VisualFactoryCache;
 class ImageVisualShaderFactory;
 class TextVisualShaderFactory;
+class VectorAnimationManager;
 
 /**
  * @copydoc Toolkit::VisualFactory
@@ -86,6 +88,16 @@ public:
    */
   Toolkit::Visual::Base CreateVisual(const std::string& image, ImageDimensions size, Toolkit::VisualFactory::CreationOptions creationOptions);
 
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const Toolkit::VisualDescriptor& )
+   */
+  Toolkit::Visual::Base CreateVisual(const Toolkit::VisualDescriptor& descriptor);
+
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const Toolkit::VisualDescriptor&, Toolkit::VisualFactory::CreationOptions )
+   */
+  Toolkit::Visual::Base CreateVisual(const Toolkit::VisualDescriptor& descriptor, Toolkit::VisualFactory::CreationOptions creationOptions);
+
   /**
    * @copydoc Toolkit::VisualFactory::SetPreMultiplyOnLoad()
    */
@@ -121,6 +133,11 @@ public:
    */
   Internal::TextureManager& GetTextureManager();
 
+  /**
+   * @return the reference to vector animation manager
+   */
+  Internal::VectorAnimationManager& GetVectorAnimationManager();
+
 protected:
   /**
    * A reference counted object may only be deleted by calling Unreference()
@@ -128,6 +145,17 @@ protected:
   ~VisualFactory() override;
 
 private:
+  /**
+   * @brief Creates the visual of the given type from the already parsed url and properties.
+   * @param[in] visualType The type of the visual
+   * @param[in] visualUrl The url of the image, invalid if there is none
+   * @param[in] urlArray The urls of the animated image frames, empty if there are none
+   * @param[in] propertyMap The properties of the visual
+   * @param[in] creationOptions The creation options
+   * @return The created visual, or an empty handle if the type or url is not supported
+   */
+  Toolkit::Visual::Base CreateVisualInternal(Toolkit::DevelVisual::Type visualType, const VisualUrl& visualUrl, const Property::Array& urlArray, const Property::Map& propertyMap, Toolkit::VisualFactory::CreationOptions creationOptions);
+
   /**
    * @brief Set the Broken Image url
    * @param[in] styleManager The instance of StyleManager
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/public-api/particle-system/particle-builtin-modifiers.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/particle-system/particle-modifier-kernels.h>
+#include <dali-toolkit/public-api/particle-system/particle-list.h>
+
+namespace Dali::Toolkit::ParticleSystem
+{
+namespace
+{
+/**
+ * Returns the floats of a built-in stream, starting at the given particle
+ */
+template<uint32_t N>
+float* GetStreamData(ParticleList& particleList, ParticleStreamTypeFlagBit streamBit, uint32_t firstParticleIndex)
+{
+  auto* data = particleList.GetDefaultStream<float>(streamBit);
+  return data ? data + firstParticleIndex * N : nullptr;
+}
+} // namespace
+
+GravityModifier::GravityModifier(const Vector3& acceleration)
+: mAcceleration(acceleration)
+{
+}
+
+void GravityModifier::Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount)
+{
+  auto* positions  = GetStreamData<3u>(particleList, ParticleStream::POSITION_STREAM_BIT, firstParticleIndex);
+  auto* velocities = GetStreamData<3u>(particleList, ParticleStream::VELOCITY_STREAM_BIT, firstParticleIndex);
+  if(positions && velocities)
+  {
+    Internal::ModifierKernels::Accelerate(positions, velocities, particleCount, mAcceleration.AsFloat(), particleList.GetUpdateDeltaTime());
+  }
+}
+
+DragModifier::DragModifier(float drag)
+: mDrag(drag)
+{
+}
+
+void DragModifier::Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount)
+{
+  auto* velocities = GetStreamData<3u>(particleList, ParticleStream::VELOCITY_STREAM_BIT, firstParticleIndex);
+  if(velocities)
+  {
+    // Implicit integration never reverses the velocity, whatever the time step
+    const float factor = 1.0f / (1.0f + mDrag * particleList.GetUpdateDeltaTime());
+    Internal::ModifierKernels::Scale(velocities, particleCount * 3u, factor);
+  }
+}
+
+ColorOverLifeModifier::ColorOverLifeModifier(const Vector4& startColor, const Vector4& endColor)
+: mStartColor(startColor),
+  mEndColor(endColor)
+{
+}
+
+void ColorOverLifeModifier::Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount)
+{
+  auto* colors        = GetStreamData<4u>(particleList, ParticleStream::COLOR_STREAM_BIT, firstParticleIndex);
+  auto* lifetimes     = GetStreamData<1u>(particleList, ParticleStream::LIFETIME_STREAM_BIT, firstParticleIndex);
+  auto* lifetimeBases = GetStreamData<1u>(particleList, ParticleStream::LIFETIME_BASE_STREAM_BIT, firstParticleIndex);
+  if(colors && lifetimes && lifetimeBases)
+  {
+    Internal::ModifierKernels::InterpolateOverLife<4u>(colors, lifetimes, lifetimeBases, particleCount, mStartColor.AsFloat(), mEndColor.AsFloat());
+  }
+}
+
+ScaleOverLifeModifier::ScaleOverLifeModifier(const Vector3& startScale, const Vector3& endScale)
+: mStartScale(startScale),
+  mEndScale(endScale)
+{
+}
+
+void ScaleOverLifeModifier::Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount)
+{
+  auto* scales        = GetStreamData<3u>(particleList, ParticleStream::SCALE_STREAM_BIT, firstParticleIndex);
+  auto* lifetimes     = GetStreamData<1u>(particleList, ParticleStream::LIFETIME_STREAM_BIT, firstParticleIndex);
+  auto* lifetimeBases = GetStreamData<1u>(particleList, ParticleStream::LIFETIME_BASE_STREAM_BIT, firstParticleIndex);
+  if(scales && lifetimes && lifetimeBases)
+  {
+    Internal::ModifierKernels::InterpolateOverLife<3u>(scales, lifetimes, lifetimeBases, particleCount, mStartScale.AsFloat(), mEndScale.AsFloat());
+  }
+}
+
+} // namespace Dali::Toolkit::ParticleSystem
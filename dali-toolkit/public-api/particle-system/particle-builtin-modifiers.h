@@ -0,0 +1,178 @@
+#ifndef DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BUILTIN_MODIFIERS_H
+#define DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BUILTIN_MODIFIERS_H
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/particle-system/particle-modifier.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali::Toolkit::ParticleSystem
+{
+/**
+ * @class GravityModifier
+ *
+ * @brief Accelerates particles by a constant acceleration and moves them by their velocity.
+ *
+ * Requires the POSITION and VELOCITY streams.
+ *
+ * Like the other built-in modifiers, it processes whole streams in tight loops rather than
+ * one particle at a time, and supports multi-threading.
+ *
+ * @code
+ * emitter.AddModifier(ParticleModifier::New<GravityModifier>(Vector3(0.0f, 98.0f, 0.0f)));
+ * @endcode
+ */
+class DALI_TOOLKIT_API GravityModifier : public ParticleModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] acceleration Acceleration in units per second squared
+   */
+  explicit GravityModifier(const Vector3& acceleration);
+
+  /**
+   * @copydoc ParticleModifierInterface::Update()
+   */
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) override;
+
+  /**
+   * @copydoc ParticleModifierInterface::IsMultiThreaded()
+   */
+  bool IsMultiThreaded() override
+  {
+    return true;
+  }
+
+private:
+  Vector3 mAcceleration;
+};
+
+/**
+ * @class DragModifier
+ *
+ * @brief Slows particles down in proportion to their velocity.
+ *
+ * Requires the VELOCITY stream.
+ */
+class DALI_TOOLKIT_API DragModifier : public ParticleModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] drag Drag coefficient per second. 0 doesn't slow particles down.
+   */
+  explicit DragModifier(float drag);
+
+  /**
+   * @copydoc ParticleModifierInterface::Update()
+   */
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) override;
+
+  /**
+   * @copydoc ParticleModifierInterface::IsMultiThreaded()
+   */
+  bool IsMultiThreaded() override
+  {
+    return true;
+  }
+
+private:
+  float mDrag;
+};
+
+/**
+ * @class ColorOverLifeModifier
+ *
+ * @brief Interpolates the color of particles from the start color to the end color over their lifetime.
+ *
+ * Requires the COLOR and LIFETIME streams.
+ */
+class DALI_TOOLKIT_API ColorOverLifeModifier : public ParticleModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] startColor Color of newborn particles
+   * @param[in] endColor Color of dying particles
+   */
+  ColorOverLifeModifier(const Vector4& startColor, const Vector4& endColor);
+
+  /**
+   * @copydoc ParticleModifierInterface::Update()
+   */
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) override;
+
+  /**
+   * @copydoc ParticleModifierInterface::IsMultiThreaded()
+   */
+  bool IsMultiThreaded() override
+  {
+    return true;
+  }
+
+private:
+  Vector4 mStartColor;
+  Vector4 mEndColor;
+};
+
+/**
+ * @class ScaleOverLifeModifier
+ *
+ * @brief Interpolates the scale of particles from the start scale to the end scale over their lifetime.
+ *
+ * Requires the SCALE and LIFETIME streams.
+ */
+class DALI_TOOLKIT_API ScaleOverLifeModifier : public ParticleModifierInterface
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] startScale Scale of newborn particles
+   * @param[in] endScale Scale of dying particles
+   */
+  ScaleOverLifeModifier(const Vector3& startScale, const Vector3& endScale);
+
+  /**
+   * @copydoc ParticleModifierInterface::Update()
+   */
+  void Update(ParticleList& particleList, uint32_t firstParticleIndex, uint32_t particleCount) override;
+
+  /**
+   * @copydoc ParticleModifierInterface::IsMultiThreaded()
+   */
+  bool IsMultiThreaded() override
+  {
+    return true;
+  }
+
+private:
+  Vector3 mStartScale;
+  Vector3 mEndScale;
+};
+
+} // namespace Dali::Toolkit::ParticleSystem
+
+#endif // DALI_TOOLKIT_PARTICLE_SYSTEM_PARTICLE_BUILTIN_MODIFIERS_H
@@ -84,6 +84,11 @@ uint32_t ParticleList::GetCapacity() const
   return GetImplementation(*this).GetParticleCount();
 }
 
+float ParticleList::GetUpdateDeltaTime() const
+{
+  return GetImplementation(*this).GetUpdateDeltaTime();
+}
+
 Particle ParticleList::NewParticle(float lifetime)
 {
   return GetImplementation(*this).NewParticle(lifetime);
@@ -186,6 +186,16 @@ public:
     return reinterpret_cast<T*>(GetRawStream(streamIndex));
   }
 
+  /**
+   * @brief Returns data of a default (built-in) stream
+   *
+   * Only the default streams requested when the list was created exist. A missing
+   * stream is not created on demand.
+   *
+   * @tparam T type of data
+   * @param[in] streamFlagBit Bit representing the stream
+   * @return Pointer to the stream data, or nullptr if the list doesn't have the stream
+   */
   template<class T>
   T* GetDefaultStream(ParticleStreamTypeFlagBit streamFlagBit)
   {
@@ -204,6 +214,15 @@ public:
    */
   [[nodiscard]] uint32_t GetCapacity() const;
 
+  /**
+   * @brief Returns the time simulated by the current update of the emitter
+   *
+   * Modifiers should use it to integrate values that change over time.
+   *
+   * @return Time in seconds
+   */
+  [[nodiscard]] float GetUpdateDeltaTime() const;
+
   /**
    * Creates new particle in the list with specified lifetime
    *
@@ -224,10 +243,22 @@ public:
    * @brief Returns index associated with specified default stream
    *
    * @param[in] defaultStreamBit Default stream bit
-   * @return Returns a valid index or -1 on error.
+   * @return Returns a valid index or -1 on error, e.g. if the list doesn't have the stream.
    */
   int GetDefaultStreamIndex(ParticleStreamTypeFlagBit defaultStreamBit);
 
+  /**
+   * @brief Returns list of views on the active particles
+   *
+   * Active particles occupy the first GetActiveParticleCount() elements of each stream,
+   * so accessing the streams directly is faster. The list is kept between calls and only
+   * follows the emitted and released particles.
+   *
+   * A released particle is replaced by the last active one, so the order of the particles
+   * changes. The blending modes of the renderer don't depend on the order.
+   *
+   * @return List of active particles
+   */
   std::list<Particle>& GetActiveParticles();
 
 private:
@@ -46,6 +46,10 @@ public:
 
   /**
    * @brief Update function to update the modifier to alter the behavior of particles.
+   *
+   * Active particles are stored densely, so the particles to update are the elements
+   * [firstParticleIndex, firstParticleIndex + particleCount) of each stream.
+   *
    * @param[in] particleList       List of particles
    * @param[in] firstParticleIndex Index of the first particle
    * @param[in] particleCount      Number of particles
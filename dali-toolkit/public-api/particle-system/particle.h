@@ -67,6 +67,7 @@ public:
    * @tparam T type of data
    * @param[in] streamBit Stream to access data from
    * @return Reference to the data value
+   * @note The list must have been created with the stream, see ParticleList::GetDefaultStream().
    */
   template<class T>
   T& Get(ParticleStreamTypeFlagBit streamBit)
@@ -93,6 +94,9 @@ public:
   /**
    * @brief Returns an index of particle within emitter data streams.
    *
+   * When a particle dies, the last active particle is moved into its place, so the
+   * index (and the data the Particle refers to) is only stable until the next update.
+   *
    * @return Index of particle
    */
   [[nodiscard]] uint32_t GetIndex() const;
@@ -118,7 +122,7 @@ private:
    *
    * @param[in] streamBit Stream to access data from
    *
-   * @return void* to the memory within stream that stores the data
+   * @return void* to the memory within stream that stores the data, or nullptr if the list doesn't have the stream
    */
   void* Get(ParticleStreamTypeFlagBit streamBit);
   /// @endcond